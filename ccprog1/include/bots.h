@@ -0,0 +1,118 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_BOTS_H_
+#define CCPROG1_BOTS_H_
+
+#include "engine.h"
+
+#define EXPECTIMAX_DEFAULT_DEPTH 2
+#define EXPECTIMAX_DEFAULT_SAMPLE_AMOUNT 6
+#define EXPECTIMAX_MAXIMUM_THREAD_AMOUNT 64
+#define EXPECTIMAX_TRANSPOSITION_TABLE_SIZE (1 << 16)
+
+#define GREEDY_DEFAULT_MINIMUM_MARGIN 1
+#define GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE 1
+#define GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT 100
+
+// Selling every cargo, upgrading, buying a cargo, and navigating.
+#define MAXIMUM_TURN_PLAN_ACTION_AMOUNT (CARGO_AMOUNT + 3)
+
+/** The parameters and memory of a bot that plays by searching the game tree with expectimax. */
+typedef struct ExpectimaxBot {
+  /** The number of voyages to look ahead. */
+  int nDepth;
+  /** The number of random market prices to sample at every port arrival. */
+  int nSampleAmount;
+  /** The number of threads to split the root's turn plans across. */
+  int nThreadAmount;
+  /** The total number of game tree nodes that the bot has searched. */
+  long long llNodeAmount;
+  /** The actions of the current turn's plan, which are given out one at a time. */
+  GameAction aPlannedActions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int nPlannedActionAmount;
+  int nNextPlannedActionIndex;
+  int nPlannedTurn;
+  char cPlannedPortId;
+} ExpectimaxBot;
+
+/** The parameters and memory of a bot that plays one voyage at a time with the route values from `planning.h`. */
+typedef struct GreedyBot {
+  /** The smallest expected profit per cargo, in gold coins, that the bot buys a cargo for. */
+  int nMinimumMargin;
+  /** The smallest expected net value, in gold coins, that the bot upgrades its ship for. */
+  int nMinimumUpgradeValue;
+  /** The percentage of the voyages' route values after the next one that is added to a port's score. */
+  int nRouteValueWeight;
+  /** The actions of the current turn's plan, which are given out one at a time. */
+  GameAction aPlannedActions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int nPlannedActionAmount;
+  int nNextPlannedActionIndex;
+  int nPlannedTurn;
+  char cPlannedPortId;
+} GreedyBot;
+
+/**
+ * Sets up an expectimax bot before its first game.
+ * @param[out] pBot The bot.
+ * @param nDepth The number of voyages to look ahead.
+ * @pre @p nDepth must have a positive integer value.
+ * @param nSampleAmount The number of random market prices to sample at every port arrival.
+ * @pre @p nSampleAmount must have a positive integer value.
+ * @param nThreadAmount The number of threads to search with.
+ * @pre @p nThreadAmount must have an integer value within the range of `1` and `64`.
+ */
+void initializeExpectimaxBot(ExpectimaxBot *pBot, int nDepth, int nSampleAmount, int nThreadAmount);
+
+/**
+ * Searches the game tree for the turn plan with the best expected final balance. Every turn plan is a max node made of
+ * selling all cargo or keeping it, upgrading the ship or not, buying as much of one cargo as possible or none, and
+ * navigating to a port. Every port arrival is a chance node that averages the sampled market prices within the ranges
+ * in `trading.h`. Repeated states are looked up in a transposition table, and the root's turn plans are split across
+ * threads, each with its own table.
+ * @param pGameState The current state of the game.
+ * @param nDepth The number of voyages to look ahead.
+ * @param nSampleAmount The number of random market prices to sample at every port arrival.
+ * @param nThreadAmount The number of threads to search with.
+ * @param[out] aTurnActions The actions of the best turn plan in the order they must be applied.
+ * @param[out] nTurnActionAmount The number of actions in @p aTurnActions.
+ * @returns The number of game tree nodes searched.
+ */
+long long searchExpectimax(const GameState *pGameState, int nDepth, int nSampleAmount, int nThreadAmount,
+                           GameAction aTurnActions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT], int *nTurnActionAmount);
+
+/**
+ * Decides the next action of an expectimax bot, searching only at the start of every turn.
+ * @param pGameState The current state of the game.
+ * @param pContext The bot, which must be an `ExpectimaxBot`.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+void chooseExpectimaxAction(const GameState *pGameState, void *pContext, GameAction *pGameAction);
+
+/**
+ * Sets up a greedy bot before its first game.
+ * @param[out] pBot The bot.
+ * @param nMinimumMargin The smallest expected profit per cargo, in gold coins, that the bot buys a cargo for.
+ * @param nMinimumUpgradeValue The smallest expected net value, in gold coins, that the bot upgrades its ship for.
+ * @param nRouteValueWeight The percentage of the voyages' route values after the next one that is added to a port's
+ * score.
+ */
+void initializeGreedyBot(GreedyBot *pBot, int nMinimumMargin, int nMinimumUpgradeValue, int nRouteValueWeight);
+
+/**
+ * Decides the next action of a greedy bot. At the start of every turn, the bot sells all of its cargo, upgrades its
+ * ship if the upgrade's expected net value is large enough, and then picks the port and cargo with the best expected
+ * profit from the next voyage plus a weighted share of the route values of the voyages after it.
+ * @param pGameState The current state of the game.
+ * @param pContext The bot, which must be a `GreedyBot`.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+void chooseGreedyAction(const GameState *pGameState, void *pContext, GameAction *pGameAction);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_BOTS_H_
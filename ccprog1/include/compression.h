@@ -0,0 +1,46 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_COMPRESSION_H_
+#define CCPROG1_COMPRESSION_H_
+
+// Matches must be at least this long and at most this far back.
+#define LZ_MINIMUM_MATCH_SIZE 4
+#define LZ_MAXIMUM_MATCH_OFFSET 65535
+
+#define LZ_HASH_TABLE_BIT_AMOUNT 12
+#define LZ_HASH_TABLE_SIZE (1 << LZ_HASH_TABLE_BIT_AMOUNT)
+
+// The largest size that compressing a block of a given size can produce.
+#define LZ_MAXIMUM_COMPRESSED_SIZE(nSize) ((nSize) + (nSize) / 255 + 16)
+
+/**
+ * Compresses a block of bytes with a fast LZ77 compressor in the style of LZ4. The block is made of sequences, each
+ * holding a token byte with the lengths of its literals and match, the literals, and a 2-byte offset back to the
+ * match. Matches are found with a hash table of the last position of every 4 bytes.
+ * @param aucSource The bytes to compress.
+ * @param nSourceSize The number of bytes to compress.
+ * @param[out] aucDestination The compressed bytes, which must have room for `LZ_MAXIMUM_COMPRESSED_SIZE(nSourceSize)`
+ * bytes.
+ * @returns The number of compressed bytes.
+ */
+int compressLzBlock(const unsigned char aucSource[], int nSourceSize, unsigned char aucDestination[]);
+
+/**
+ * Decompresses a block of bytes compressed by `compressLzBlock()`, checking every length and offset.
+ * @param aucSource The compressed bytes.
+ * @param nSourceSize The number of compressed bytes.
+ * @param[out] aucDestination The decompressed bytes.
+ * @param nDestinationCapacity The number of bytes that @p aucDestination can hold.
+ * @returns The number of decompressed bytes, or `-1` if the block is corrupted or does not fit.
+ */
+int decompressLzBlock(const unsigned char aucSource[], int nSourceSize, unsigned char aucDestination[],
+                      int nDestinationCapacity);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_COMPRESSION_H_
@@ -9,34 +9,197 @@
 #ifndef CCPROG1_CONSOLE_H_
 #define CCPROG1_CONSOLE_H_
 
+#include "rendering.h"
+
 #define COLOR_DEFAULT "\033[0m"
 #define COLOR_RED "\033[0;31m"
 #define COLOR_GREEN "\033[0;32m"
 #define COLOR_YELLOW "\033[0;33m"
 
-/** Resets the color of text output in the console using an ANSI escape sequence. */
+#define DEFAULT_COLOR_ID 'D'
+#define RED_COLOR_ID 'R'
+#define GREEN_COLOR_ID 'G'
+#define YELLOW_COLOR_ID 'Y'
+
+#define CONSOLE_FRAME_SIZE 65536
+#define CONSOLE_MAXIMUM_OUTPUT_CHUNK_HANDLER_AMOUNT 4
+
+/**
+ * Decides what to do while the game blocks on the player's input.
+ * @param bIsWaiting `1` right before the game starts waiting or `0` right after the input has arrived.
+ */
+typedef void (*InputWaitHandler)(int bIsWaiting);
+
+/**
+ * Receives a chunk of the text printed to the console, which is everything printed since the previous chunk.
+ * @param pText The text, which is not null-terminated.
+ * @param nTextSize The number of characters in the text.
+ */
+typedef void (*OutputChunkHandler)(const char *pText, int nTextSize);
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+/**
+ * Checks whether the console can show colors, which is detected on the first call. Colors are disabled if the
+ * `NO_COLOR` environment variable is set, if the terminal is `dumb`, or if the output is not a terminal.
+ * @returns `1` if color escape sequences are printed or `0` if they are not.
+ */
+int areConsoleColorsEnabled(void);
+
+/**
+ * Overrides the detection of whether the console can show colors.
+ * @param bColorsAreEnabled `1` to print color escape sequences or `0` to never print them.
+ */
+void setConsoleColorsEnabled(int bColorsAreEnabled);
+
+/**
+ * Gets the number of color changes asked for and the number of escape sequences actually printed for them.
+ * @param[out] llRequestedAmount The number of color changes asked for.
+ * @param[out] llPrintedAmount The number of escape sequences printed.
+ */
+void getConsoleColorChangeAmounts(long long *llRequestedAmount, long long *llPrintedAmount);
+
+/** Resets the color of text output in the console, which is applied when the next text is printed. */
 void resetConsoleColor(void);
 
-/** Sets the color of text output in the console to red using an ANSI escape sequence. */
+/** Sets the color of text output in the console to red, which is applied when the next text is printed. */
 void setConsoleColorToRed(void);
 
-/** Sets the color of text output in the console to green using an ANSI escape sequence. */
+/** Sets the color of text output in the console to green, which is applied when the next text is printed. */
 void setConsoleColorToGreen(void);
 
-/** Sets the color of text output in the console to yellow using an ANSI escape sequence. */
+/** Sets the color of text output in the console to yellow, which is applied when the next text is printed. */
 void setConsoleColorToYellow(void);
 
 /**
- * Prompts the player to input an integer into the console.
+ * Prints out text in the console's current color. An escape sequence is only printed if the color has changed since
+ * the last printed text, and text made only of spaces and line breaks does not change it.
+ * @param strFormat The `printf()` format of the text.
+ */
+void printConsoleText(const char *strFormat, ...);
+
+/**
+ * Prints out a span of text in a color, and then goes back to the console's current color for the text after it.
+ * @param cColorId `'D'` for the default color, `'R'` for red, `'G'` for green, or `'Y'` for yellow.
+ * @param strFormat The `printf()` format of the text.
+ */
+void printStyledText(char cColorId, const char *strFormat, ...);
+
+/**
+ * Text that was printed into memory instead of the console, which is printed out later in a single write. The console's
+ * colors before and after the text are kept, so that the text's escape sequences can be coalesced like any other text.
+ */
+typedef struct ConsoleFrame {
+  char acText[CONSOLE_FRAME_SIZE];
+  int nTextSize;
+  /** Whether the text did not fit in the frame, which makes the frame unusable. */
+  int bIsTruncated;
+  int bColorsAreEnabled;
+  char cStartColorId;
+  char cStartPrintedColorId;
+  char cEndColorId;
+  char cEndPrintedColorId;
+  long long llRequestedColorChangeAmount;
+  long long llPrintedColorChangeAmount;
+} ConsoleFrame;
+
+/**
+ * Starts printing every text into a frame instead of the console, starting from the console's current colors.
+ * @param[out] pFrame The frame.
+ * @pre No other thread may print to the console until the frame is ended.
+ */
+void beginConsoleFrame(ConsoleFrame *pFrame);
+
+/**
+ * Stops printing into the current frame, and puts the console's colors and color change counts back to how they were
+ * when the frame began.
+ */
+void endConsoleFrame(void);
+
+/**
+ * Prints out the text of a frame, as if it were printed right now.
+ * @param pFrame The frame.
+ * @returns `1` if the frame was printed or `0` if it was truncated, or if it began in a color other than the console's
+ * current color or with colors enabled differently.
+ */
+int printConsoleFrame(const ConsoleFrame *pFrame);
+
+/**
+ * Adds a function that is handed everything printed to the console in chunks, which end right before the game waits
+ * for the player's input or once `CONSOLE_FRAME_SIZE` characters have been kept. Text printed into a frame is only
+ * handed over when the frame is printed out. A single text longer than a whole chunk is cut off while there is a
+ * handler. Any text kept for the other handlers is handed to them first.
+ * @param fnHandler The function.
+ * @returns `1` if the function was added or `0` if there are already `4` handlers.
+ */
+int addOutputChunkHandler(OutputChunkHandler fnHandler);
+
+/**
+ * Hands the kept text to every output chunk handler, and then removes one of them.
+ * @param fnHandler The function to remove.
+ */
+void removeOutputChunkHandler(OutputChunkHandler fnHandler);
+
+/** Hands the text printed since the last chunk to every output chunk handler, if there is any text and handler. */
+void flushOutputChunk(void);
+#else
+// Compile the colors away in the plain and null backends.
+#define resetConsoleColor() ((void)0)
+#define setConsoleColorToRed() ((void)0)
+#define setConsoleColorToGreen() ((void)0)
+#define setConsoleColorToYellow() ((void)0)
+#define printStyledText(cColorId, ...) printRenderedText(__VA_ARGS__)
+#endif
+
+/**
+ * Makes character inputs react to a single keystroke, without waiting for the enter key or echoing, instead of reading
+ * a line. The terminal is only raw while a character input waits, and is restored on exit or when stopped or suspended
+ * by a signal.
+ * Integer inputs still read a line.
+ * @param bRawInputIsRequested `1` to read single keystrokes or `0` to read lines.
+ * @returns `1` if single keystrokes are read or `0` if lines are read, which is also the case when the input is not a
+ * terminal.
+ */
+int setRawInputEnabled(int bRawInputIsRequested);
+
+/**
+ * Sets the function that is called right before and after the game blocks on the player's input, which lets work that
+ * would otherwise be done after the input run while the player is thinking.
+ * @param fnHandler The function, or `NULL` to not call any.
+ */
+void setInputWaitHandler(InputWaitHandler fnHandler);
+
+/**
+ * Checks whether the player has already typed the input of the next prompt on the current line, in which case the
+ * prompt does not have to be printed out.
+ * @returns `1` if there is unread input on the current line or `0` if the next prompt has to wait for a new line.
+ */
+int hasQueuedInput(void);
+
+/**
+ * Checks whether the current line was typed with more than one token, like `B G 40 Y`, which completes a whole command
+ * without stopping at every prompt.
+ * @returns `1` if the current line is a typed-ahead command or `0` if it is not.
+ */
+int isInputTypedAhead(void);
+
+/**
+ * Discards the rest of the current line, which is done after an invalid input so that the rest of a typed-ahead command
+ * is not applied to the wrong prompts.
+ */
+void discardQueuedInput(void);
+
+/**
+ * Prompts the player to input an integer into the console, unless it has already been typed ahead.
  * @param nLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first integer value inputted into the console.
+ * @returns The first integer value inputted into the console, or the smallest integer value if the input is not an
+ * integer.
  */
 int getIntegerInput(int nLeftPaddingSize);
 
 /**
- * Prompts the player to input a character into the console.
+ * Prompts the player to input a character into the console, unless it has already been typed ahead.
  * @param nLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first character value inputted into the console.
+ * @returns The first character value inputted into the console, or `'\0'` if the input has ended.
  */
 char getCharacterInput(int nLeftPaddingSize);
 
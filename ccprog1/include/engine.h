@@ -0,0 +1,142 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_ENGINE_H_
+#define CCPROG1_ENGINE_H_
+
+#include "trading.h"
+
+#define INITIAL_PORT_ID 'M'
+
+/** The state of a game, which contains everything about the player, their ship, and the port's market. */
+typedef struct GameState {
+  char cPortId;
+  int nPlayerTurns;
+  int nPlayerInitialBalance;
+  int nPlayerBalance;
+  int nShipCargoLimit;
+  int anShipCargoAmounts[CARGO_AMOUNT];
+  int anMarketPrices[CARGO_AMOUNT];
+  int bPlayerHasQuit;
+} GameState;
+
+/** An action that the player can do in a game, which mirrors the choices in the game's prompts. */
+typedef struct GameAction {
+  /** `'B'` for buying, `'S'` for selling, `'U'` for upgrading, `'N'` for navigating, or `'Q'` for quitting. */
+  char cActionId;
+  /** The ID of the traded cargo when buying or selling. */
+  char cCargoId;
+  /** The amount of cargo to trade when buying or selling. */
+  int nCargoAmount;
+  /** The ID of the port to navigate to when navigating. */
+  char cPortId;
+} GameAction;
+
+/**
+ * Decides the next action of a bot in a game.
+ * @param pGameState The current state of the game.
+ * @param pContext The bot's own parameters and memory.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+typedef void (*GameStrategy)(const GameState *pGameState, void *pContext, GameAction *pGameAction);
+
+/**
+ * Sets a game's state to the start of a new game in the initial port. The market prices are not generated.
+ * @param[out] pGameState The state of the game.
+ * @param nPlayerInitialBalance The number of gold coins the player starts with.
+ */
+void initializeGameState(GameState *pGameState, int nPlayerInitialBalance);
+
+/**
+ * Generates random market prices for the port that the player is currently in.
+ * @param[out] pGameState The state of the game.
+ */
+void generateGameMarketPrices(GameState *pGameState);
+
+/**
+ * Turns a seed into the state of an xorshift64* generator, which is independent for every caller unlike `rand()`.
+ * @param ullSeed The seed.
+ * @returns A generator state that is never `0`.
+ */
+unsigned long long seedRandomState(unsigned long long ullSeed);
+
+/**
+ * Generates the next pseudorandom number of an xorshift64* generator.
+ * @param[out] pullRandomState The generator's state.
+ * @pre @p pullRandomState must not point to `0`.
+ * @returns A pseudorandom 64-bit integer.
+ */
+unsigned long long generateNextRandomNumber(unsigned long long *pullRandomState);
+
+/**
+ * Generates a random price within the provided maximum and minimum prices from an xorshift64* generator.
+ * @param[out] pullRandomState The generator's state.
+ * @param nMinimumPrice The minimum allowed price.
+ * @param nMaximumPrice The maximum allowed price.
+ * @returns An integer value within the range of `nMinimumPrice` and `nMaximumPrice`.
+ */
+int generateSeededRandomPrice(unsigned long long *pullRandomState, int nMinimumPrice, int nMaximumPrice);
+
+/**
+ * Generates random market prices for the port that the player is currently in from an xorshift64* generator, which
+ * makes the prices reproducible and safe to generate from multiple threads.
+ * @param[out] pGameState The state of the game.
+ * @param[out] pullRandomState The generator's state.
+ */
+void generateSeededGameMarketPrices(GameState *pGameState, unsigned long long *pullRandomState);
+
+/**
+ * Gets the total amount of cargo carried by the ship.
+ * @param pGameState The state of the game.
+ * @returns The sum of the amount of every cargo carried by the ship.
+ */
+int getShipTotalCargoAmount(const GameState *pGameState);
+
+/**
+ * Gets the largest amount of a cargo that the player can both afford and store, which is `0` whenever buying is not
+ * offered.
+ * @param pGameState The state of the game.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @returns An integer value greater than or equal to `0`.
+ */
+int getMaximumBuyAmount(const GameState *pGameState, char cCargoId);
+
+/**
+ * Checks whether an action follows the same rules that the game's prompts enforce.
+ * @param pGameState The state of the game.
+ * @param pGameAction The action to check.
+ * @returns `1` if the action can be done or `0` if it cannot.
+ */
+int isGameActionValid(const GameState *pGameState, const GameAction *pGameAction);
+
+/**
+ * Applies an action to a game's state without printing anything to the console.
+ * @param[out] pGameState The state of the game.
+ * @param pGameAction The action to apply.
+ * @returns `1` if the action was applied or `0` if it was invalid and ignored.
+ * @post After navigating, the market prices must be regenerated for the new port by the caller.
+ */
+int applyGameAction(GameState *pGameState, const GameAction *pGameAction);
+
+/**
+ * Checks whether the player has exhausted all of their turns or has quit.
+ * @param pGameState The state of the game.
+ * @returns `1` if the game is over or `0` if it is not.
+ */
+int isGameOver(const GameState *pGameState);
+
+/**
+ * Hashes every field of a game's state, which is used to identify and compare states.
+ * @param pGameState The state of the game.
+ * @returns A 64-bit FNV-1a hash.
+ */
+unsigned long long hashGameState(const GameState *pGameState);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_ENGINE_H_
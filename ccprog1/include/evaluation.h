@@ -0,0 +1,69 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_EVALUATION_H_
+#define CCPROG1_EVALUATION_H_
+
+#define SEQUENTIAL_TEST_DEFAULT_INDIFFERENCE_MARGIN 500
+#define SEQUENTIAL_TEST_DEFAULT_ERROR_RATE 0.05
+
+// The variance of the differences is too unreliable to test with before this many pairs.
+#define SEQUENTIAL_TEST_MINIMUM_PAIR_AMOUNT 30
+
+/**
+ * A sequential probability ratio test (SPRT) on the mean difference between paired values, such as the profits of two
+ * bots that played the same markets. The test weighs whether the first value is larger by the indifference margin
+ * against whether the second value is, assuming normal differences with the sample variance, and decides as soon as
+ * either is likely enough.
+ */
+typedef struct SequentialTest {
+  double dIndifferenceMargin;
+  /** The log-likelihood ratio at or below which the second value is decided to be larger. */
+  double dLowerBound;
+  /** The log-likelihood ratio at or above which the first value is decided to be larger. */
+  double dUpperBound;
+  long long llPairAmount;
+  double dDifferenceSum;
+  double dDifferenceSquareSum;
+} SequentialTest;
+
+/**
+ * Sets up a sequential test without any pairs.
+ * @param[out] pTest The test.
+ * @param dIndifferenceMargin The smallest mean difference that matters.
+ * @pre @p dIndifferenceMargin must have a positive value.
+ * @param dErrorRate The chance of deciding on the wrong value when the true mean difference is the margin.
+ * @pre @p dErrorRate must have a value within the range of `0` and `0.5`, exclusive.
+ */
+void initializeSequentialTest(SequentialTest *pTest, double dIndifferenceMargin, double dErrorRate);
+
+/**
+ * Adds a pair of values to a sequential test.
+ * @param[out] pTest The test.
+ * @param dFirstValue The first value.
+ * @param dSecondValue The second value, which is paired with the first.
+ */
+void addSequentialTestPair(SequentialTest *pTest, double dFirstValue, double dSecondValue);
+
+/**
+ * Gets the log-likelihood ratio of the first value being larger over the second value being larger.
+ * @param pTest The test.
+ * @returns The log-likelihood ratio, or `0` before the minimum number of pairs.
+ */
+double getSequentialTestLogLikelihoodRatio(const SequentialTest *pTest);
+
+/**
+ * Gets the decision of a sequential test.
+ * @param pTest The test.
+ * @returns `1` if the first value is larger, `-1` if the second value is larger, or `0` if there is not enough evidence
+ * yet.
+ */
+int getSequentialTestDecision(const SequentialTest *pTest);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_EVALUATION_H_
@@ -0,0 +1,181 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_EVENTS_H_
+#define CCPROG1_EVENTS_H_
+
+#include <stdio.h>
+
+#include "engine.h"
+
+#define EVENT_LOG_MAGIC "EVLG"
+#define EVENT_LOG_VERSION 2
+
+#define EVENT_LOG_BUFFER_SIZE (1 << 16)
+// A game start event, the largest event, takes at most this many bytes.
+#define EVENT_LOG_MAXIMUM_EVENT_SIZE 32
+
+#define GAME_START_EVENT_ID 'G'
+#define MARKET_EVENT_ID 'M'
+#define TRADE_EVENT_ID 'T'
+#define UPGRADE_EVENT_ID 'U'
+#define VOYAGE_EVENT_ID 'V'
+#define GAME_END_EVENT_ID 'E'
+
+#define RAND_PRICE_SOURCE_ID 'R'
+#define SEEDED_PRICE_SOURCE_ID 'S'
+#define TAPE_PRICE_SOURCE_ID 'T'
+#define LIVE_PRICE_SOURCE_ID 'L'
+
+/** Something that happened in a game. Only the fields of the event's kind are used. */
+typedef struct GameEvent {
+  /** `'G'` for a game start, `'M'` for a port's market prices, `'T'` for a trade, `'U'` for a ship upgrade, `'V'` for
+   * a voyage, or `'E'` for a game end. */
+  char cEventId;
+  /** The number of turns the player has exhausted, which is filled in by the reader. */
+  int nPlayerTurns;
+  /** The port the player is in, or the destination port of a voyage, which is filled in by the reader. */
+  char cPortId;
+  /** The seed of the game's random market prices, or its index in a price tape, for a game start. */
+  unsigned long long ullSeed;
+  /** `'R'` if the market prices come from `rand()`, `'S'` if they come from `generatePriceTapeGame()`, `'T'` if they
+   * come from a price tape, or `'L'` if they come from a market ticker and are only known from the log, for a game
+   * start. */
+  char cPriceSourceId;
+  /** The player's ID, for a game start. */
+  int nPlayerId;
+  /** The player's target profit percentage, for a game start. */
+  int nPlayerProfitTarget;
+  /** The player's initial balance for a game start or final balance for a game end. */
+  int nPlayerBalance;
+  /** The market prices of the port, for a port's market prices. */
+  int anMarketPrices[CARGO_AMOUNT];
+  /** `'B'` for buying or `'S'` for selling, for a trade. */
+  char cActionId;
+  /** The ID of the traded cargo, for a trade. */
+  char cCargoId;
+  /** The amount of traded cargo, for a trade. */
+  int nCargoAmount;
+  /** The price of a single traded cargo, for a trade. */
+  int nCargoPrice;
+  /** The upgraded cargo limit of the ship, which is filled in by the reader for a ship upgrade. */
+  int nShipCargoLimit;
+  /** The cost of the ship upgrade, which is filled in by the reader for a ship upgrade. */
+  int nShipUpgradeCost;
+  /** The rolling hash of the game's state at the end of every turn so far, for a voyage or game end. */
+  unsigned int unStateHash;
+} GameEvent;
+
+/**
+ * What a writer or reader remembers about the game being logged, which lets events leave out whatever can be worked
+ * out from the events before them.
+ */
+typedef struct EventLogContext {
+  int nPlayerTurns;
+  char cPortId;
+  int nPlayerInitialBalance;
+  int nShipCargoLimit;
+  int anMarketPrices[CARGO_AMOUNT];
+} EventLogContext;
+
+/**
+ * A buffered writer of an append-only event log. Every event starts with a byte holding its kind and its small
+ * fields, followed by variable-length integers. Prices are stored as differences from the port's minimum prices or the
+ * last market prices, so most events take 1 to 5 bytes.
+ */
+typedef struct EventLogWriter {
+  FILE *pFile;
+  unsigned char aucBuffer[EVENT_LOG_BUFFER_SIZE];
+  int nBufferSize;
+  long long llEventAmount;
+  EventLogContext sContext;
+} EventLogWriter;
+
+/** A buffered reader of an event log, which streams its events back out in order. */
+typedef struct EventLogReader {
+  FILE *pFile;
+  unsigned char aucBuffer[EVENT_LOG_BUFFER_SIZE];
+  int nBufferSize;
+  int nBufferPosition;
+  long long llEventAmount;
+  EventLogContext sContext;
+} EventLogReader;
+
+/**
+ * Opens a new event log file for writing, replacing any file with the same path.
+ * @param[out] pWriter The writer.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the file was opened or `0` if it could not be.
+ */
+int openEventLogWriter(EventLogWriter *pWriter, const char *strFilePath);
+
+/**
+ * Writes an event to an event log, flushing the writer's buffer to the file when it is nearly full.
+ * @param[out] pWriter The writer.
+ * @param pGameEvent The event. Only the fields that are not filled in by the reader are written.
+ * @pre Every game's events must start with a game start event.
+ * @returns `1` if the event was written or `0` if the file could not be written to or the event's kind, price source,
+ * cargo, or port is unknown.
+ */
+int writeGameEvent(EventLogWriter *pWriter, const GameEvent *pGameEvent);
+
+/**
+ * Writes the buffer of an event log writer to its file and hands the file's own buffer to the operating system.
+ * @param[out] pWriter The writer.
+ * @returns `1` if the buffer was written or `0` if the file could not be written to.
+ */
+int flushEventLogWriter(EventLogWriter *pWriter);
+
+/**
+ * Flushes the buffer of an event log writer and closes its file.
+ * @param[out] pWriter The writer.
+ * @returns `1` if every event was written or `0` if the file could not be written to.
+ */
+int closeEventLogWriter(EventLogWriter *pWriter);
+
+/**
+ * Opens an event log file for reading.
+ * @param[out] pReader The reader.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the file was opened or `0` if it does not exist or is not an event log.
+ */
+int openEventLogReader(EventLogReader *pReader, const char *strFilePath);
+
+/**
+ * Reads the next event from an event log.
+ * @param[out] pReader The reader.
+ * @param[out] pGameEvent The event, including the fields that are filled in by the reader.
+ * @returns `1` if an event was read, `0` if there are no events left, or `-1` if the log is corrupted.
+ */
+int readGameEvent(EventLogReader *pReader, GameEvent *pGameEvent);
+
+/**
+ * Closes the file of an event log reader.
+ * @param[out] pReader The reader.
+ */
+void closeEventLogReader(EventLogReader *pReader);
+
+/**
+ * Rolls the hash of a game's state into the hashes of the states before it.
+ * @param unStateHash The rolling hash so far, which is `0` at the start of a game.
+ * @param pGameState The state of the game.
+ * @returns The updated rolling hash.
+ */
+unsigned int rollGameStateHash(unsigned int unStateHash, const GameState *pGameState);
+
+/**
+ * Sets up an event from an action done in a game, before the action is applied. For a navigation, the state is also
+ * rolled into the event's rolling state hash, which must be kept from the game's previous events.
+ * @param pGameState The state of the game before the action.
+ * @param pGameAction The action, which must be a buy, sell, upgrade, or navigation.
+ * @param[out] pGameEvent The event.
+ */
+void setGameActionEvent(const GameState *pGameState, const GameAction *pGameAction, GameEvent *pGameEvent);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_EVENTS_H_
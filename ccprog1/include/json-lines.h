@@ -0,0 +1,83 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_JSON_LINES_H_
+#define CCPROG1_JSON_LINES_H_
+
+#include <stdio.h>
+
+#define JSON_LINE_BUFFER_SIZE 512
+
+/**
+ * A single compact JSON object that is built in place, without allocating, and written out as one line. Fields that do
+ * not fit in the buffer are dropped instead of overflowing it.
+ */
+typedef struct JsonLine {
+  char acBuffer[JSON_LINE_BUFFER_SIZE];
+  int nSize;
+  int bHasField;
+  int bHasOverflowed;
+} JsonLine;
+
+/**
+ * Starts a new JSON object.
+ * @param[out] pJsonLine The JSON object.
+ */
+void beginJsonLine(JsonLine *pJsonLine);
+
+/**
+ * Adds an integer field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param llValue The field's value.
+ */
+void addJsonIntegerField(JsonLine *pJsonLine, const char *strKey, long long llValue);
+
+/**
+ * Adds a boolean field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param bValue The field's value.
+ */
+void addJsonBooleanField(JsonLine *pJsonLine, const char *strKey, int bValue);
+
+/**
+ * Adds a string field to a JSON object, escaping the string's quotes, backslashes, and control characters.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param strValue The field's value.
+ */
+void addJsonStringField(JsonLine *pJsonLine, const char *strKey, const char *strValue);
+
+/**
+ * Adds a field to a JSON object whose value is a string of a single character, such as a port's or cargo's ID.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param cValue The field's value.
+ */
+void addJsonCharacterField(JsonLine *pJsonLine, const char *strKey, char cValue);
+
+/**
+ * Adds an array of integers field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param anValues The field's values.
+ * @param nValueAmount The number of values.
+ */
+void addJsonIntegerArrayField(JsonLine *pJsonLine, const char *strKey, const int anValues[], int nValueAmount);
+
+/**
+ * Ends a JSON object and writes it out as a single line.
+ * @param[out] pJsonLine The JSON object.
+ * @param[out] pStream The stream to write the line to.
+ * @returns `1` if the whole object was written or `0` if a field was dropped or the stream could not be written to.
+ */
+int writeJsonLine(JsonLine *pJsonLine, FILE *pStream);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_JSON_LINES_H_
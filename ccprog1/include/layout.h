@@ -0,0 +1,61 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_LAYOUT_H_
+#define CCPROG1_LAYOUT_H_
+
+// The width that the screens' art and paddings were drawn for.
+#define MAX_PRINT_WIDTH 156
+
+#define MAXIMUM_LAYOUT_WIDTH 1024
+#define LAYOUT_TEMPLATE_CACHE_SIZE 64
+
+// Let the compiler keep checking the `printf()` formats that are passed through `getLayoutTemplate()`.
+#ifdef __GNUC__
+#define LAYOUT_FORMAT_ARGUMENT __attribute__((format_arg(1)))
+#else
+#define LAYOUT_FORMAT_ARGUMENT
+#endif
+
+/**
+ * Overrides the detection of the console's width, which is otherwise read from the terminal.
+ * @param nWidth The number of columns to lay the screens out for, or `0` to detect it again.
+ */
+void setLayoutWidth(int nWidth);
+
+/**
+ * Gets the number of columns that the screens are laid out for. The width is read from the terminal once, and only
+ * read again after the terminal has been resized. It is `156` if the output is not a terminal.
+ * @returns An integer value within the range of `1` and `1024`.
+ */
+int getLayoutWidth(void);
+
+/**
+ * Gets the left padding that centers text in the console, from the padding that centered it in `156` columns.
+ * @param nDesignPaddingSize The number of spaces that centered the text in `156` columns.
+ * @returns An integer value greater than or equal to `0`.
+ */
+int getLayoutPaddingSize(int nDesignPaddingSize);
+
+/**
+ * Gets a separator line that spans the console's width.
+ * @returns The separator line, which is reused until the width changes.
+ */
+const char *getLayoutSeparator(void);
+
+/**
+ * Gets a multi-line template, drawn for `156` columns, with every indented line moved to center it in the console. The
+ * lines are moved together, but never past the left edge. The moved templates are cached and reused, so every template
+ * is only moved once for every width.
+ * @param strTemplate The template, which must be a string literal or otherwise never be freed.
+ * @returns The moved template, or @p strTemplate itself if it does not have to be moved.
+ */
+const char *getLayoutTemplate(const char *strTemplate) LAYOUT_FORMAT_ARGUMENT;
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_LAYOUT_H_
@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_LEADERBOARD_H_
+#define CCPROG1_LEADERBOARD_H_
+
+#include "prompts.h"
+
+#define LEADERBOARD_FILE_MAGIC "LDBD"
+#define LEADERBOARD_FILE_VERSION 1
+
+// Every merchant ID has its own record, so a record is found by indexing instead of searching.
+#define LEADERBOARD_RECORD_AMOUNT (MAXIMUM_PLAYER_ID_VALUE - MINIMUM_PLAYER_ID_VALUE + 1)
+
+#define LEADERBOARD_MAXIMUM_TOP_AMOUNT 16
+
+/**
+ * A merchant's record, which every game process updates in place with atomic operations. The best profit and the number
+ * of games share a word, so that a merchant's first game sets its best profit even if the profit is negative.
+ */
+typedef struct LeaderboardRecord {
+  /** The best profit in the upper 32 bits and the number of games in the lower 32 bits. */
+  unsigned long long ullBestProfitAndGames;
+  long long llTotalTurns;
+} LeaderboardRecord;
+
+/** The contents of a leaderboard file, which is mapped into the memory of every process that opens it. */
+typedef struct LeaderboardFile {
+  char acMagic[4];
+  int nVersion;
+  /** The number of games recorded by every process, which tells a process when its top merchants are out of date. */
+  unsigned long long ullUpdateAmount;
+  LeaderboardRecord asRecords[LEADERBOARD_RECORD_AMOUNT];
+} LeaderboardFile;
+
+/** A merchant's standing on a leaderboard. */
+typedef struct LeaderboardEntry {
+  int nPlayerId;
+  int nBestProfit;
+  int nGameAmount;
+  long long llTotalTurns;
+} LeaderboardEntry;
+
+/**
+ * A process's view of a leaderboard file. The merchants with the best profits are kept in a min-heap, which the
+ * process's own games update in place and which is only rebuilt after another process records a game or when the top
+ * merchants are first asked for.
+ */
+typedef struct Leaderboard {
+  LeaderboardFile *pFile;
+  /** The update amount that the heap was last brought up to. */
+  unsigned long long ullSeenUpdateAmount;
+  /** The number of merchants to keep the best of. */
+  int nTopAmount;
+  int nTopPlayerAmount;
+  /** The merchant IDs in the heap, with the one with the worst profit first. */
+  int anTopPlayerIds[LEADERBOARD_MAXIMUM_TOP_AMOUNT];
+  /** Each merchant's index in the heap, or `-1` if they are not in it. */
+  int anTopIndices[LEADERBOARD_RECORD_AMOUNT];
+} Leaderboard;
+
+/**
+ * Opens a leaderboard file, creating it if it does not exist, and maps it into memory. Its top merchants are only
+ * gathered once they are first asked for.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param strFilePath The path of the file.
+ * @param nTopAmount The number of merchants to keep the best of.
+ * @pre @p nTopAmount must have an integer value within the range of `1` and `16`.
+ * @returns `1` if the file was opened or `0` if it could not be or is not a leaderboard file.
+ */
+int openLeaderboard(Leaderboard *pLeaderboard, const char *strFilePath, int nTopAmount);
+
+/**
+ * Records a finished game on a leaderboard, without ever waiting for another process.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param nPlayerId The player's merchant ID.
+ * @pre @p nPlayerId must have an integer value within the range of `0` and `999`.
+ * @param nPlayerProfit The profit the player made.
+ * @param nPlayerTurns The number of turns the player took.
+ */
+void recordLeaderboardGame(Leaderboard *pLeaderboard, int nPlayerId, int nPlayerProfit, int nPlayerTurns);
+
+/**
+ * Reads a merchant's standing on a leaderboard.
+ * @param pLeaderboard The leaderboard.
+ * @param nPlayerId The merchant ID.
+ * @pre @p nPlayerId must have an integer value within the range of `0` and `999`.
+ * @param[out] pEntry The merchant's standing, whose game amount is `0` if they have not played yet.
+ */
+void readLeaderboardEntry(const Leaderboard *pLeaderboard, int nPlayerId, LeaderboardEntry *pEntry);
+
+/**
+ * Gets the merchants with the best profits on a leaderboard, rebuilding the heap first if another process has
+ * recorded a game since it was last brought up to date.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param[out] asEntries The merchants' standings, from the best profit to the worst.
+ * @returns The number of merchants, which is at most the leaderboard's top amount.
+ */
+int getLeaderboardTop(Leaderboard *pLeaderboard, LeaderboardEntry asEntries[LEADERBOARD_MAXIMUM_TOP_AMOUNT]);
+
+/**
+ * Unmaps a leaderboard file.
+ * @param[out] pLeaderboard The leaderboard.
+ */
+void closeLeaderboard(Leaderboard *pLeaderboard);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_LEADERBOARD_H_
@@ -0,0 +1,110 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_LEDGER_H_
+#define CCPROG1_LEDGER_H_
+
+#include <pthread.h>
+
+#include "events.h"
+
+#define LEDGER_MAXIMUM_CAPACITY (1 << 12)
+#define LEDGER_DEFAULT_CAPACITY LEDGER_MAXIMUM_CAPACITY
+
+// Keeps the fields written by the game thread and the writer thread on separate cache lines.
+#define LEDGER_CACHE_LINE_SIZE 64
+
+// How long the writer thread sleeps when there is nothing to write, doubling while the ring stays empty.
+#define LEDGER_MINIMUM_IDLE_NANOSECONDS 10000
+#define LEDGER_MAXIMUM_IDLE_NANOSECONDS 1000000
+
+// How long the game thread sleeps while waiting for space.
+#define LEDGER_WAIT_NANOSECONDS 10000
+
+#define DROP_FULL_POLICY_ID 'D'
+#define WAIT_FULL_POLICY_ID 'W'
+
+#define NEVER_SYNC_POLICY_ID 'N'
+#define BATCH_SYNC_POLICY_ID 'B'
+#define GAME_SYNC_POLICY_ID 'G'
+
+/**
+ * An event log that is written to by a background thread. The game thread pushes its events into a lock-free ring
+ * that only it writes to and only the writer thread reads from, so it never waits for the file unless it chooses to
+ * when the ring is full. The counters are only safe to read after the ledger is closed.
+ */
+typedef struct Ledger {
+  // Written by the game thread.
+  unsigned long long ullHead;
+  unsigned long long ullCachedTail;
+  int bIsClosing;
+  /** The number of events pushed into the ring. */
+  long long llPushedAmount;
+  /** The number of events dropped because the ring was full. */
+  long long llDroppedAmount;
+  /** The number of pushes that had to wait for space because the ring was full. */
+  long long llWaitedAmount;
+  char acGameThreadPadding[LEDGER_CACHE_LINE_SIZE];
+
+  // Written by the writer thread.
+  unsigned long long ullTail;
+  /** The number of events written to the file. */
+  long long llWrittenAmount;
+  /** The number of batches of events written to the file. */
+  long long llBatchAmount;
+  /** The number of times the file was synced to the disk. */
+  long long llSyncAmount;
+  /** The largest number of events written in a single batch. */
+  int nMaximumBatchSize;
+  int bHasFailed;
+  char acWriterThreadPadding[LEDGER_CACHE_LINE_SIZE];
+
+  // Set when opened.
+  int nCapacity;
+  /** `'D'` to drop events or `'W'` to wait for space when the ring is full. */
+  char cFullPolicyId;
+  /** `'N'` to never sync the file, `'B'` to sync after every batch, or `'G'` to sync after every batch with a game
+   * end. */
+  char cSyncPolicyId;
+  int bThreadIsStarted;
+  pthread_t sThread;
+  EventLogWriter sWriter;
+  GameEvent asEvents[LEDGER_MAXIMUM_CAPACITY];
+} Ledger;
+
+/**
+ * Opens a new event log file for writing by a background thread, replacing any file with the same path. If the
+ * thread cannot be started, the events are written by the game thread instead.
+ * @param[out] pLedger The ledger.
+ * @param strFilePath The path of the file.
+ * @param nCapacity The number of events that the ring can hold.
+ * @pre @p nCapacity must be a power of two within the range of `1` and `4096`.
+ * @param cFullPolicyId `'D'` to drop events or `'W'` to wait for space when the ring is full.
+ * @param cSyncPolicyId `'N'` to never sync the file, `'B'` to sync after every batch, or `'G'` to sync after every
+ * batch with a game end.
+ * @returns `1` if the file was opened or `0` if it could not be.
+ */
+int openLedger(Ledger *pLedger, const char *strFilePath, int nCapacity, char cFullPolicyId, char cSyncPolicyId);
+
+/**
+ * Pushes an event into a ledger's ring without doing any I/O.
+ * @param[out] pLedger The ledger.
+ * @param pGameEvent The event.
+ * @returns `1` if the event was pushed or `0` if it was dropped.
+ */
+int pushLedgerEvent(Ledger *pLedger, const GameEvent *pGameEvent);
+
+/**
+ * Writes every pushed event, stops the writer thread, and closes the ledger's file.
+ * @param[out] pLedger The ledger.
+ * @returns `1` if every pushed event was written or `0` if the file could not be written to.
+ */
+int closeLedger(Ledger *pLedger);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_LEDGER_H_
@@ -0,0 +1,155 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_OUTCOMES_H_
+#define CCPROG1_OUTCOMES_H_
+
+#include <stdio.h>
+
+#include "compression.h"
+#include "engine.h"
+
+#define OUTCOME_FILE_MAGIC "GOUT"
+#define OUTCOME_FILE_VERSION 1
+
+#define OUTCOME_COLUMN_AMOUNT (6 + CARGO_AMOUNT)
+#define OUTCOME_MAXIMUM_COLUMN_WIDTH 8
+#define OUTCOME_ROW_GROUP_SIZE (1 << 14)
+#define OUTCOME_COLUMN_CHUNK_CAPACITY (OUTCOME_ROW_GROUP_SIZE * OUTCOME_MAXIMUM_COLUMN_WIDTH)
+
+#define UNSIGNED_BYTE_COLUMN_TYPE_ID 'B'
+#define INTEGER_COLUMN_TYPE_ID 'I'
+#define UNSIGNED_LONG_COLUMN_TYPE_ID 'Q'
+
+#define RAW_COLUMN_CODEC_ID 'R'
+#define LZ_COLUMN_CODEC_ID 'L'
+
+/** The result of a single simulated game, which is a row of an outcome file. */
+typedef struct GameOutcome {
+  /** The game's seed, or its index in a price tape. */
+  unsigned long long ullSeed;
+  /** A character that identifies the bot that played the game. */
+  char cStrategyId;
+  int nPlayerBalance;
+  int nPlayerProfit;
+  unsigned char ucPlayerTurns;
+  unsigned char ucUpgradeAmount;
+  /** The amount of every cargo that was bought or sold, in cargo order. */
+  int anCargoVolumes[CARGO_AMOUNT];
+} GameOutcome;
+
+/** A bot whose actions are counted into the outcome of its game, which is used in place of the bot's strategy. */
+typedef struct OutcomeRecorder {
+  GameStrategy fnStrategy;
+  void *pContext;
+  GameOutcome sOutcome;
+} OutcomeRecorder;
+
+/**
+ * A streaming writer of an outcome file. Rows are buffered by column into row groups, and every column of a full row
+ * group is written as a chunk of fixed-width little-endian values, compressed by `compressLzBlock()` if that makes it
+ * smaller.
+ */
+typedef struct OutcomeWriter {
+  FILE *pFile;
+  int bIsCompressing;
+  int nRowGroupSize;
+  long long llRowAmount;
+  /** The number of bytes of column values before compression. */
+  long long llRawSize;
+  /** The number of bytes written to the file. */
+  long long llStoredSize;
+  unsigned char aaucColumns[OUTCOME_COLUMN_AMOUNT][OUTCOME_COLUMN_CHUNK_CAPACITY];
+  unsigned char aucCompressed[LZ_MAXIMUM_COMPRESSED_SIZE(OUTCOME_COLUMN_CHUNK_CAPACITY)];
+} OutcomeWriter;
+
+/** A streaming reader of an outcome file, which reads back one row group at a time. */
+typedef struct OutcomeReader {
+  FILE *pFile;
+  int nRowGroupSize;
+  int nRowPosition;
+  long long llRowAmount;
+  unsigned char aaucColumns[OUTCOME_COLUMN_AMOUNT][OUTCOME_COLUMN_CHUNK_CAPACITY];
+  unsigned char aucCompressed[LZ_MAXIMUM_COMPRESSED_SIZE(OUTCOME_COLUMN_CHUNK_CAPACITY)];
+} OutcomeReader;
+
+/**
+ * Starts counting the outcome of a new game played by a bot.
+ * @param[out] pRecorder The recorder, which must be given to `playSimulatedGame()` with `chooseRecordedAction()`.
+ * @param fnStrategy The bot's strategy.
+ * @param pContext The bot's own parameters and memory.
+ * @param ullSeed The game's seed, or its index in a price tape.
+ * @param cStrategyId A character that identifies the bot.
+ */
+void startGameOutcome(OutcomeRecorder *pRecorder, GameStrategy fnStrategy, void *pContext, unsigned long long ullSeed,
+                      char cStrategyId);
+
+/**
+ * Decides the next action of a recorded bot, counting the action into its game's outcome if it is valid.
+ * @param pGameState The current state of the game.
+ * @param pContext The recorder, which must be an `OutcomeRecorder`.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+void chooseRecordedAction(const GameState *pGameState, void *pContext, GameAction *pGameAction);
+
+/**
+ * Finishes the outcome of a recorded bot's game.
+ * @param[out] pRecorder The recorder.
+ * @param pGameState The state of the game when it ended.
+ */
+void finishGameOutcome(OutcomeRecorder *pRecorder, const GameState *pGameState);
+
+/**
+ * Opens a new outcome file for writing, replacing any file with the same path, and writes the columns' names and
+ * types.
+ * @param[out] pWriter The writer.
+ * @param strFilePath The path of the file.
+ * @param bIsCompressing `1` to compress the columns or `0` to store them as they are.
+ * @returns `1` if the file was opened or `0` if it could not be.
+ */
+int openOutcomeWriter(OutcomeWriter *pWriter, const char *strFilePath, int bIsCompressing);
+
+/**
+ * Adds a row to an outcome file, writing the row group when it is full.
+ * @param[out] pWriter The writer.
+ * @param pGameOutcome The row.
+ * @returns `1` if the row was added or `0` if the file could not be written to.
+ */
+int writeGameOutcome(OutcomeWriter *pWriter, const GameOutcome *pGameOutcome);
+
+/**
+ * Writes the last row group of an outcome file and closes it.
+ * @param[out] pWriter The writer.
+ * @returns `1` if every row was written or `0` if the file could not be written to.
+ */
+int closeOutcomeWriter(OutcomeWriter *pWriter);
+
+/**
+ * Opens an outcome file for reading.
+ * @param[out] pReader The reader.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the file was opened or `0` if it does not exist or does not have the expected columns.
+ */
+int openOutcomeReader(OutcomeReader *pReader, const char *strFilePath);
+
+/**
+ * Reads the next row of an outcome file.
+ * @param[out] pReader The reader.
+ * @param[out] pGameOutcome The row.
+ * @returns `1` if a row was read, `0` if there are no rows left, or `-1` if the file is corrupted.
+ */
+int readGameOutcome(OutcomeReader *pReader, GameOutcome *pGameOutcome);
+
+/**
+ * Closes the file of an outcome reader.
+ * @param[out] pReader The reader.
+ */
+void closeOutcomeReader(OutcomeReader *pReader);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_OUTCOMES_H_
@@ -0,0 +1,60 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_PLANNING_H_
+#define CCPROG1_PLANNING_H_
+
+#define SHIP_UPGRADE_TIER_AMOUNT 3
+
+#define BALANCE_BUCKET_AMOUNT 16
+#define BALANCE_BUCKET_BASE_SIZE 128
+
+/**
+ * Gets the index of the balance bucket that a gold coin balance falls into. Bucket `0` contains balances below `128`,
+ * and every bucket after it doubles the size of the previous one.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @returns An integer value within the range of `0` and `15`.
+ */
+int getBalanceBucket(int nPlayerBalance);
+
+/**
+ * Gets the expected net value of upgrading the ship to its next tier before the game ends. The value is read from a
+ * table, indexed by the ship's tier, the remaining turns, and the balance bucket, which is precomputed from the port
+ * market price ranges on the first call.
+ * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns The expected number of gold coins gained (or lost if negative) by the end of the game from upgrading, or `0`
+ * if the ship is already in the highest tier.
+ */
+int getShipUpgradeValue(int nShipCurrentCargoLimit, int nPlayerBalance, int nPlayerTurns);
+
+/**
+ * Gets the expected number of gold coins that a single cargo space earns from sailing to a port and then planning
+ * every voyage after it optimally until the game ends. The value is read from a Bellman value table, indexed by the
+ * remaining turns and the two ports, which is precomputed from the port market price ranges on the first call.
+ * @param cCurrentPortId The current port's ID.
+ * @pre @p cCurrentPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param cDestinationPortId The ID of the port to sail to.
+ * @pre @p cDestinationPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns The expected number of gold coins earned per cargo space, or `0` if sailing to the port is not allowed.
+ */
+int getRouteValue(char cCurrentPortId, char cDestinationPortId, int nPlayerTurns);
+
+/**
+ * Gets the ID of the port that is expected to earn the most gold coins by the end of the game when sailed to next.
+ * @param cCurrentPortId The current port's ID.
+ * @pre @p cCurrentPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns A character value of `'T'` for Tondo, `'M'` for Manila, `'P'` for Pandakan, or `'S'` for Sapa.
+ */
+char getRecommendedPortId(char cCurrentPortId, int nPlayerTurns);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_PLANNING_H_
@@ -39,32 +39,24 @@
 /**
  * Prompts the player to input their preferred merchant ID.
  * @returns An integer value within the range of `0` and `999`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForPlayerId(void);
 
 /**
  * Prompts the player to input the number of gold coins they want to start with.
  * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForInitialBalance(void);
 
 /**
  * Prompts the player to input their desired profit target.
  * @returns An integer value greater than `20`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForProfitTarget(void);
 
 /**
  * Prompts the player to input a confirmation of their prior decision.
  * @returns `1` if the player confirms or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForConfirmation(void);
 
@@ -123,8 +115,6 @@ char promptForCargoId(char cTransactionType, int nPlayerBalance, int nCoconutMar
  * @param nShipSilkCargoAmount The amount of silk cargo carried by the ship.
  * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
  * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForCargoAmount(char cTransactionType, int nShipCargoLimit, char cCargoId, int nPlayerBalance,
                          int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice,
@@ -135,20 +125,20 @@ int promptForCargoAmount(char cTransactionType, int nShipCargoLimit, char cCargo
  * Prompts the player to input a confirmation on whether they want to upgrade their ship or not.
  * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
  * @param nPlayerBalance The player's gold coin balance.
+ * @param nPlayerTurns The number of turns the player has exhausted.
  * @returns `1` if the player wants to upgrade or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
-int promptForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance);
+int promptForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance, int nPlayerTurns);
 
 /**
  * Prompts the player to input the ID of the port they want to navigate to.
  * @param cCurrentPortId The current port's ID.
  * @pre @p cCurrentPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param nPlayerTurns The number of turns the player has exhausted.
  * @returns A character value of `'T'` for Tondo, `'M'` for Manila, `'P'` for Pandakan, `'S'` for Sapa, or `'X'` for
  * returning to the main menu.
  */
-char promptForPortId(char cCurrentPortId);
+char promptForPortId(char cCurrentPortId, int nPlayerTurns);
 
 // ... Prevent duplicate declarations of this header file's content.
 #endif  // CCPROG1_PROMPTS_H_
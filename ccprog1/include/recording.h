@@ -0,0 +1,75 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_RECORDING_H_
+#define CCPROG1_RECORDING_H_
+
+#include "console.h"
+#include "rendering.h"
+
+#define SESSION_RECORDING_VERSION 2
+
+// The number of output chunks that can wait for the writer thread before the game thread has to wait for space.
+#define SESSION_RECORDING_CAPACITY 16
+
+// The height written to the recording's header when the output is not a terminal.
+#define SESSION_RECORDING_DEFAULT_HEIGHT 40
+
+// How long the writer thread sleeps when there is nothing to write, doubling while the ring stays empty.
+#define SESSION_RECORDING_MINIMUM_IDLE_NANOSECONDS 10000
+#define SESSION_RECORDING_MAXIMUM_IDLE_NANOSECONDS 1000000
+
+// How long the game thread sleeps while waiting for space.
+#define SESSION_RECORDING_WAIT_NANOSECONDS 10000
+
+/** A chunk of the console's output, and when it was printed. */
+typedef struct RecordedChunk {
+  /** The number of seconds since the recording started. */
+  double dSeconds;
+  int nTextSize;
+  char acText[CONSOLE_FRAME_SIZE];
+} RecordedChunk;
+
+/**
+ * Gets the counters of the current or last session recording, which are only exact after it has been stopped.
+ * @param[out] llRecordedAmount The number of output chunks written to the file.
+ * @param[out] llWaitedAmount The number of output chunks that had to wait for space because the ring was full.
+ */
+void getSessionRecordingAmounts(long long *llRecordedAmount, long long *llWaitedAmount);
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+/**
+ * Starts recording everything printed to the console into an asciicast v2 file, replacing any file with the same
+ * path. The game thread only timestamps and copies every output chunk into a ring, which a background thread writes
+ * out from, and only waits for the thread if the ring is full. If the thread cannot be started, the chunks are written
+ * by the game thread instead.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the recording was started or `0` if its file could not be opened or the console already has too
+ * many output chunk handlers.
+ */
+int startSessionRecording(const char *strFilePath);
+
+/**
+ * Writes every recorded output chunk, stops the writer thread, and closes the recording's file.
+ * @returns `1` if every output chunk was written or `0` if the file could not be written to.
+ */
+int stopSessionRecording(void);
+#else
+// Only the ANSI backend hands its printed text over in chunks, so the plain and null backends cannot record. These are
+// functions instead of macros, so that their results can be ignored without a warning.
+static inline int startSessionRecording(const char *strFilePath) {
+  (void)strFilePath;
+
+  return 0;
+}
+
+static inline int stopSessionRecording(void) { return 1; }
+#endif
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_RECORDING_H_
@@ -0,0 +1,38 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_RENDERING_H_
+#define CCPROG1_RENDERING_H_
+
+#include <stdio.h>
+
+// The backends that the game's screens, prompts, and colors can be rendered with, which are picked at compile time.
+#define ANSI_RENDER_BACKEND 1
+#define PLAIN_RENDER_BACKEND 2
+#define NULL_RENDER_BACKEND 3
+
+// Render the art and prompts in color unless another backend is given with -DRENDER_BACKEND.
+#ifndef RENDER_BACKEND
+#define RENDER_BACKEND ANSI_RENDER_BACKEND
+#endif
+
+/**
+ * Prints out the text of a screen or prompt to the console. The ANSI backend prints it through `printConsoleText()`
+ * from `console.h` to apply color changes. The null backend compiles the text away entirely, while its arguments are
+ * still checked by the compiler inside an unevaluated `sizeof`.
+ */
+#if RENDER_BACKEND == NULL_RENDER_BACKEND
+#define printRenderedText(...) ((void)sizeof(printf(__VA_ARGS__)))
+#elif RENDER_BACKEND == ANSI_RENDER_BACKEND
+#define printRenderedText(...) printConsoleText(__VA_ARGS__)
+#else
+#define printRenderedText(...) printf(__VA_ARGS__)
+#endif
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_RENDERING_H_
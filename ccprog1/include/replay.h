@@ -0,0 +1,54 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_REPLAY_H_
+#define CCPROG1_REPLAY_H_
+
+#include "engine.h"
+#include "events.h"
+#include "simulation.h"
+
+#define MARKET_DIVERGENCE_ID 'M'
+#define ACTION_DIVERGENCE_ID 'A'
+#define BALANCE_DIVERGENCE_ID 'B'
+#define STATE_DIVERGENCE_ID 'H'
+#define TAPE_DIVERGENCE_ID 'T'
+
+/** What happened while replaying an event log, including where the replay first diverged from the recording. */
+typedef struct ReplayResult {
+  long long llGameAmount;
+  long long llEventAmount;
+  long long llTurnAmount;
+  /** `0` if the replay matched the recording, `'M'` if the market prices differ, `'A'` if an action is no longer
+   * allowed, `'B'` if the final balance differs, `'H'` if the state at the end of a turn differs, or `'T'` if the
+   * game's price tape is missing or too short. */
+  char cDivergenceId;
+  /** The index of the game that diverged, counting from `0`. */
+  long long llDivergentGameIndex;
+  /** The recorded event that the replay diverged at. */
+  GameEvent sDivergentEvent;
+  /** The replayed state of the game when it diverged. */
+  GameState sDivergentGameState;
+  /** The replayed rolling state hash when it diverged. */
+  unsigned int unDivergentStateHash;
+} ReplayResult;
+
+/**
+ * Replays every game in an event log with the engine, stopping at the first divergence. Every game is started from its
+ * recorded seed, the market prices are generated again and compared with the recorded ones, every recorded trade,
+ * upgrade, and voyage is applied again, and the state at the end of every turn is checked against the recorded rolling
+ * state hash. Nothing is printed.
+ * @param[out] pReader The reader of the event log, which must not have read any events yet.
+ * @param pPriceTape The price tape that the games were simulated with, or `NULL` if none of them were.
+ * @param[out] pResult What happened while replaying.
+ * @returns `1` if every event was replayed or a divergence was found, or `0` if the log is corrupted.
+ */
+int replayEventLog(EventLogReader *pReader, const PriceTape *pPriceTape, ReplayResult *pResult);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_REPLAY_H_
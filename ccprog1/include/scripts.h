@@ -0,0 +1,121 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_SCRIPTS_H_
+#define CCPROG1_SCRIPTS_H_
+
+#include "engine.h"
+
+#define SCRIPT_MAXIMUM_INSTRUCTION_AMOUNT 256
+#define SCRIPT_MAXIMUM_LOOP_DEPTH 8
+#define SCRIPT_TOKEN_SIZE 32
+#define SCRIPT_MAXIMUM_SOURCE_SIZE 65536
+// The largest amount or turn that a script can have, which keeps the balance changes from overflowing.
+#define SCRIPT_MAXIMUM_OPERAND 1000000
+
+// The amount of a buy or sell instruction that trades as much cargo as possible.
+#define SCRIPT_MAXIMUM_AMOUNT -1
+// The port of a sail instruction that sails to the recommended port from `planning.h`.
+#define RECOMMENDED_PORT_ID 'R'
+
+#define BUY_INSTRUCTION_ID 'B'
+#define SELL_INSTRUCTION_ID 'S'
+#define SELL_ALL_INSTRUCTION_ID 'A'
+#define SAIL_INSTRUCTION_ID 'N'
+#define UPGRADE_INSTRUCTION_ID 'U'
+#define LOOP_INSTRUCTION_ID 'L'
+#define JUMP_INSTRUCTION_ID 'J'
+#define QUIT_INSTRUCTION_ID 'Q'
+
+/** A single compiled command of a script. */
+typedef struct ScriptInstruction {
+  /**
+   * `'B'` for buying, `'S'` for selling, `'A'` for selling all cargo, `'N'` for sailing, `'U'` for upgrading if
+   * affordable, `'L'` for leaving a loop once its turn is reached, `'J'` for jumping back to a loop's start, or `'Q'`
+   * for quitting.
+   */
+  char cInstructionId;
+  /** The ID of the traded cargo, or the ID of the port to sail to. */
+  char cTargetId;
+  /** The amount of cargo to trade, or the turn that a loop repeats until. */
+  int nOperand;
+  /** The index of the instruction to jump to. */
+  int nJumpIndex;
+} ScriptInstruction;
+
+/** A script compiled into a flat list of instructions, which is executed without parsing it again. */
+typedef struct Script {
+  ScriptInstruction aInstructions[SCRIPT_MAXIMUM_INSTRUCTION_AMOUNT];
+  int nInstructionAmount;
+} Script;
+
+/** The state of a script that is playing a game, which is used as the context of `chooseScriptAction()`. */
+typedef struct ScriptRunner {
+  const Script *pScript;
+  /** The index of the next instruction to execute. */
+  int nInstructionIndex;
+  /** The index of the next cargo to check while selling all cargo. */
+  int nSellAllCargoIndex;
+  /** The total number of actions that the script has done. */
+  long long llActionAmount;
+  /** The total number of actions that the game's rules have rejected. */
+  long long llRejectedActionAmount;
+} ScriptRunner;
+
+/**
+ * Compiles the source of a script, which has one command on every line:
+ * - `buy <cargo> <amount | max>` and `sell <cargo> <amount | max>` trade a cargo, where the cargo is `coconut`, `rice`,
+ *   `silk`, or `gun`;
+ * - `sell-all` sells every cargo on the ship;
+ * - `sail-to <port>` ends the turn in `tondo`, `manila`, `pandakan`, `sapa`, or the `recommended` port;
+ * - `upgrade-if-affordable` upgrades the ship if the player can afford it;
+ * - `repeat-until-turn <turn>` repeats the commands up to its `end` until the given turn is reached; and
+ * - `quit` ends the game.
+ * Blank lines and everything after a `#` are ignored. The game is quit once the script runs out of commands.
+ * @param strSource The source of the script.
+ * @param[out] pScript The compiled script.
+ * @param[out] pnErrorLineNumber The number of the first line that could not be compiled, counting from `1`.
+ * @returns `1` if the script was compiled or `0` if it has an error.
+ */
+int compileScript(const char *strSource, Script *pScript, int *pnErrorLineNumber);
+
+/**
+ * Reads a script file and compiles its source.
+ * @param strFilePath The path of the file to read.
+ * @param[out] pScript The compiled script.
+ * @param[out] pnErrorLineNumber The number of the first line that could not be compiled, or `0` if the file could not
+ * be read or is larger than `SCRIPT_MAXIMUM_SOURCE_SIZE`.
+ * @returns `1` if the script was compiled or `0` if it could not be read or has an error.
+ */
+int compileScriptFile(const char *strFilePath, Script *pScript, int *pnErrorLineNumber);
+
+/**
+ * Sets up a script runner before its first game.
+ * @param[out] pRunner The script runner.
+ * @param pScript The compiled script to run.
+ */
+void initializeScriptRunner(ScriptRunner *pRunner, const Script *pScript);
+
+/**
+ * Starts a script from its first instruction for a new game, keeping the runner's totals.
+ * @param[out] pRunner The script runner.
+ */
+void restartScriptRunner(ScriptRunner *pRunner);
+
+/**
+ * Decides the next action of a script by executing its instructions until one of them does an action. Trades of `max`
+ * cargo that amount to nothing and unaffordable upgrades are skipped, while every other action is done and checked
+ * against the same rules that the game's prompts enforce, counting the rejected ones.
+ * @param pGameState The current state of the game.
+ * @param pContext The script runner, which must be a `ScriptRunner`.
+ * @param[out] pGameAction The action that the script wants to do.
+ */
+void chooseScriptAction(const GameState *pGameState, void *pContext, GameAction *pGameAction);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_SCRIPTS_H_
@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_SHARED_MARKET_H_
+#define CCPROG1_SHARED_MARKET_H_
+
+#include "trading.h"
+
+#define SHARED_MARKET_MAGIC "SMKT"
+#define SHARED_MARKET_VERSION 2
+
+// Shared markets are named `/ccprog1-market-<name>` in the shared memory namespace.
+#define SHARED_MARKET_NAME_PREFIX "/ccprog1-market-"
+#define SHARED_MARKET_MAXIMUM_NAME_SIZE 64
+
+// The amount of every cargo that a port has in stock when it is first opened.
+#define SHARED_MARKET_INITIAL_STOCK 400
+
+// Trading this amount of a cargo moves its price across the port's whole price range.
+#define SHARED_MARKET_DEPTH 600
+
+// The number of times a port's market is read before giving up on a merchant that keeps changing it.
+#define SHARED_MARKET_MAXIMUM_READ_ATTEMPTS 1000
+
+// Keeps the ports, which are written by different merchants, on separate cache lines.
+#define SHARED_MARKET_CACHE_LINE_SIZE 64
+
+/** The market of a port, which every merchant's process reads and writes in place. */
+typedef struct SharedPortMarket {
+  /** Odd while a merchant is changing the market, which readers retry on. */
+  unsigned long long ullSequence;
+  /** The process ID of the merchant that is changing the market, which keeps every other merchant from changing it. */
+  int nOwnerId;
+  /** Whether a merchant has sailed into the port yet, which sets its opening prices. */
+  int bIsOpened;
+  int anMarketPrices[CARGO_AMOUNT];
+  int anStockAmounts[CARGO_AMOUNT];
+  char acPadding[SHARED_MARKET_CACHE_LINE_SIZE];
+} SharedPortMarket;
+
+/**
+ * The shared memory of a market that several games on the same machine trade in. Every port has its own sequence lock,
+ * so the screens read the prices without ever blocking, and only retry if they overlap a trade in the same port.
+ */
+typedef struct SharedMarket {
+  char acMagic[4];
+  int nVersion;
+  SharedPortMarket asPorts[PORT_AMOUNT];
+} SharedMarket;
+
+/**
+ * Attaches to a shared market, creating it if no game has created it yet.
+ * @param strName The name of the market.
+ * @pre @p strName must be at most 64 characters long and must not contain `'/'`.
+ * @returns The market, or `NULL` if its shared memory could not be created or is not a shared market.
+ */
+SharedMarket *attachSharedMarket(const char *strName);
+
+/**
+ * Opens a port's market with the prices that a merchant generated when they sailed into it, unless another merchant
+ * already opened it.
+ * @param[out] pMarket The market.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param[in,out] anMarketPrices The generated prices in cargo order, which are replaced by the port's prices.
+ * @returns `1` if the port's prices were read or `0` if the generated prices were kept because the port's market could
+ * not be read.
+ */
+int openSharedMarketPort(SharedMarket *pMarket, char cPortId, int anMarketPrices[CARGO_AMOUNT]);
+
+/**
+ * Reads a port's prices and stock without taking any lock. They are always from the same moment, even while another
+ * merchant is trading in the port.
+ * @param pMarket The market.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param[out] anMarketPrices The prices in cargo order, which are left as they were if the port could not be read.
+ * @param[out] anStockAmounts The amounts in stock in cargo order, which are left as they were if the port could not
+ * be read.
+ * @returns `1` if the port was read or `0` if it was being changed on every attempt.
+ */
+int readSharedMarketPort(const SharedMarket *pMarket, char cPortId, int anMarketPrices[CARGO_AMOUNT],
+                         int anStockAmounts[CARGO_AMOUNT]);
+
+/**
+ * Trades cargo with a port's stock as a single change, which buying moves the price up and selling moves down.
+ * @param[out] pMarket The market.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param cTransactionType The type of transaction made.
+ * @pre @p cTransactionType must have a character value of either `'B'` or `'S'`.
+ * @param cCargoId The ID of the cargo to trade.
+ * @pre @p cCargoId must have a character value of `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @param nCargoAmount The amount of cargo to trade.
+ * @param nCargoPrice The price that the merchant agreed to.
+ * @returns `1` if the trade was made or `0` if the price is no longer the agreed one or there is not enough stock.
+ */
+int tradeSharedMarketCargo(SharedMarket *pMarket, char cPortId, char cTransactionType, char cCargoId, int nCargoAmount,
+                           int nCargoPrice);
+
+/**
+ * Detaches from a shared market, which stays in memory for the other games.
+ * @param[out] pMarket The market.
+ */
+void detachSharedMarket(SharedMarket *pMarket);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_SHARED_MARKET_H_
@@ -0,0 +1,147 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_SIMULATION_H_
+#define CCPROG1_SIMULATION_H_
+
+#include <stddef.h>
+
+#include "engine.h"
+#include "events.h"
+#include "ledger.h"
+#include "sketches.h"
+
+#define SIMULATED_INITIAL_BALANCE 1000
+
+#define PRICE_TAPE_MAGIC "TAPE"
+#define PRICE_TAPE_VERSION 1
+
+// Ends a simulated game whose bot keeps choosing invalid actions.
+#define SIMULATED_GAME_MAXIMUM_ACTION_AMOUNT (MAXIMUM_PLAYER_TURNS * 64)
+
+// Every port's market prices for every turn of a single game.
+#define PRICE_TAPE_GAME_PRICE_AMOUNT (MAXIMUM_PLAYER_TURNS * PORT_AMOUNT * CARGO_AMOUNT)
+
+/** The fixed-size header at the start of a price tape file. */
+typedef struct PriceTapeHeader {
+  char acMagic[4];
+  unsigned int unVersion;
+  unsigned int unGameAmount;
+  unsigned int unPriceAmount;
+  unsigned long long ullFirstSeed;
+} PriceTapeHeader;
+
+/**
+ * A memory-mapped file of pregenerated market prices, which lets different strategies play the exact same markets
+ * without generating random numbers. The prices of every game are stored as unsigned 16-bit integers, ordered by turn,
+ * then port, then cargo, in the byte order of the machine that wrote them.
+ */
+typedef struct PriceTape {
+  int nGameAmount;
+  unsigned long long ullFirstSeed;
+  const unsigned short *aunPrices;
+  void *pMapping;
+  size_t ulMappingSize;
+} PriceTape;
+
+/**
+ * The distribution of the profits of many simulated games, which takes the same memory for any number of games and can
+ * be merged with the summaries of other threads.
+ */
+typedef struct SimulationSummary {
+  int nPlayerProfitTarget;
+  long long llGameAmount;
+  long long llTargetReachedGameAmount;
+  double dProfitSum;
+  /** The profits, in gold coins, of every game. */
+  QuantileSketch sProfitSketch;
+  Histogram sProfitHistogram;
+} SimulationSummary;
+
+/**
+ * Generates the market prices of every port for every turn of a game from its seed, which are the same prices that a
+ * simulated game without a price tape generates.
+ * @param ullSeed The game's seed.
+ * @param[out] aunPrices The prices, ordered by turn, then port, then cargo.
+ */
+void generatePriceTapeGame(unsigned long long ullSeed, unsigned short aunPrices[PRICE_TAPE_GAME_PRICE_AMOUNT]);
+
+/**
+ * Writes a price tape file with the prices of consecutive seeds.
+ * @param strFilePath The path of the file to write.
+ * @param nGameAmount The number of games, one for every seed.
+ * @pre @p nGameAmount must have a positive integer value.
+ * @param ullFirstSeed The seed of the first game.
+ * @returns `1` if the file was written or `0` if it could not be.
+ */
+int writePriceTape(const char *strFilePath, int nGameAmount, unsigned long long ullFirstSeed);
+
+/**
+ * Opens a price tape file by mapping it into memory.
+ * @param strFilePath The path of the file to open.
+ * @param[out] pPriceTape The opened price tape.
+ * @returns `1` if the file was opened or `0` if it does not exist or is not a valid price tape.
+ */
+int openPriceTape(const char *strFilePath, PriceTape *pPriceTape);
+
+/**
+ * Closes a price tape by unmapping its file from memory.
+ * @param[out] pPriceTape The price tape.
+ */
+void closePriceTape(PriceTape *pPriceTape);
+
+/**
+ * Reads the market prices of a port during a turn of a game from a price tape.
+ * @param pPriceTape The price tape.
+ * @param nGameIndex The index of the game in the price tape.
+ * @pre @p nGameIndex must have an integer value within the range of `0` and the number of games minus `1`.
+ * @param[out] pGameState The state of the game, whose port, turns, and market prices are used.
+ */
+void readPriceTapeMarketPrices(const PriceTape *pPriceTape, int nGameIndex, GameState *pGameState);
+
+/**
+ * Plays a whole game with a bot without printing anything to the console. The market prices are read from a price tape
+ * if one is given, or else generated from the game's seed.
+ * @param fnStrategy The bot's strategy.
+ * @param pContext The bot's own parameters and memory.
+ * @param nPlayerInitialBalance The number of gold coins the player starts with.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @param ullSeed The game's seed, which is the index of the game in the price tape if one is given.
+ * @param[out] pLedger The ledger to record the game's events in, or `NULL` to not record them.
+ * @param[out] pGameState The state of the game when it ended.
+ * @returns The number of actions that the bot did, including the invalid ones that were ignored.
+ * @post The game is ended by quitting if the bot does `SIMULATED_GAME_MAXIMUM_ACTION_AMOUNT` actions.
+ */
+int playSimulatedGame(GameStrategy fnStrategy, void *pContext, int nPlayerInitialBalance, const PriceTape *pPriceTape,
+                      unsigned long long ullSeed, Ledger *pLedger, GameState *pGameState);
+
+/**
+ * Sets up an empty simulation summary.
+ * @param[out] pSummary The summary.
+ * @param nPlayerProfitTarget The player's target profit percentage, which is used the same way as in the game.
+ * @param ullSeed The seed of the random choices made by the summary's quantile sketch.
+ */
+void initializeSimulationSummary(SimulationSummary *pSummary, int nPlayerProfitTarget, unsigned long long ullSeed);
+
+/**
+ * Adds the profit of a finished game to a simulation summary.
+ * @param[out] pSummary The summary.
+ * @param pGameState The state of the game when it ended.
+ */
+void addSimulationSummaryGame(SimulationSummary *pSummary, const GameState *pGameState);
+
+/**
+ * Merges a simulation summary into another, which is used to combine the summaries of different threads.
+ * @param[out] pSummary The summary to merge into.
+ * @param pOtherSummary The summary to merge from, which is left unchanged.
+ * @pre Both summaries must have the same target profit percentage.
+ */
+void mergeSimulationSummaries(SimulationSummary *pSummary, const SimulationSummary *pOtherSummary);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_SIMULATION_H_
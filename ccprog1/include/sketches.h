@@ -0,0 +1,112 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_SKETCHES_H_
+#define CCPROG1_SKETCHES_H_
+
+#define QUANTILE_SKETCH_LEVEL_AMOUNT 32
+#define QUANTILE_SKETCH_LEVEL_CAPACITY 256
+
+#define HISTOGRAM_OCTAVE_AMOUNT 48
+#define HISTOGRAM_OCTAVE_BIN_AMOUNT 16
+
+// The bins of the negative values, the bin of the values between `-1` and `1`, and the bins of the positive values.
+#define HISTOGRAM_BIN_AMOUNT (2 * HISTOGRAM_OCTAVE_AMOUNT * HISTOGRAM_OCTAVE_BIN_AMOUNT + 1)
+
+/**
+ * A KLL-style quantile sketch, which summarizes any number of values in constant memory. Values are added to the
+ * lowest level, and whenever a level is full, it is sorted and every other value, starting from a random one, is
+ * promoted to the next level with twice the weight. Two sketches are merged by adding the values of one sketch's
+ * levels into the other's.
+ */
+typedef struct QuantileSketch {
+  double aadLevels[QUANTILE_SKETCH_LEVEL_AMOUNT][QUANTILE_SKETCH_LEVEL_CAPACITY];
+  int anLevelSizes[QUANTILE_SKETCH_LEVEL_AMOUNT];
+  long long llValueAmount;
+  double dMinimumValue;
+  double dMaximumValue;
+  unsigned long long ullRandomState;
+} QuantileSketch;
+
+/**
+ * A histogram with logarithmic bins, which covers any range of values in constant memory. Every power of two is split
+ * into `HISTOGRAM_OCTAVE_BIN_AMOUNT` bins for both positive and negative values.
+ */
+typedef struct Histogram {
+  long long allBinCounts[HISTOGRAM_BIN_AMOUNT];
+  long long llValueAmount;
+} Histogram;
+
+/**
+ * Sets up an empty quantile sketch.
+ * @param[out] pSketch The sketch.
+ * @param ullSeed The seed of the random choices made when levels are compacted.
+ */
+void initializeQuantileSketch(QuantileSketch *pSketch, unsigned long long ullSeed);
+
+/**
+ * Adds a value to a quantile sketch.
+ * @param[out] pSketch The sketch.
+ * @param dValue The value.
+ */
+void addQuantileSketchValue(QuantileSketch *pSketch, double dValue);
+
+/**
+ * Merges the values of a quantile sketch into another, which is used to combine the sketches of different threads.
+ * @param[out] pSketch The sketch to merge into.
+ * @param pOtherSketch The sketch to merge from, which is left unchanged.
+ */
+void mergeQuantileSketches(QuantileSketch *pSketch, const QuantileSketch *pOtherSketch);
+
+/**
+ * Estimates the value at a quantile of every value added to a quantile sketch.
+ * @param pSketch The sketch.
+ * @param dQuantile The quantile, where `0.5` is the median.
+ * @pre @p dQuantile must have a value within the range of `0` and `1`.
+ * @returns The estimated value, or `0` if the sketch is empty.
+ */
+double getQuantileSketchValue(const QuantileSketch *pSketch, double dQuantile);
+
+/**
+ * Sets up an empty histogram.
+ * @param[out] pHistogram The histogram.
+ */
+void initializeHistogram(Histogram *pHistogram);
+
+/**
+ * Gets the index of the bin that a value falls into.
+ * @param dValue The value.
+ * @returns An integer value within the range of `0` and `HISTOGRAM_BIN_AMOUNT - 1`, which increases with the value.
+ */
+int getHistogramBinIndex(double dValue);
+
+/**
+ * Gets the bound of a bin that is nearest to zero.
+ * @param nBinIndex The index of the bin.
+ * @pre @p nBinIndex must have an integer value within the range of `0` and `HISTOGRAM_BIN_AMOUNT - 1`.
+ * @returns The bound, which has the same sign as the bin's values, or `0` for the bin of the values between `-1` and
+ * `1`.
+ */
+double getHistogramBinBound(int nBinIndex);
+
+/**
+ * Adds a value to a histogram.
+ * @param[out] pHistogram The histogram.
+ * @param dValue The value.
+ */
+void addHistogramValue(Histogram *pHistogram, double dValue);
+
+/**
+ * Merges the counts of a histogram into another, which is used to combine the histograms of different threads.
+ * @param[out] pHistogram The histogram to merge into.
+ * @param pOtherHistogram The histogram to merge from, which is left unchanged.
+ */
+void mergeHistograms(Histogram *pHistogram, const Histogram *pOtherHistogram);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_SKETCHES_H_
@@ -0,0 +1,107 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_SPECTATORS_H_
+#define CCPROG1_SPECTATORS_H_
+
+#include "console.h"
+#include "rendering.h"
+
+#define SPECTATOR_RING_MAGIC "SPEC"
+#define SPECTATOR_RING_VERSION 2
+
+// Broadcasts are named `/ccprog1-broadcast-<name>` in the shared memory namespace.
+#define SPECTATOR_NAME_PREFIX "/ccprog1-broadcast-"
+#define SPECTATOR_MAXIMUM_NAME_SIZE 64
+
+#define SPECTATOR_FRAME_AMOUNT 16
+#define SPECTATOR_FRAME_SIZE CONSOLE_FRAME_SIZE
+
+// How long a spectator view sleeps between checks for new frames.
+#define SPECTATOR_POLL_NANOSECONDS 10000000L
+
+/** A chunk of the player's console output, which is rewritten in place once the ring wraps around. */
+typedef struct SpectatorFrame {
+  /** `2n + 1` while the `n`th frame is being written, or `2n + 2` once it has been written. */
+  unsigned long long ullSequence;
+  int nTextSize;
+  char acText[SPECTATOR_FRAME_SIZE];
+} SpectatorFrame;
+
+/**
+ * The shared memory of a broadcast, which only the player's process writes to. Every frame has its own sequence lock,
+ * so spectators copy frames without ever blocking the player, and retry or skip ahead if a frame was rewritten while
+ * they copied it.
+ */
+typedef struct SpectatorRing {
+  char acMagic[4];
+  int nVersion;
+  /** The process ID of the player's game, which spectators check to notice a game that was killed. */
+  int nPlayerId;
+  /** Whether the game has ended, after which no more frames are written. */
+  int bIsOver;
+  /** The number of frames written since the broadcast started. */
+  unsigned long long ullFrameAmount;
+  SpectatorFrame asFrames[SPECTATOR_FRAME_AMOUNT];
+} SpectatorRing;
+
+/** A spectator's read-only view of a broadcast. */
+typedef struct SpectatorView {
+  const SpectatorRing *pRing;
+  /** The number of the next frame to read. */
+  unsigned long long ullNextFrame;
+  /** The number of frames that were rewritten before they could be read. */
+  long long llSkippedAmount;
+} SpectatorView;
+
+/**
+ * Attaches to a broadcast as a spectator, without the player's process ever knowing about it. The view starts at the
+ * oldest frame that is still in the ring, so that the current screen can be drawn right away.
+ * @param[out] pView The view.
+ * @param strName The name of the broadcast.
+ * @returns `1` if the broadcast was found or `0` if it was not.
+ */
+int attachSpectatorView(SpectatorView *pView, const char *strName);
+
+/**
+ * Reads the next frame of a broadcast, skipping ahead to the oldest frame still in the ring if the view fell behind.
+ * @param[out] pView The view.
+ * @param[out] acText The frame's text, which is not null-terminated.
+ * @param[out] nTextSize The number of characters in the frame's text.
+ * @returns `1` if a frame was read, `0` if there is no new frame yet, or `-1` if the game has ended, or its process was
+ * killed, and every frame has been read.
+ */
+int readSpectatorFrame(SpectatorView *pView, char acText[SPECTATOR_FRAME_SIZE], int *nTextSize);
+
+/**
+ * Detaches from a broadcast.
+ * @param[out] pView The view.
+ */
+void detachSpectatorView(SpectatorView *pView);
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+/**
+ * Starts broadcasting everything printed to the console to spectators, one frame before every input wait. Writing a
+ * frame is the broadcast's only cost to the game, no matter how many spectators attach.
+ * @param strName The name of the broadcast, which spectators attach with.
+ * @pre @p strName must be at most 64 characters long and must not contain `'/'`.
+ * @returns `1` if the broadcast was started or `0` if another game is broadcasting with the same name, its shared
+ * memory could not be created, or the console already has too many output chunk handlers.
+ */
+int startSpectatorBroadcast(const char *strName);
+
+/** Writes the last frame, tells the spectators that the game has ended, and removes the broadcast's name. */
+void stopSpectatorBroadcast(void);
+#else
+// Only the ANSI backend hands its printed text over in chunks, so the plain and null backends cannot broadcast.
+#define startSpectatorBroadcast(strName) ((void)(strName), 0)
+#define stopSpectatorBroadcast() ((void)0)
+#endif
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_SPECTATORS_H_
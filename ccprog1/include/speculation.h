@@ -0,0 +1,188 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_SPECULATION_H_
+#define CCPROG1_SPECULATION_H_
+
+#include "rendering.h"
+
+#define SPECULATIVE_FRAME_AMOUNT 8
+#define SPECULATIVE_SCREEN_MAXIMUM_ARGUMENT_AMOUNT 16
+
+#define MAIN_SCREEN_ID 'M'
+#define TRANSACTION_SCREEN_ID 'T'
+#define UPGRADE_SCREEN_ID 'U'
+#define NAVIGATION_SCREEN_ID 'N'
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+/**
+ * Starts a helper thread that renders the requested screens into frames while the game waits for the player's input,
+ * so that the screen that the input leads to can be printed out in a single write instead of being rendered after it.
+ * @returns `1` if the helper thread was started or `0` if the screens are always rendered when printed.
+ */
+int startSpeculativeRendering(void);
+
+/** Stops the helper thread, which forgets every rendered frame when started again. */
+void stopSpeculativeRendering(void);
+
+/**
+ * Asks for a screen to be rendered during the next input wait, because it is likely to be printed after the input.
+ * The frames of the least recently requested screens are reused once every frame is taken. Each screen's own request
+ * function below passes the arguments, so that their number always matches the screen.
+ * @param cScreenId `'M'` for the main screen, `'T'` for the transaction screen, `'U'` for the ship upgrade screen, or
+ * `'N'` for the navigation screen.
+ * @param nArgumentAmount The number of arguments that the screen's print function takes.
+ * @pre @p nArgumentAmount must have an integer value within the range of `1` and `16`.
+ * @param anArguments The arguments of the screen's print function, in the same order.
+ */
+void requestSpeculativeScreen(char cScreenId, int nArgumentAmount, const int anArguments[]);
+
+/**
+ * Prints out a screen from its frame if it was requested and has already been rendered for the console's current
+ * width and colors, which is checked by every screen's print function before rendering it. Each screen's own print
+ * function below passes the arguments, so that their number always matches the screen.
+ * @param cScreenId `'M'` for the main screen, `'T'` for the transaction screen, `'U'` for the ship upgrade screen, or
+ * `'N'` for the navigation screen.
+ * @param nArgumentAmount The number of arguments that the screen's print function takes.
+ * @pre @p nArgumentAmount must have an integer value within the range of `1` and `16`.
+ * @param anArguments The arguments of the screen's print function, in the same order.
+ * @returns `1` if the screen was printed out or `0` if it still has to be rendered.
+ */
+int printSpeculativeScreen(char cScreenId, int nArgumentAmount, const int anArguments[]);
+
+/**
+ * Blocks until every requested screen has been rendered, as if the player took their time to input.
+ * @pre The helper thread must have been started.
+ */
+void waitForSpeculativeScreens(void);
+
+/**
+ * Gets the number of screens that were rendered ahead of time and the number of them that were printed out.
+ * @param[out] llRenderedAmount The number of screens rendered by the helper thread.
+ * @param[out] llPrintedAmount The number of screens printed out from their frames.
+ */
+void getSpeculativeScreenAmounts(long long *llRenderedAmount, long long *llPrintedAmount);
+#else
+// Always render the screens when printed in the plain and null backends, which do not print through frames. These are
+// functions that do nothing instead of macros, so that their arguments are still used.
+static inline int startSpeculativeRendering(void) { return 0; }
+
+static inline void stopSpeculativeRendering(void) {}
+
+static inline void requestSpeculativeScreen(char cScreenId, int nArgumentAmount, const int anArguments[]) {
+  (void)cScreenId;
+  (void)nArgumentAmount;
+  (void)anArguments;
+}
+
+static inline int printSpeculativeScreen(char cScreenId, int nArgumentAmount, const int anArguments[]) {
+  (void)cScreenId;
+  (void)nArgumentAmount;
+  (void)anArguments;
+
+  return 0;
+}
+#endif
+
+// Count a screen's arguments instead of spelling the number out, so that it cannot drift from the screen.
+#define SPECULATIVE_ARGUMENT_AMOUNT(anArguments) ((int)(sizeof(anArguments) / sizeof((anArguments)[0])))
+
+/** Asks for the main screen to be rendered ahead of time, with the same arguments as `printMainScreen()`. */
+static inline void requestSpeculativeMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerBalance,
+                                                int nPlayerProfit, int nPlayerProfitTarget, int nShipTotalCargoAmount,
+                                                int nShipCargoLimit, int nShipCoconutCargoAmount,
+                                                int nShipRiceCargoAmount, int nShipSilkCargoAmount,
+                                                int nShipGunCargoAmount, int nCoconutMarketPrice, int nRiceMarketPrice,
+                                                int nSilkMarketPrice, int nGunMarketPrice) {
+  const int anArguments[] = {nPlayerTurns, cPortId, nPlayerId, nPlayerBalance, nPlayerProfit, nPlayerProfitTarget,
+                             nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount, nShipRiceCargoAmount,
+                             nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice,
+                             nSilkMarketPrice, nGunMarketPrice};
+
+  requestSpeculativeScreen(MAIN_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Prints out the main screen from its frame, with the same arguments as `printMainScreen()`.
+ * @returns `1` if the screen was printed out or `0` if it still has to be rendered.
+ */
+static inline int printSpeculativeMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerBalance,
+                                             int nPlayerProfit, int nPlayerProfitTarget, int nShipTotalCargoAmount,
+                                             int nShipCargoLimit, int nShipCoconutCargoAmount, int nShipRiceCargoAmount,
+                                             int nShipSilkCargoAmount, int nShipGunCargoAmount,
+                                             int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice,
+                                             int nGunMarketPrice) {
+  const int anArguments[] = {nPlayerTurns, cPortId, nPlayerId, nPlayerBalance, nPlayerProfit, nPlayerProfitTarget,
+                             nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount, nShipRiceCargoAmount,
+                             nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice,
+                             nSilkMarketPrice, nGunMarketPrice};
+
+  return printSpeculativeScreen(MAIN_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Asks for the transaction screen to be rendered ahead of time, with the same arguments as `printTransactionScreen()`.
+ */
+static inline void requestSpeculativeTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmount,
+                                                       int nCargoPrice) {
+  const int anArguments[] = {cTransactionType, cCargoId, nCargoAmount, nCargoPrice};
+
+  requestSpeculativeScreen(TRANSACTION_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Prints out the transaction screen from its frame, with the same arguments as `printTransactionScreen()`.
+ * @returns `1` if the screen was printed out or `0` if it still has to be rendered.
+ */
+static inline int printSpeculativeTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmount,
+                                                    int nCargoPrice) {
+  const int anArguments[] = {cTransactionType, cCargoId, nCargoAmount, nCargoPrice};
+
+  return printSpeculativeScreen(TRANSACTION_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Asks for the ship upgrade screen to be rendered ahead of time, with the same arguments as `printShipUpgradeScreen()`.
+ */
+static inline void requestSpeculativeShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost) {
+  const int anArguments[] = {nShipCargoLimitIncrease, nShipUpgradeCost};
+
+  requestSpeculativeScreen(UPGRADE_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Prints out the ship upgrade screen from its frame, with the same arguments as `printShipUpgradeScreen()`.
+ * @returns `1` if the screen was printed out or `0` if it still has to be rendered.
+ */
+static inline int printSpeculativeShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost) {
+  const int anArguments[] = {nShipCargoLimitIncrease, nShipUpgradeCost};
+
+  return printSpeculativeScreen(UPGRADE_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Asks for the navigation screen to be rendered ahead of time, with the same arguments as `printNavigationScreen()`.
+ */
+static inline void requestSpeculativeNavigationScreen(char cPortId, int nPlayerTurns) {
+  const int anArguments[] = {cPortId, nPlayerTurns};
+
+  requestSpeculativeScreen(NAVIGATION_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+/**
+ * Prints out the navigation screen from its frame, with the same arguments as `printNavigationScreen()`.
+ * @returns `1` if the screen was printed out or `0` if it still has to be rendered.
+ */
+static inline int printSpeculativeNavigationScreen(char cPortId, int nPlayerTurns) {
+  const int anArguments[] = {cPortId, nPlayerTurns};
+
+  return printSpeculativeScreen(NAVIGATION_SCREEN_ID, SPECULATIVE_ARGUMENT_AMOUNT(anArguments), anArguments);
+}
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_SPECULATION_H_
@@ -9,7 +9,18 @@
 #ifndef CCPROG1_TEXT_GRAPHICS_H_
 #define CCPROG1_TEXT_GRAPHICS_H_
 
-#define MAX_PRINT_WIDTH 156
+#include <stdio.h>
+
+#define ART_SCREEN_FORMAT_ID 'A'
+#define JSONL_SCREEN_FORMAT_ID 'J'
+
+/**
+ * Sets how the game's screens are printed out. The art screens are printed to the console, while the JSON lines screens
+ * are each printed as a single compact JSON object of the screen's state, so that tools do not have to scrape the art.
+ * @param cFormatId `'A'` for the art screens or `'J'` for the JSON lines screens.
+ * @param pStream The stream to print the JSON lines screens to.
+ */
+void setScreenFormat(char cFormatId, FILE *pStream);
 
 /** Prints out a pre-formatted separator line to the console. */
 void printSeparator(void);
@@ -65,6 +76,16 @@ void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmou
  */
 void printShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost);
 
+/**
+ * Prints out the game's market change screen, which tells the player that the port could not fill their order at the
+ * price they agreed to and shows what it has now, to the console.
+ * @param cCargoId The ID of the cargo that the player tried to trade.
+ * @pre @p cCargoId must have a character value of either `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @param nCargoPrice The cargo's price now.
+ * @param nStockAmount The amount of the cargo that the port has in stock now.
+ */
+void printMarketChangeScreen(char cCargoId, int nCargoPrice, int nStockAmount);
+
 /**
  * Prints out the game's navigation screen, which contains the new port the player navigated to and the new day count,
  * to the console.
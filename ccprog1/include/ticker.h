@@ -0,0 +1,95 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_TICKER_H_
+#define CCPROG1_TICKER_H_
+
+#include <pthread.h>
+
+#include "trading.h"
+
+#define MARKET_TICKER_DEFAULT_INTERVAL 1000
+#define MARKET_TICKER_MAXIMUM_INTERVAL 60000
+
+// A price moves by at most this fraction of its port's price range on every tick, and by at least one gold coin.
+#define MARKET_TICKER_STEP_DIVISOR 8
+
+/** The market prices of a port at one tick, which are never changed once published. */
+typedef struct MarketSnapshot {
+  /** The ID of the port, or `0` if no port has been opened yet. */
+  char cPortId;
+  /** The number of ticks since the port was opened. */
+  long long llTick;
+  int anMarketPrices[CARGO_AMOUNT];
+} MarketSnapshot;
+
+/**
+ * The live market prices of the port that the player is in, which a background thread moves within the port's price
+ * ranges on every tick. The snapshot is published through a sequence lock, so readers never block the thread or each
+ * other and retry only when they overlap a publication.
+ */
+typedef struct MarketTicker {
+  // Odd while a snapshot is being published.
+  unsigned long long ullSequence;
+  MarketSnapshot sSnapshot;
+
+  // Only used by the writers, which are serialized by the mutex.
+  pthread_mutex_t sMutex;
+  pthread_cond_t sCondition;
+  unsigned long long ullRandomState;
+  int nOpenedPortAmount;
+  int bIsStopping;
+  /** The number of milliseconds between ticks. */
+  int nInterval;
+  int bThreadIsStarted;
+  pthread_t sThread;
+} MarketTicker;
+
+/**
+ * Starts a market ticker's thread, which only ticks after a port has been opened.
+ * @param[out] pTicker The market ticker.
+ * @param nInterval The number of milliseconds between ticks.
+ * @pre @p nInterval must have an integer value within the range of `0` and `60000`.
+ * @param ullSeed The seed of the price movements.
+ * @returns `1` if the thread was started or `0` if it could not be, in which case the prices only tick when
+ * `advanceMarketTicker()` is called.
+ */
+int startMarketTicker(MarketTicker *pTicker, int nInterval, unsigned long long ullSeed);
+
+/**
+ * Publishes a port's opening market prices, which the ticks then move from. The next tick is a whole interval away.
+ * @param[out] pTicker The market ticker.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param anMarketPrices The port's opening market prices in cargo order.
+ */
+void openMarketTickerPort(MarketTicker *pTicker, char cPortId, const int anMarketPrices[CARGO_AMOUNT]);
+
+/**
+ * Moves every market price of the opened port by one tick and publishes them.
+ * @param[out] pTicker The market ticker.
+ * @pre A port must have been opened.
+ */
+void advanceMarketTicker(MarketTicker *pTicker);
+
+/**
+ * Reads the newest snapshot of a market ticker without taking any lock. The snapshot is always one that was published
+ * as a whole, even while the ticker's thread is publishing another one.
+ * @param pTicker The market ticker.
+ * @param[out] pSnapshot The snapshot.
+ */
+void readMarketTicker(const MarketTicker *pTicker, MarketSnapshot *pSnapshot);
+
+/**
+ * Stops a market ticker's thread and waits for it to finish.
+ * @param[out] pTicker The market ticker.
+ */
+void stopMarketTicker(MarketTicker *pTicker);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_TICKER_H_
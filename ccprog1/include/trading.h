@@ -54,6 +54,11 @@
 #define TIER_THREE_SHIP_UPGRADE_COST 1750
 #define TIER_FOUR_SHIP_UPGRADE_COST 2500
 
+#define MAXIMUM_PLAYER_TURNS 30
+
+#define PORT_AMOUNT 4
+#define CARGO_AMOUNT 4
+
 /**
  * Generates a random price within the provided maximum and minimum prices.
  * @param nMinimumPrice The minimum allowed price.
@@ -62,6 +67,62 @@
  */
 int generateRandomPrice(int nMinimumPrice, int nMaximumPrice);
 
+/**
+ * Gets the minimum and maximum market prices of a cargo in a port.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @param[out] nMinimumPrice The minimum market price of the cargo.
+ * @param[out] nMaximumPrice The maximum market price of the cargo.
+ */
+void getCargoPriceRange(char cPortId, char cCargoId, int *nMinimumPrice, int *nMaximumPrice);
+
+/**
+ * Gets the ID of a port from its index, which follows the order of Tondo, Manila, Pandakan, and Sapa.
+ * @param nPortIndex The index of the port.
+ * @pre @p nPortIndex must have an integer value within the range of `0` and `3`.
+ * @returns A character value of `'T'` for Tondo, `'M'` for Manila, `'P'` for Pandakan, or `'S'` for Sapa.
+ */
+char getPortId(int nPortIndex);
+
+/**
+ * Gets the index of a port from its ID, which follows the order of Tondo, Manila, Pandakan, and Sapa.
+ * @param cPortId The port's ID.
+ * @returns An integer value within the range of `0` and `3`, or `-1` if the port does not exist.
+ */
+int getPortIndex(char cPortId);
+
+/**
+ * Gets the ID of a cargo from its index, which follows the order of coconut, rice, silk, and gun.
+ * @param nCargoIndex The index of the cargo.
+ * @pre @p nCargoIndex must have an integer value within the range of `0` and `3`.
+ * @returns A character value of `'C'` for coconut, `'R'` for rice, `'S'` for silk, or `'G'` for gun.
+ */
+char getCargoId(int nCargoIndex);
+
+/**
+ * Gets the index of a cargo from its ID, which follows the order of coconut, rice, silk, and gun.
+ * @param cCargoId The ID of the cargo.
+ * @returns An integer value within the range of `0` and `3`, or `-1` if the cargo does not exist.
+ */
+int getCargoIndex(char cCargoId);
+
+/**
+ * Gets the price of upgrading the ship to its next tier.
+ * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @returns The price of the ship upgrade, or `0` if the ship is already in the highest tier.
+ */
+int getShipUpgradeCost(int nShipCurrentCargoLimit);
+
+/**
+ * Gets the maximum amount of cargo that the ship can carry after upgrading it to its next tier.
+ * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @returns The upgraded maximum amount of cargo, or @p nShipCurrentCargoLimit if the ship is already in the highest
+ * tier.
+ */
+int getShipUpgradedCargoLimit(int nShipCurrentCargoLimit);
+
 /**
  * Subtracts or adds the cargo's cost to the player's balance and cargo to the ship's storage based on the transaction
  * type and prints out the game's transaction screen.
@@ -0,0 +1,61 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Prevent duplicate declarations of this header file's content. ...
+#ifndef CCPROG1_TUNING_H_
+#define CCPROG1_TUNING_H_
+
+#include <stdio.h>
+
+#include "simulation.h"
+
+#define TUNING_DEFAULT_CANDIDATE_AMOUNT 32
+#define TUNING_DEFAULT_INITIAL_GAME_AMOUNT 64
+#define TUNING_MAXIMUM_CANDIDATE_AMOUNT 1024
+#define TUNING_MAXIMUM_THREAD_AMOUNT 64
+
+// The number of games that a thread plays for a candidate before taking more work.
+#define TUNING_GAME_CHUNK_SIZE 32
+
+#define TUNING_MINIMUM_MARGIN_RANGE_START 0
+#define TUNING_MINIMUM_MARGIN_RANGE_END 60
+#define TUNING_MINIMUM_UPGRADE_VALUE_RANGE_START -5000
+#define TUNING_MINIMUM_UPGRADE_VALUE_RANGE_END 50000
+#define TUNING_ROUTE_VALUE_WEIGHT_RANGE_START 0
+#define TUNING_ROUTE_VALUE_WEIGHT_RANGE_END 200
+
+/** A set of greedy bot parameters and the profits of the games it has played so far. */
+typedef struct TuningCandidate {
+  int nMinimumMargin;
+  int nMinimumUpgradeValue;
+  int nRouteValueWeight;
+  int nGameAmount;
+  double dProfitSum;
+} TuningCandidate;
+
+/**
+ * Tunes the parameters of the greedy bot with successive halving. Random candidates, along with the default
+ * parameters, play the same games, the better half by mean profit is kept, and the kept candidates play twice as many
+ * games until one is left. The games already played by a candidate are reused in later rounds, and every round's
+ * games are split across a pool of threads in chunks.
+ * @param nCandidateAmount The number of candidates to start with.
+ * @pre @p nCandidateAmount must have an integer value within the range of `1` and `1024`.
+ * @param nInitialGameAmount The number of games that every candidate plays in the first round.
+ * @pre @p nInitialGameAmount must have a positive integer value.
+ * @param nThreadAmount The number of threads to play with.
+ * @pre @p nThreadAmount must have an integer value within the range of `1` and `64`.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @param ullSeed The seed of the random candidates.
+ * @param[out] pHistoryFile The file to write every round's candidates to, or `NULL` to not write them.
+ * @param[out] pBestCandidate The last candidate left.
+ * @returns The number of rounds, or `0` if a round could not be played because memory ran out.
+ */
+int tuneGreedyBot(int nCandidateAmount, int nInitialGameAmount, int nThreadAmount, const PriceTape *pPriceTape,
+                  unsigned long long ullSeed, FILE *pHistoryFile, TuningCandidate *pBestCandidate);
+
+// ... Prevent duplicate declarations of this header file's content.
+#endif  // CCPROG1_TUNING_H_
@@ -0,0 +1,535 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "bots.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "engine.h"
+#include "planning.h"
+#include "prompts.h"
+#include "trading.h"
+
+// Keeping all cargo or selling it, not upgrading or upgrading, buying nothing or a cargo, and every other port.
+#define MAXIMUM_TURN_PLAN_AMOUNT (2 * 2 * (CARGO_AMOUNT + 1) * (PORT_AMOUNT - 1))
+
+/** A choice of what to do in a single turn, which is applied as a sequence of game actions. */
+typedef struct TurnPlan {
+  int bSellsAllCargo;
+  int bUpgradesShip;
+  /** The index of the cargo to buy as much of as possible, or `-1` to buy nothing. */
+  int nBuyCargoIndex;
+  char cDestinationPortId;
+} TurnPlan;
+
+/** A remembered value of a state searched up to a certain depth. */
+typedef struct TranspositionEntry {
+  unsigned long long ullKey;
+  int nDepth;
+  double dValue;
+} TranspositionEntry;
+
+/** The memory of a single search thread. */
+typedef struct SearchThread {
+  const GameState *pRootGameState;
+  const TurnPlan *aTurnPlans;
+  int nTurnPlanAmount;
+  int nFirstTurnPlanIndex;
+  int nTurnPlanIndexStep;
+  int nDepth;
+  int nSampleAmount;
+  TranspositionEntry *aTranspositionTable;
+  double *adTurnPlanValues;
+  long long llNodeAmount;
+} SearchThread;
+
+static double searchMaxNode(SearchThread *pSearchThread, const GameState *pGameState, int nDepth);
+
+/**
+ * Lists every turn plan that can be made from a game's state.
+ * @param pGameState The state of the game.
+ * @param[out] aTurnPlans The turn plans.
+ * @returns The number of turn plans in @p aTurnPlans.
+ */
+static int listTurnPlans(const GameState *pGameState, TurnPlan aTurnPlans[MAXIMUM_TURN_PLAN_AMOUNT]) {
+  int nTurnPlanAmount = 0;
+  int bShipHasCargo = getShipTotalCargoAmount(pGameState) > 0;
+  int nShipUpgradeCost = getShipUpgradeCost(pGameState->nShipCargoLimit);
+
+  for (int bSellsAllCargo = 0; bSellsAllCargo <= bShipHasCargo; bSellsAllCargo++) {
+    for (int bUpgradesShip = 0; bUpgradesShip <= (nShipUpgradeCost > 0); bUpgradesShip++) {
+      for (int nBuyCargoIndex = -1; nBuyCargoIndex < CARGO_AMOUNT; nBuyCargoIndex++) {
+        for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+          if (getPortId(nPortIndex) == pGameState->cPortId) continue;
+
+          aTurnPlans[nTurnPlanAmount].bSellsAllCargo = bSellsAllCargo;
+          aTurnPlans[nTurnPlanAmount].bUpgradesShip = bUpgradesShip;
+          aTurnPlans[nTurnPlanAmount].nBuyCargoIndex = nBuyCargoIndex;
+          aTurnPlans[nTurnPlanAmount].cDestinationPortId = getPortId(nPortIndex);
+          nTurnPlanAmount++;
+        }
+      }
+    }
+  }
+
+  return nTurnPlanAmount;
+}
+
+/**
+ * Applies a turn plan to a game's state, up to and including the navigation but without the new port's prices.
+ * @param[out] pGameState The state of the game.
+ * @param pTurnPlan The turn plan.
+ * @param[out] aTurnActions The applied actions, or `NULL` if they are not needed.
+ * @param[out] nTurnActionAmount The number of applied actions, or `NULL` if they are not needed.
+ * @returns `1` if the plan was applied or `0` if one of its parts could not be done, which makes it a duplicate of a
+ * smaller plan.
+ */
+static int applyTurnPlan(GameState *pGameState, const TurnPlan *pTurnPlan, GameAction aTurnActions[],
+                         int *nTurnActionAmount) {
+  GameAction aAppliedActions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int nAppliedActionAmount = 0;
+
+  if (pTurnPlan->bSellsAllCargo) {
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      if (pGameState->anShipCargoAmounts[nCargoIndex] == 0) continue;
+
+      int nCargoAmount = pGameState->anShipCargoAmounts[nCargoIndex];
+      GameAction sGameAction = {SELL_ACTION_ID, getCargoId(nCargoIndex), nCargoAmount, 0};
+
+      applyGameAction(pGameState, &sGameAction);
+      aAppliedActions[nAppliedActionAmount++] = sGameAction;
+    }
+  }
+
+  if (pTurnPlan->bUpgradesShip) {
+    GameAction sGameAction = {UPGRADE_ACTION_ID, 0, 0, 0};
+
+    if (!applyGameAction(pGameState, &sGameAction)) return 0;
+
+    aAppliedActions[nAppliedActionAmount++] = sGameAction;
+  }
+
+  if (pTurnPlan->nBuyCargoIndex >= 0) {
+    char cCargoId = getCargoId(pTurnPlan->nBuyCargoIndex);
+    GameAction sGameAction = {BUY_ACTION_ID, cCargoId, getMaximumBuyAmount(pGameState, cCargoId), 0};
+
+    if (!applyGameAction(pGameState, &sGameAction)) return 0;
+
+    aAppliedActions[nAppliedActionAmount++] = sGameAction;
+  }
+
+  GameAction sGameAction = {NAVIGATE_ACTION_ID, 0, 0, pTurnPlan->cDestinationPortId};
+
+  if (!applyGameAction(pGameState, &sGameAction)) return 0;
+
+  aAppliedActions[nAppliedActionAmount++] = sGameAction;
+
+  if (aTurnActions != NULL && nTurnActionAmount != NULL) {
+    for (int nActionIndex = 0; nActionIndex < nAppliedActionAmount; nActionIndex++) {
+      aTurnActions[nActionIndex] = aAppliedActions[nActionIndex];
+    }
+
+    *nTurnActionAmount = nAppliedActionAmount;
+  }
+
+  return 1;
+}
+
+/**
+ * Estimates the final balance of a game's state without looking ahead, by selling all cargo at the current prices.
+ * @param pGameState The state of the game.
+ * @returns The estimated final balance.
+ */
+static double evaluateGameState(const GameState *pGameState) {
+  double dValue = pGameState->nPlayerBalance;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    dValue += (double)pGameState->anShipCargoAmounts[nCargoIndex] * pGameState->anMarketPrices[nCargoIndex];
+  }
+
+  return dValue;
+}
+
+/**
+ * Searches a chance node, which is the arrival at a port whose market prices are not yet known.
+ * @param[out] pSearchThread The search thread.
+ * @param pGameState The state of the game right after navigating.
+ * @param nDepth The number of voyages left to look ahead, including the one that was just made.
+ * @returns The expected final balance.
+ */
+static double searchChanceNode(SearchThread *pSearchThread, const GameState *pGameState, int nDepth) {
+  pSearchThread->llNodeAmount++;
+
+  // The cargo left in the ship when the game ends can never be sold.
+  if (isGameOver(pGameState)) return pGameState->nPlayerBalance;
+
+  int anMinimumPrices[CARGO_AMOUNT];
+  int anMaximumPrices[CARGO_AMOUNT];
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    getCargoPriceRange(pGameState->cPortId, getCargoId(nCargoIndex), &anMinimumPrices[nCargoIndex],
+                       &anMaximumPrices[nCargoIndex]);
+  }
+
+  // Seed the samples from the state so that the same state always gets the same samples.
+  unsigned long long ullRandomState = seedRandomState(hashGameState(pGameState));
+  double dValueSum = 0;
+
+  for (int nSampleIndex = 0; nSampleIndex < pSearchThread->nSampleAmount; nSampleIndex++) {
+    GameState sSampledGameState = *pGameState;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      sSampledGameState.anMarketPrices[nCargoIndex] =
+        generateSeededRandomPrice(&ullRandomState, anMinimumPrices[nCargoIndex], anMaximumPrices[nCargoIndex]);
+    }
+
+    dValueSum += searchMaxNode(pSearchThread, &sSampledGameState, nDepth - 1);
+  }
+
+  return dValueSum / pSearchThread->nSampleAmount;
+}
+
+/**
+ * Searches a max node, which is the player choosing the turn plan with the best expected final balance.
+ * @param[out] pSearchThread The search thread.
+ * @param pGameState The state of the game at the start of a turn.
+ * @param nDepth The number of voyages left to look ahead.
+ * @returns The best expected final balance.
+ */
+static double searchMaxNode(SearchThread *pSearchThread, const GameState *pGameState, int nDepth) {
+  pSearchThread->llNodeAmount++;
+
+  if (isGameOver(pGameState)) return pGameState->nPlayerBalance;
+
+  if (nDepth <= 0) return evaluateGameState(pGameState);
+
+  unsigned long long ullKey = hashGameState(pGameState);
+  // Without a transposition table, which could not be allocated, every state is searched again.
+  TranspositionEntry *pTranspositionEntry = NULL;
+
+  if (pSearchThread->aTranspositionTable != NULL) {
+    pTranspositionEntry = &pSearchThread->aTranspositionTable[ullKey & (EXPECTIMAX_TRANSPOSITION_TABLE_SIZE - 1)];
+
+    if (pTranspositionEntry->ullKey == ullKey && pTranspositionEntry->nDepth == nDepth) {
+      return pTranspositionEntry->dValue;
+    }
+  }
+
+  TurnPlan aTurnPlans[MAXIMUM_TURN_PLAN_AMOUNT];
+  int nTurnPlanAmount = listTurnPlans(pGameState, aTurnPlans);
+  // Quitting, or doing nothing, keeps the current balance.
+  double dBestValue = pGameState->nPlayerBalance;
+
+  for (int nTurnPlanIndex = 0; nTurnPlanIndex < nTurnPlanAmount; nTurnPlanIndex++) {
+    GameState sNextGameState = *pGameState;
+
+    if (!applyTurnPlan(&sNextGameState, &aTurnPlans[nTurnPlanIndex], NULL, NULL)) continue;
+
+    double dValue = searchChanceNode(pSearchThread, &sNextGameState, nDepth);
+
+    if (dValue > dBestValue) dBestValue = dValue;
+  }
+
+  if (pTranspositionEntry != NULL) {
+    pTranspositionEntry->ullKey = ullKey;
+    pTranspositionEntry->nDepth = nDepth;
+    pTranspositionEntry->dValue = dBestValue;
+  }
+
+  return dBestValue;
+}
+
+/**
+ * Searches the root turn plans that belong to a search thread.
+ * @param pArgument The search thread, which must be a `SearchThread`.
+ * @returns `NULL`.
+ */
+static void *runSearchThread(void *pArgument) {
+  SearchThread *pSearchThread = pArgument;
+
+  for (int nTurnPlanIndex = pSearchThread->nFirstTurnPlanIndex; nTurnPlanIndex < pSearchThread->nTurnPlanAmount;
+       nTurnPlanIndex += pSearchThread->nTurnPlanIndexStep) {
+    GameState sNextGameState = *pSearchThread->pRootGameState;
+
+    if (applyTurnPlan(&sNextGameState, &pSearchThread->aTurnPlans[nTurnPlanIndex], NULL, NULL)) {
+      pSearchThread->adTurnPlanValues[nTurnPlanIndex] =
+        searchChanceNode(pSearchThread, &sNextGameState, pSearchThread->nDepth);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * Sets up an expectimax bot before its first game.
+ * @param[out] pBot The bot.
+ * @param nDepth The number of voyages to look ahead.
+ * @pre @p nDepth must have a positive integer value.
+ * @param nSampleAmount The number of random market prices to sample at every port arrival.
+ * @pre @p nSampleAmount must have a positive integer value.
+ * @param nThreadAmount The number of threads to search with.
+ * @pre @p nThreadAmount must have an integer value within the range of `1` and `64`.
+ */
+void initializeExpectimaxBot(ExpectimaxBot *pBot, int nDepth, int nSampleAmount, int nThreadAmount) {
+  pBot->nDepth = nDepth;
+  pBot->nSampleAmount = nSampleAmount;
+  pBot->nThreadAmount = nThreadAmount;
+  pBot->llNodeAmount = 0;
+  pBot->nPlannedActionAmount = 0;
+  pBot->nNextPlannedActionIndex = 0;
+  pBot->nPlannedTurn = -1;
+  pBot->cPlannedPortId = 0;
+}
+
+/**
+ * Searches the game tree for the turn plan with the best expected final balance. Every turn plan is a max node made of
+ * selling all cargo or keeping it, upgrading the ship or not, buying as much of one cargo as possible or none, and
+ * navigating to a port. Every port arrival is a chance node that averages the sampled market prices within the ranges
+ * in `trading.h`. Repeated states are looked up in a transposition table, and the root's turn plans are split across
+ * threads, each with its own table.
+ * @param pGameState The current state of the game.
+ * @param nDepth The number of voyages to look ahead.
+ * @param nSampleAmount The number of random market prices to sample at every port arrival.
+ * @param nThreadAmount The number of threads to search with.
+ * @param[out] aTurnActions The actions of the best turn plan in the order they must be applied.
+ * @param[out] nTurnActionAmount The number of actions in @p aTurnActions.
+ * @returns The number of game tree nodes searched.
+ */
+long long searchExpectimax(const GameState *pGameState, int nDepth, int nSampleAmount, int nThreadAmount,
+                           GameAction aTurnActions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT], int *nTurnActionAmount) {
+  TurnPlan aTurnPlans[MAXIMUM_TURN_PLAN_AMOUNT];
+  double adTurnPlanValues[MAXIMUM_TURN_PLAN_AMOUNT];
+  int nTurnPlanAmount = listTurnPlans(pGameState, aTurnPlans);
+  SearchThread aSearchThreads[EXPECTIMAX_MAXIMUM_THREAD_AMOUNT];
+  pthread_t aThreads[EXPECTIMAX_MAXIMUM_THREAD_AMOUNT];
+  long long llNodeAmount = 1;
+
+  *nTurnActionAmount = 0;
+
+  if (isGameOver(pGameState) || nTurnPlanAmount == 0) return llNodeAmount;
+
+  if (nThreadAmount < 1) nThreadAmount = 1;
+
+  if (nThreadAmount > EXPECTIMAX_MAXIMUM_THREAD_AMOUNT) nThreadAmount = EXPECTIMAX_MAXIMUM_THREAD_AMOUNT;
+
+  if (nThreadAmount > nTurnPlanAmount) nThreadAmount = nTurnPlanAmount;
+
+  for (int nTurnPlanIndex = 0; nTurnPlanIndex < nTurnPlanAmount; nTurnPlanIndex++) {
+    adTurnPlanValues[nTurnPlanIndex] = -1;
+  }
+
+  for (int nThreadIndex = 0; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    SearchThread *pSearchThread = &aSearchThreads[nThreadIndex];
+
+    pSearchThread->pRootGameState = pGameState;
+    pSearchThread->aTurnPlans = aTurnPlans;
+    pSearchThread->nTurnPlanAmount = nTurnPlanAmount;
+    pSearchThread->nFirstTurnPlanIndex = nThreadIndex;
+    pSearchThread->nTurnPlanIndexStep = nThreadAmount;
+    pSearchThread->nDepth = nDepth;
+    pSearchThread->nSampleAmount = nSampleAmount;
+    pSearchThread->aTranspositionTable = calloc(EXPECTIMAX_TRANSPOSITION_TABLE_SIZE, sizeof(TranspositionEntry));
+    pSearchThread->adTurnPlanValues = adTurnPlanValues;
+    pSearchThread->llNodeAmount = 0;
+  }
+
+  // Search the first share on the calling thread, and any share whose thread cannot be started as well.
+  int abThreadIsStarted[EXPECTIMAX_MAXIMUM_THREAD_AMOUNT] = {0};
+
+  for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    abThreadIsStarted[nThreadIndex] =
+      pthread_create(&aThreads[nThreadIndex], NULL, runSearchThread, &aSearchThreads[nThreadIndex]) == 0;
+
+    if (!abThreadIsStarted[nThreadIndex]) runSearchThread(&aSearchThreads[nThreadIndex]);
+  }
+
+  runSearchThread(&aSearchThreads[0]);
+
+  for (int nThreadIndex = 0; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    if (abThreadIsStarted[nThreadIndex]) pthread_join(aThreads[nThreadIndex], NULL);
+
+    llNodeAmount += aSearchThreads[nThreadIndex].llNodeAmount;
+    free(aSearchThreads[nThreadIndex].aTranspositionTable);
+  }
+
+  int nBestTurnPlanIndex = -1;
+
+  for (int nTurnPlanIndex = 0; nTurnPlanIndex < nTurnPlanAmount; nTurnPlanIndex++) {
+    if (nBestTurnPlanIndex < 0 || adTurnPlanValues[nTurnPlanIndex] > adTurnPlanValues[nBestTurnPlanIndex]) {
+      nBestTurnPlanIndex = nTurnPlanIndex;
+    }
+  }
+
+  GameState sNextGameState = *pGameState;
+
+  applyTurnPlan(&sNextGameState, &aTurnPlans[nBestTurnPlanIndex], aTurnActions, nTurnActionAmount);
+
+  return llNodeAmount;
+}
+
+/**
+ * Decides the next action of an expectimax bot, searching only at the start of every turn.
+ * @param pGameState The current state of the game.
+ * @param pContext The bot, which must be an `ExpectimaxBot`.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+void chooseExpectimaxAction(const GameState *pGameState, void *pContext, GameAction *pGameAction) {
+  ExpectimaxBot *pBot = pContext;
+
+  // Plan again when a new turn starts or when the rest of the plan can no longer be done.
+  if (pBot->nPlannedTurn != pGameState->nPlayerTurns || pBot->cPlannedPortId != pGameState->cPortId ||
+      pBot->nNextPlannedActionIndex >= pBot->nPlannedActionAmount ||
+      !isGameActionValid(pGameState, &pBot->aPlannedActions[pBot->nNextPlannedActionIndex])) {
+    pBot->llNodeAmount += searchExpectimax(pGameState, pBot->nDepth, pBot->nSampleAmount, pBot->nThreadAmount,
+                                           pBot->aPlannedActions, &pBot->nPlannedActionAmount);
+    pBot->nNextPlannedActionIndex = 0;
+    pBot->nPlannedTurn = pGameState->nPlayerTurns;
+    pBot->cPlannedPortId = pGameState->cPortId;
+  }
+
+  if (pBot->nPlannedActionAmount == 0) {
+    pGameAction->cActionId = QUIT_ACTION_ID;
+    pGameAction->cCargoId = 0;
+    pGameAction->nCargoAmount = 0;
+    pGameAction->cPortId = 0;
+  } else {
+    *pGameAction = pBot->aPlannedActions[pBot->nNextPlannedActionIndex++];
+  }
+}
+
+/**
+ * Sets up a greedy bot before its first game.
+ * @param[out] pBot The bot.
+ * @param nMinimumMargin The smallest expected profit per cargo, in gold coins, that the bot buys a cargo for.
+ * @param nMinimumUpgradeValue The smallest expected net value, in gold coins, that the bot upgrades its ship for.
+ * @param nRouteValueWeight The percentage of the voyages' route values after the next one that is added to a port's
+ * score.
+ */
+void initializeGreedyBot(GreedyBot *pBot, int nMinimumMargin, int nMinimumUpgradeValue, int nRouteValueWeight) {
+  pBot->nMinimumMargin = nMinimumMargin;
+  pBot->nMinimumUpgradeValue = nMinimumUpgradeValue;
+  pBot->nRouteValueWeight = nRouteValueWeight;
+  pBot->nPlannedActionAmount = 0;
+  pBot->nNextPlannedActionIndex = 0;
+  pBot->nPlannedTurn = -1;
+  pBot->cPlannedPortId = 0;
+}
+
+/**
+ * Plans the current turn of a greedy bot by applying every chosen action to a copy of the game's state.
+ * @param[out] pBot The bot.
+ * @param pGameState The current state of the game.
+ */
+static void planGreedyTurn(GreedyBot *pBot, const GameState *pGameState) {
+  GameState sPlannedGameState = *pGameState;
+  int nRemainingTurns = MAXIMUM_PLAYER_TURNS - pGameState->nPlayerTurns;
+
+  pBot->nPlannedActionAmount = 0;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    if (sPlannedGameState.anShipCargoAmounts[nCargoIndex] == 0) continue;
+
+    GameAction sGameAction = {SELL_ACTION_ID, getCargoId(nCargoIndex),
+                              sPlannedGameState.anShipCargoAmounts[nCargoIndex], 0};
+
+    applyGameAction(&sPlannedGameState, &sGameAction);
+    pBot->aPlannedActions[pBot->nPlannedActionAmount++] = sGameAction;
+  }
+
+  GameAction sUpgradeAction = {UPGRADE_ACTION_ID, 0, 0, 0};
+
+  if (isGameActionValid(&sPlannedGameState, &sUpgradeAction) &&
+      getShipUpgradeValue(sPlannedGameState.nShipCargoLimit, sPlannedGameState.nPlayerBalance,
+                          sPlannedGameState.nPlayerTurns) >= pBot->nMinimumUpgradeValue) {
+    applyGameAction(&sPlannedGameState, &sUpgradeAction);
+    pBot->aPlannedActions[pBot->nPlannedActionAmount++] = sUpgradeAction;
+  }
+
+  char cBestPortId = 0;
+  int nBestCargoIndex = -1;
+  long long llBestScore = 0;
+
+  for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+    char cPortId = getPortId(nPortIndex);
+
+    if (cPortId == sPlannedGameState.cPortId) continue;
+
+    int nCargoIndex = -1;
+    long long llProfit = 0;
+
+    // Cargo bought on the last voyage can never be sold.
+    for (int nCandidateIndex = 0; nRemainingTurns > 1 && nCandidateIndex < CARGO_AMOUNT; nCandidateIndex++) {
+      int nMinimumPrice;
+      int nMaximumPrice;
+
+      getCargoPriceRange(cPortId, getCargoId(nCandidateIndex), &nMinimumPrice, &nMaximumPrice);
+
+      int nMargin = (nMinimumPrice + nMaximumPrice) / 2 - sPlannedGameState.anMarketPrices[nCandidateIndex];
+      long long llCandidateProfit =
+        (long long)nMargin * getMaximumBuyAmount(&sPlannedGameState, getCargoId(nCandidateIndex));
+
+      if (nMargin >= pBot->nMinimumMargin && llCandidateProfit > llProfit) {
+        nCargoIndex = nCandidateIndex;
+        llProfit = llCandidateProfit;
+      }
+    }
+
+    int nFutureRouteValue = 0;
+
+    for (int nNextPortIndex = 0; nNextPortIndex < PORT_AMOUNT; nNextPortIndex++) {
+      int nRouteValue = getRouteValue(cPortId, getPortId(nNextPortIndex), sPlannedGameState.nPlayerTurns + 1);
+
+      if (nRouteValue > nFutureRouteValue) nFutureRouteValue = nRouteValue;
+    }
+
+    long long llScore =
+      llProfit + (long long)nFutureRouteValue * sPlannedGameState.nShipCargoLimit * pBot->nRouteValueWeight / 100;
+
+    if (cBestPortId == 0 || llScore > llBestScore) {
+      cBestPortId = cPortId;
+      nBestCargoIndex = nCargoIndex;
+      llBestScore = llScore;
+    }
+  }
+
+  if (nBestCargoIndex >= 0) {
+    char cCargoId = getCargoId(nBestCargoIndex);
+    GameAction sGameAction = {BUY_ACTION_ID, cCargoId, getMaximumBuyAmount(&sPlannedGameState, cCargoId), 0};
+
+    applyGameAction(&sPlannedGameState, &sGameAction);
+    pBot->aPlannedActions[pBot->nPlannedActionAmount++] = sGameAction;
+  }
+
+  GameAction sNavigateAction = {NAVIGATE_ACTION_ID, 0, 0, cBestPortId};
+
+  pBot->aPlannedActions[pBot->nPlannedActionAmount++] = sNavigateAction;
+  pBot->nNextPlannedActionIndex = 0;
+  pBot->nPlannedTurn = pGameState->nPlayerTurns;
+  pBot->cPlannedPortId = pGameState->cPortId;
+}
+
+/**
+ * Decides the next action of a greedy bot. At the start of every turn, the bot sells all of its cargo, upgrades its
+ * ship if the upgrade's expected net value is large enough, and then picks the port and cargo with the best expected
+ * profit from the next voyage plus a weighted share of the route values of the voyages after it.
+ * @param pGameState The current state of the game.
+ * @param pContext The bot, which must be a `GreedyBot`.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+void chooseGreedyAction(const GameState *pGameState, void *pContext, GameAction *pGameAction) {
+  GreedyBot *pBot = pContext;
+
+  // Plan again when a new turn starts or when the rest of the plan can no longer be done.
+  if (pBot->nPlannedTurn != pGameState->nPlayerTurns || pBot->cPlannedPortId != pGameState->cPortId ||
+      pBot->nNextPlannedActionIndex >= pBot->nPlannedActionAmount ||
+      !isGameActionValid(pGameState, &pBot->aPlannedActions[pBot->nNextPlannedActionIndex])) {
+    planGreedyTurn(pBot, pGameState);
+  }
+
+  *pGameAction = pBot->aPlannedActions[pBot->nNextPlannedActionIndex++];
+}
@@ -0,0 +1,230 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "compression.h"
+
+#include <string.h>
+
+// The lengths in a token are 4 bits each, where the largest value means that more length bytes follow.
+#define LZ_TOKEN_LENGTH_MASK 15
+
+/**
+ * Reads 4 bytes as one integer, without caring about their order since it is only hashed and compared.
+ * @param aucBytes The bytes.
+ * @returns The integer.
+ */
+static unsigned int readLzWord(const unsigned char aucBytes[]) {
+  unsigned int unWord;
+
+  memcpy(&unWord, aucBytes, sizeof(unWord));
+
+  return unWord;
+}
+
+/**
+ * Hashes 4 bytes into an index of the match finder's hash table.
+ * @param unWord The 4 bytes.
+ * @returns An integer value within the range of `0` and `LZ_HASH_TABLE_SIZE - 1`.
+ */
+static int hashLzWord(unsigned int unWord) { return (int)((unWord * 2654435761U) >> (32 - LZ_HASH_TABLE_BIT_AMOUNT)); }
+
+/**
+ * Writes a length that did not fit in a token as a run of 255s ended by a smaller byte.
+ * @param[out] aucDestination The bytes to write to.
+ * @param nLength The length minus the largest token value.
+ * @returns The number of bytes written.
+ */
+static int writeLzLength(unsigned char aucDestination[], int nLength) {
+  int nByteAmount = 0;
+
+  for (; nLength >= 255; nLength -= 255) aucDestination[nByteAmount++] = 255;
+
+  aucDestination[nByteAmount++] = (unsigned char)nLength;
+
+  return nByteAmount;
+}
+
+/**
+ * Writes a sequence of literals followed by a match, or only literals if it is the last sequence.
+ * @param[out] aucDestination The bytes to write to.
+ * @param aucLiterals The literals.
+ * @param nLiteralSize The number of literals.
+ * @param nMatchOffset How far back the match starts, or `0` if there is no match.
+ * @param nMatchSize The length of the match.
+ * @returns The number of bytes written.
+ */
+static int writeLzSequence(unsigned char aucDestination[], const unsigned char aucLiterals[], int nLiteralSize,
+                           int nMatchOffset, int nMatchSize) {
+  int nLiteralToken = nLiteralSize < LZ_TOKEN_LENGTH_MASK ? nLiteralSize : LZ_TOKEN_LENGTH_MASK;
+  int nMatchLength = nMatchSize - LZ_MINIMUM_MATCH_SIZE;
+  int nMatchToken = nMatchOffset == 0                     ? 0
+                    : nMatchLength < LZ_TOKEN_LENGTH_MASK ? nMatchLength
+                                                          : LZ_TOKEN_LENGTH_MASK;
+  int nByteAmount = 1;
+
+  aucDestination[0] = (unsigned char)(nLiteralToken << 4 | nMatchToken);
+
+  if (nLiteralToken == LZ_TOKEN_LENGTH_MASK) {
+    nByteAmount += writeLzLength(&aucDestination[nByteAmount], nLiteralSize - LZ_TOKEN_LENGTH_MASK);
+  }
+
+  memcpy(&aucDestination[nByteAmount], aucLiterals, nLiteralSize);
+  nByteAmount += nLiteralSize;
+
+  if (nMatchOffset == 0) return nByteAmount;
+
+  aucDestination[nByteAmount++] = (unsigned char)(nMatchOffset & 0xFF);
+  aucDestination[nByteAmount++] = (unsigned char)(nMatchOffset >> 8);
+
+  if (nMatchToken == LZ_TOKEN_LENGTH_MASK) {
+    nByteAmount += writeLzLength(&aucDestination[nByteAmount], nMatchLength - LZ_TOKEN_LENGTH_MASK);
+  }
+
+  return nByteAmount;
+}
+
+/**
+ * Compresses a block of bytes with a fast LZ77 compressor in the style of LZ4. The block is made of sequences, each
+ * holding a token byte with the lengths of its literals and match, the literals, and a 2-byte offset back to the
+ * match. Matches are found with a hash table of the last position of every 4 bytes.
+ * @param aucSource The bytes to compress.
+ * @param nSourceSize The number of bytes to compress.
+ * @param[out] aucDestination The compressed bytes, which must have room for `LZ_MAXIMUM_COMPRESSED_SIZE(nSourceSize)`
+ * bytes.
+ * @returns The number of compressed bytes.
+ */
+int compressLzBlock(const unsigned char aucSource[], int nSourceSize, unsigned char aucDestination[]) {
+  int anLastPositions[LZ_HASH_TABLE_SIZE];
+  int nDestinationSize = 0;
+  int nLiteralStart = 0;
+  int nPosition = 0;
+
+  for (int nHashIndex = 0; nHashIndex < LZ_HASH_TABLE_SIZE; nHashIndex++) anLastPositions[nHashIndex] = -1;
+
+  while (nPosition + LZ_MINIMUM_MATCH_SIZE <= nSourceSize) {
+    unsigned int unWord = readLzWord(&aucSource[nPosition]);
+    int nHashIndex = hashLzWord(unWord);
+    int nCandidate = anLastPositions[nHashIndex];
+
+    anLastPositions[nHashIndex] = nPosition;
+
+    if (nCandidate < 0 || nPosition - nCandidate > LZ_MAXIMUM_MATCH_OFFSET ||
+        readLzWord(&aucSource[nCandidate]) != unWord) {
+      nPosition++;
+
+      continue;
+    }
+
+    int nMatchSize = LZ_MINIMUM_MATCH_SIZE;
+
+    while (nPosition + nMatchSize < nSourceSize &&
+           aucSource[nCandidate + nMatchSize] == aucSource[nPosition + nMatchSize]) {
+      nMatchSize++;
+    }
+
+    nDestinationSize += writeLzSequence(&aucDestination[nDestinationSize], &aucSource[nLiteralStart],
+                                        nPosition - nLiteralStart, nPosition - nCandidate, nMatchSize);
+    nPosition += nMatchSize;
+    nLiteralStart = nPosition;
+  }
+
+  // The block always ends with a sequence of only literals, even if there are none left.
+  nDestinationSize +=
+    writeLzSequence(&aucDestination[nDestinationSize], &aucSource[nLiteralStart], nSourceSize - nLiteralStart, 0, 0);
+
+  return nDestinationSize;
+}
+
+/**
+ * Reads a length that did not fit in a token.
+ * @param aucSource The compressed bytes.
+ * @param nSourceSize The number of compressed bytes.
+ * @param[out] pnPosition The position of the length, which is moved past it.
+ * @returns The length minus the largest token value, or `-1` if the bytes ended.
+ */
+static int readLzLength(const unsigned char aucSource[], int nSourceSize, int *pnPosition) {
+  int nLength = 0;
+
+  for (;;) {
+    if (*pnPosition >= nSourceSize) return -1;
+
+    unsigned char ucByte = aucSource[(*pnPosition)++];
+
+    nLength += ucByte;
+
+    if (ucByte != 255) return nLength;
+  }
+}
+
+/**
+ * Decompresses a block of bytes compressed by `compressLzBlock()`, checking every length and offset.
+ * @param aucSource The compressed bytes.
+ * @param nSourceSize The number of compressed bytes.
+ * @param[out] aucDestination The decompressed bytes.
+ * @param nDestinationCapacity The number of bytes that @p aucDestination can hold.
+ * @returns The number of decompressed bytes, or `-1` if the block is corrupted or does not fit.
+ */
+int decompressLzBlock(const unsigned char aucSource[], int nSourceSize, unsigned char aucDestination[],
+                      int nDestinationCapacity) {
+  int nSourcePosition = 0;
+  int nDestinationSize = 0;
+
+  while (nSourcePosition < nSourceSize) {
+    unsigned char ucToken = aucSource[nSourcePosition++];
+    int nLiteralSize = ucToken >> 4;
+
+    if (nLiteralSize == LZ_TOKEN_LENGTH_MASK) {
+      int nExtraLength = readLzLength(aucSource, nSourceSize, &nSourcePosition);
+
+      if (nExtraLength < 0) return -1;
+
+      nLiteralSize += nExtraLength;
+    }
+
+    if (nLiteralSize > nSourceSize - nSourcePosition || nLiteralSize > nDestinationCapacity - nDestinationSize) {
+      return -1;
+    }
+
+    memcpy(&aucDestination[nDestinationSize], &aucSource[nSourcePosition], nLiteralSize);
+    nSourcePosition += nLiteralSize;
+    nDestinationSize += nLiteralSize;
+
+    // Only the last sequence has no match.
+    if (nSourcePosition == nSourceSize) return nDestinationSize;
+
+    if (nSourceSize - nSourcePosition < 2) return -1;
+
+    int nMatchOffset = aucSource[nSourcePosition] | aucSource[nSourcePosition + 1] << 8;
+    int nMatchSize = (ucToken & LZ_TOKEN_LENGTH_MASK) + LZ_MINIMUM_MATCH_SIZE;
+
+    nSourcePosition += 2;
+
+    if ((ucToken & LZ_TOKEN_LENGTH_MASK) == LZ_TOKEN_LENGTH_MASK) {
+      int nExtraLength = readLzLength(aucSource, nSourceSize, &nSourcePosition);
+
+      if (nExtraLength < 0) return -1;
+
+      nMatchSize += nExtraLength;
+    }
+
+    if (nMatchOffset == 0 || nMatchOffset > nDestinationSize || nMatchSize > nDestinationCapacity - nDestinationSize) {
+      return -1;
+    }
+
+    // Copy one byte at a time since a match can overlap the bytes it produces.
+    const unsigned char *pucMatch = &aucDestination[nDestinationSize - nMatchOffset];
+
+    for (int nByteIndex = 0; nByteIndex < nMatchSize; nByteIndex++) {
+      aucDestination[nDestinationSize + nByteIndex] = pucMatch[nByteIndex];
+    }
+
+    nDestinationSize += nMatchSize;
+  }
+
+  // A block must end with a sequence of only literals.
+  return -1;
+}
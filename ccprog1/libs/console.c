@@ -5,50 +5,729 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+// Expose isatty(), sigaction(), sigprocmask(), and the terminal's attributes and process group from the POSIX standard,
+// and restarting interrupted inputs from its X/Open extension.
+#define _XOPEN_SOURCE 600
+
 #include "console.h"
 
+#include <ctype.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "rendering.h"
+
+#define INPUT_LINE_SIZE 256
+
+// The line that the player last entered, which can hold the inputs of several prompts.
+static char acInputLine[INPUT_LINE_SIZE] = "";
+static int nInputLineIndex = 0;
+static int bInputLineIsTypedAhead = 0;
+
+// Whether character inputs are read on a single keystroke, and whether the terminal is currently in that mode.
+static int bRawInputIsEnabled = 0;
+static volatile sig_atomic_t bTerminalIsRaw = 0;
+static struct termios sCookedTerminalAttributes;
+static struct termios sRawTerminalAttributes;
+
+static InputWaitHandler fnInputWaitHandler = NULL;
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+// The color that the next text is printed in and the color that the console was last set to with an escape sequence.
+static char cConsoleColorId = DEFAULT_COLOR_ID;
+static char cPrintedColorId = DEFAULT_COLOR_ID;
+// Whether the console can show colors, which is `-1` until it is detected.
+static int bConsoleColorsAreEnabled = -1;
+static long long llRequestedColorChangeAmount = 0;
+static long long llPrintedColorChangeAmount = 0;
+// The frame that text is printed into instead of the console, if there is one.
+static ConsoleFrame *pOpenConsoleFrame = NULL;
+// The text printed since the last output chunk, which is only kept if there are handlers for it.
+static OutputChunkHandler afnOutputChunkHandlers[CONSOLE_MAXIMUM_OUTPUT_CHUNK_HANDLER_AMOUNT];
+static int nOutputChunkHandlerAmount = 0;
+static char acOutputChunk[CONSOLE_FRAME_SIZE];
+static int nOutputChunkSize = 0;
+
+/**
+ * Gets the ANSI escape sequence of a color.
+ * @param cColorId `'D'` for the default color, `'R'` for red, `'G'` for green, or `'Y'` for yellow.
+ * @returns The escape sequence.
+ */
+static const char *getColorEscapeSequence(char cColorId) {
+  switch (cColorId) {
+    case RED_COLOR_ID: {
+      return COLOR_RED;
+    }
+    case GREEN_COLOR_ID: {
+      return COLOR_GREEN;
+    }
+    case YELLOW_COLOR_ID: {
+      return COLOR_YELLOW;
+    }
+    // Set to default instead of 'D' to satisfy the compiler
+    default: {
+      return COLOR_DEFAULT;
+    }
+  }
+}
+
+/**
+ * Keeps text that was printed to the console in the output chunk, handing the chunk over first if the text does not
+ * fit.
+ * @param pText The text.
+ * @param nTextSize The number of characters in the text.
+ */
+static void keepOutputChunkText(const char *pText, int nTextSize) {
+  if (nTextSize > CONSOLE_FRAME_SIZE - nOutputChunkSize) flushOutputChunk();
+
+  // Text that would fill a whole chunk is handed over as its own chunk without being copied.
+  if (nTextSize >= CONSOLE_FRAME_SIZE) {
+    for (int nHandlerIndex = 0; nHandlerIndex < nOutputChunkHandlerAmount; nHandlerIndex++) {
+      afnOutputChunkHandlers[nHandlerIndex](pText, nTextSize);
+    }
+
+    return;
+  }
+
+  memcpy(&acOutputChunk[nOutputChunkSize], pText, nTextSize);
+  nOutputChunkSize += nTextSize;
+}
+
+/**
+ * Prints out formatted text to the console by formatting it straight into the output chunk.
+ * @param strFormat The `printf()` format of the text.
+ * @param pArguments The arguments of the format.
+ */
+static void printChunkedText(const char *strFormat, va_list pArguments) {
+  va_list pRetriedArguments;
+  int nRemainingSize = CONSOLE_FRAME_SIZE - nOutputChunkSize;
+
+  va_copy(pRetriedArguments, pArguments);
+
+  int nTextSize = vsnprintf(&acOutputChunk[nOutputChunkSize], nRemainingSize, strFormat, pArguments);
+
+  // Hand the chunk over and format the text again at the start of a new one if it did not fit.
+  if (nTextSize >= nRemainingSize && nOutputChunkSize > 0) {
+    flushOutputChunk();
+
+    nRemainingSize = CONSOLE_FRAME_SIZE;
+    nTextSize = vsnprintf(acOutputChunk, nRemainingSize, strFormat, pRetriedArguments);
+  }
+
+  va_end(pRetriedArguments);
+
+  if (nTextSize < 0) return;
+
+  if (nTextSize >= nRemainingSize) nTextSize = nRemainingSize - 1;
+
+  fwrite(&acOutputChunk[nOutputChunkSize], 1, nTextSize, stdout);
+
+  nOutputChunkSize += nTextSize;
+}
+
+/**
+ * Prints out formatted text to the console, or into the open frame if there is one.
+ * @param strFormat The `printf()` format of the text.
+ * @param pArguments The arguments of the format.
+ */
+static void printFormattedText(const char *strFormat, va_list pArguments) {
+  if (pOpenConsoleFrame == NULL && nOutputChunkHandlerAmount > 0) {
+    printChunkedText(strFormat, pArguments);
+
+    return;
+  }
+
+  if (pOpenConsoleFrame == NULL) {
+    vprintf(strFormat, pArguments);
+
+    return;
+  }
+
+  int nRemainingSize = CONSOLE_FRAME_SIZE - pOpenConsoleFrame->nTextSize;
+  int nTextSize = vsnprintf(&pOpenConsoleFrame->acText[pOpenConsoleFrame->nTextSize], nRemainingSize, strFormat,
+                            pArguments);
+
+  if (nTextSize < 0 || nTextSize >= nRemainingSize) {
+    pOpenConsoleFrame->bIsTruncated = 1;
+
+    return;
+  }
+
+  pOpenConsoleFrame->nTextSize += nTextSize;
+}
+
+/**
+ * Prints out unformatted text to the console, or into the open frame if there is one.
+ * @param strText The text.
+ */
+static void printUnformattedText(const char *strText) {
+  if (pOpenConsoleFrame == NULL) {
+    fputs(strText, stdout);
+
+    if (nOutputChunkHandlerAmount > 0) keepOutputChunkText(strText, (int)strlen(strText));
+
+    return;
+  }
+
+  int nTextSize = (int)strlen(strText);
+
+  if (nTextSize >= CONSOLE_FRAME_SIZE - pOpenConsoleFrame->nTextSize) {
+    pOpenConsoleFrame->bIsTruncated = 1;
+
+    return;
+  }
+
+  memcpy(&pOpenConsoleFrame->acText[pOpenConsoleFrame->nTextSize], strText, nTextSize + 1);
+  pOpenConsoleFrame->nTextSize += nTextSize;
+}
+
+/** Prints out the escape sequence of the console's current color if it differs from the last printed one. */
+static void printColorChange(void) {
+  if (cConsoleColorId == cPrintedColorId) return;
+
+  if (areConsoleColorsEnabled()) {
+    printUnformattedText(getColorEscapeSequence(cConsoleColorId));
+
+    llPrintedColorChangeAmount++;
+  }
+
+  cPrintedColorId = cConsoleColorId;
+}
+
+/** Leaves the console in its default color when the game exits. */
+static void restoreConsoleColor(void) {
+  cConsoleColorId = DEFAULT_COLOR_ID;
+
+  printColorChange();
+  fflush(stdout);
+}
+
+/**
+ * Checks whether a `printf()` format only prints spaces and line breaks, which look the same in every color.
+ * @param strFormat The format.
+ * @returns `1` if the format is blank or `0` if it is not.
+ */
+static int isFormatBlank(const char *strFormat) {
+  for (const char *pcCharacter = strFormat; *pcCharacter != '\0'; pcCharacter++) {
+    if (*pcCharacter != ' ' && *pcCharacter != '\n') return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Checks whether the console can show colors, which is detected on the first call. Colors are disabled if the
+ * `NO_COLOR` environment variable is set, if the terminal is `dumb`, or if the output is not a terminal.
+ * @returns `1` if color escape sequences are printed or `0` if they are not.
+ */
+int areConsoleColorsEnabled(void) {
+  if (bConsoleColorsAreEnabled < 0) {
+    const char *strNoColor = getenv("NO_COLOR");
+    const char *strTerminal = getenv("TERM");
+
+    setConsoleColorsEnabled((strNoColor == NULL || strNoColor[0] == '\0') &&
+                            (strTerminal == NULL || strcmp(strTerminal, "dumb") != 0) && isatty(STDOUT_FILENO));
+  }
+
+  return bConsoleColorsAreEnabled;
+}
+
+/**
+ * Overrides the detection of whether the console can show colors.
+ * @param bColorsAreEnabled `1` to print color escape sequences or `0` to never print them.
+ */
+void setConsoleColorsEnabled(int bColorsAreEnabled) {
+  static int bRestoreIsRegistered = 0;
+
+  bConsoleColorsAreEnabled = bColorsAreEnabled;
+
+  if (bColorsAreEnabled && !bRestoreIsRegistered) bRestoreIsRegistered = atexit(restoreConsoleColor) == 0;
+}
+
+/**
+ * Gets the number of color changes asked for and the number of escape sequences actually printed for them.
+ * @param[out] llRequestedAmount The number of color changes asked for.
+ * @param[out] llPrintedAmount The number of escape sequences printed.
+ */
+void getConsoleColorChangeAmounts(long long *llRequestedAmount, long long *llPrintedAmount) {
+  *llRequestedAmount = llRequestedColorChangeAmount;
+  *llPrintedAmount = llPrintedColorChangeAmount;
+}
+
+/** Resets the color of text output in the console, which is applied when the next text is printed. */
+void resetConsoleColor(void) {
+  cConsoleColorId = DEFAULT_COLOR_ID;
+  llRequestedColorChangeAmount++;
+}
+
+/** Sets the color of text output in the console to red, which is applied when the next text is printed. */
+void setConsoleColorToRed(void) {
+  cConsoleColorId = RED_COLOR_ID;
+  llRequestedColorChangeAmount++;
+}
+
+/** Sets the color of text output in the console to green, which is applied when the next text is printed. */
+void setConsoleColorToGreen(void) {
+  cConsoleColorId = GREEN_COLOR_ID;
+  llRequestedColorChangeAmount++;
+}
+
+/** Sets the color of text output in the console to yellow, which is applied when the next text is printed. */
+void setConsoleColorToYellow(void) {
+  cConsoleColorId = YELLOW_COLOR_ID;
+  llRequestedColorChangeAmount++;
+}
+
+/**
+ * Prints out text in the console's current color. An escape sequence is only printed if the color has changed since
+ * the last printed text, and text made only of spaces and line breaks does not change it.
+ * @param strFormat The `printf()` format of the text.
+ */
+void printConsoleText(const char *strFormat, ...) {
+  va_list pArguments;
+
+  if (!isFormatBlank(strFormat)) printColorChange();
+
+  va_start(pArguments, strFormat);
+  printFormattedText(strFormat, pArguments);
+  va_end(pArguments);
+}
+
+/**
+ * Prints out a span of text in a color, and then goes back to the console's current color for the text after it.
+ * @param cColorId `'D'` for the default color, `'R'` for red, `'G'` for green, or `'Y'` for yellow.
+ * @param strFormat The `printf()` format of the text.
+ */
+void printStyledText(char cColorId, const char *strFormat, ...) {
+  va_list pArguments;
+  char cPreviousColorId = cConsoleColorId;
+
+  // A span used to be a color change before and after its text.
+  cConsoleColorId = cColorId;
+  llRequestedColorChangeAmount += 2;
+
+  if (!isFormatBlank(strFormat)) printColorChange();
+
+  va_start(pArguments, strFormat);
+  printFormattedText(strFormat, pArguments);
+  va_end(pArguments);
+
+  cConsoleColorId = cPreviousColorId;
+}
+
+/**
+ * Starts printing every text into a frame instead of the console, starting from the console's current colors.
+ * @param[out] pFrame The frame.
+ * @pre No other thread may print to the console until the frame is ended.
+ */
+void beginConsoleFrame(ConsoleFrame *pFrame) {
+  pFrame->acText[0] = '\0';
+  pFrame->nTextSize = 0;
+  pFrame->bIsTruncated = 0;
+  pFrame->bColorsAreEnabled = areConsoleColorsEnabled();
+  pFrame->cStartColorId = cConsoleColorId;
+  pFrame->cStartPrintedColorId = cPrintedColorId;
+  // Keep the counts for now, and only turn them into the frame's own counts when it ends.
+  pFrame->llRequestedColorChangeAmount = llRequestedColorChangeAmount;
+  pFrame->llPrintedColorChangeAmount = llPrintedColorChangeAmount;
+
+  pOpenConsoleFrame = pFrame;
+}
+
+/**
+ * Stops printing into the current frame, and puts the console's colors and color change counts back to how they were
+ * when the frame began.
+ */
+void endConsoleFrame(void) {
+  ConsoleFrame *pFrame = pOpenConsoleFrame;
+
+  if (pFrame == NULL) return;
+
+  pFrame->cEndColorId = cConsoleColorId;
+  pFrame->cEndPrintedColorId = cPrintedColorId;
+  pFrame->llRequestedColorChangeAmount = llRequestedColorChangeAmount - pFrame->llRequestedColorChangeAmount;
+  pFrame->llPrintedColorChangeAmount = llPrintedColorChangeAmount - pFrame->llPrintedColorChangeAmount;
+
+  cConsoleColorId = pFrame->cStartColorId;
+  cPrintedColorId = pFrame->cStartPrintedColorId;
+  llRequestedColorChangeAmount -= pFrame->llRequestedColorChangeAmount;
+  llPrintedColorChangeAmount -= pFrame->llPrintedColorChangeAmount;
+
+  pOpenConsoleFrame = NULL;
+}
+
+/**
+ * Prints out the text of a frame, as if it were printed right now.
+ * @param pFrame The frame.
+ * @returns `1` if the frame was printed or `0` if it was truncated, or if it began in a color other than the console's
+ * current color or with colors enabled differently.
+ */
+int printConsoleFrame(const ConsoleFrame *pFrame) {
+  if (pFrame->bIsTruncated || pFrame->cStartColorId != cConsoleColorId ||
+      pFrame->bColorsAreEnabled != areConsoleColorsEnabled()) {
+    return 0;
+  }
+
+  // The frame's first escape sequence was left out if its color had already been printed, so print it now if not.
+  if (pFrame->cStartPrintedColorId != cPrintedColorId) {
+    cConsoleColorId = pFrame->cStartPrintedColorId;
+
+    printColorChange();
+  }
+
+  fwrite(pFrame->acText, 1, pFrame->nTextSize, stdout);
+
+  if (nOutputChunkHandlerAmount > 0) keepOutputChunkText(pFrame->acText, pFrame->nTextSize);
+
+  cConsoleColorId = pFrame->cEndColorId;
+  cPrintedColorId = pFrame->cEndPrintedColorId;
+  llRequestedColorChangeAmount += pFrame->llRequestedColorChangeAmount;
+  llPrintedColorChangeAmount += pFrame->llPrintedColorChangeAmount;
+
+  return 1;
+}
+
+/**
+ * Adds a function that is handed everything printed to the console in chunks, which end right before the game waits
+ * for the player's input or once `CONSOLE_FRAME_SIZE` characters have been kept. Text printed into a frame is only
+ * handed over when the frame is printed out. A single text longer than a whole chunk is cut off while there is a
+ * handler. Any text kept for the other handlers is handed to them first.
+ * @param fnHandler The function.
+ * @returns `1` if the function was added or `0` if there are already `4` handlers.
+ */
+int addOutputChunkHandler(OutputChunkHandler fnHandler) {
+  if (nOutputChunkHandlerAmount == CONSOLE_MAXIMUM_OUTPUT_CHUNK_HANDLER_AMOUNT) return 0;
+
+  flushOutputChunk();
+
+  afnOutputChunkHandlers[nOutputChunkHandlerAmount++] = fnHandler;
+
+  return 1;
+}
+
+/**
+ * Hands the kept text to every output chunk handler, and then removes one of them.
+ * @param fnHandler The function to remove.
+ */
+void removeOutputChunkHandler(OutputChunkHandler fnHandler) {
+  flushOutputChunk();
 
-/** Resets the color of text output in the console using an ANSI escape sequence. */
-void resetConsoleColor(void) { printf(COLOR_DEFAULT); }
+  for (int nHandlerIndex = 0; nHandlerIndex < nOutputChunkHandlerAmount; nHandlerIndex++) {
+    if (afnOutputChunkHandlers[nHandlerIndex] == fnHandler) {
+      afnOutputChunkHandlers[nHandlerIndex] = afnOutputChunkHandlers[--nOutputChunkHandlerAmount];
 
-/** Sets the color of text output in the console to red using an ANSI escape sequence. */
-void setConsoleColorToRed(void) { printf(COLOR_RED); }
+      return;
+    }
+  }
+}
+
+/** Hands the text printed since the last chunk to every output chunk handler, if there is any text and handler. */
+void flushOutputChunk(void) {
+  for (int nHandlerIndex = 0; nOutputChunkSize > 0 && nHandlerIndex < nOutputChunkHandlerAmount; nHandlerIndex++) {
+    afnOutputChunkHandlers[nHandlerIndex](acOutputChunk, nOutputChunkSize);
+  }
+
+  nOutputChunkSize = 0;
+}
+#endif
 
-/** Sets the color of text output in the console to green using an ANSI escape sequence. */
-void setConsoleColorToGreen(void) { printf(COLOR_GREEN); }
+/** Puts the terminal back into its line-buffered mode with echoing if a character input had left it raw. */
+static void restoreTerminal(void) {
+  if (!bTerminalIsRaw) return;
 
-/** Sets the color of text output in the console to yellow using an ANSI escape sequence. */
-void setConsoleColorToYellow(void) { printf(COLOR_YELLOW); }
+  tcsetattr(STDIN_FILENO, TCSANOW, &sCookedTerminalAttributes);
+
+  bTerminalIsRaw = 0;
+}
 
 /**
- * Prompts the player to input an integer into the console.
+ * Restores the terminal before the game is stopped by a signal, and then lets the signal stop it.
+ * @param nSignal The received signal.
+ */
+static void restoreTerminalOnSignal(int nSignal) {
+  restoreTerminal();
+  signal(nSignal, SIG_DFL);
+  raise(nSignal);
+}
+
+/**
+ * Sets the function that handles a signal, restarting an input that the signal interrupts.
+ * @param nSignal The signal.
+ * @param fnHandler The function.
+ */
+static void setSignalHandler(int nSignal, void (*fnHandler)(int)) {
+  struct sigaction sAction;
+
+  memset(&sAction, 0, sizeof(sAction));
+  sAction.sa_handler = fnHandler;
+  sAction.sa_flags = SA_RESTART;
+  sigemptyset(&sAction.sa_mask);
+  sigaction(nSignal, &sAction, NULL);
+}
+
+/**
+ * Restores the terminal before the game is suspended, and then lets the signal suspend it. The terminal is still marked
+ * raw, so that it is made raw again once the game continues.
+ * @param nSignal The received signal.
+ */
+static void suspendTerminalOnSignal(int nSignal) {
+  sigset_t sSignals;
+
+  if (bTerminalIsRaw) tcsetattr(STDIN_FILENO, TCSANOW, &sCookedTerminalAttributes);
+
+  // The signal is blocked while it is handled, so it has to be unblocked to suspend the game right away.
+  sigemptyset(&sSignals);
+  sigaddset(&sSignals, nSignal);
+  signal(nSignal, SIG_DFL);
+  sigprocmask(SIG_UNBLOCK, &sSignals, NULL);
+  raise(nSignal);
+
+  setSignalHandler(nSignal, suspendTerminalOnSignal);
+}
+
+/**
+ * Makes the terminal raw again when the game continues while a character input waits, unless the game continues in
+ * the background, where changing the terminal would suspend it again.
+ * @param nSignal The received signal.
+ */
+static void resumeTerminalOnSignal(int nSignal) {
+  (void)nSignal;
+
+  if (bTerminalIsRaw && tcgetpgrp(STDIN_FILENO) == getpgrp()) {
+    tcsetattr(STDIN_FILENO, TCSANOW, &sRawTerminalAttributes);
+  }
+}
+
+/**
+ * Makes character inputs react to a single keystroke, without waiting for the enter key or echoing, instead of reading
+ * a line. The terminal is only raw while a character input waits, and is restored on exit or when stopped or suspended
+ * by a signal.
+ * Integer inputs still read a line.
+ * @param bRawInputIsRequested `1` to read single keystrokes or `0` to read lines.
+ * @returns `1` if single keystrokes are read or `0` if lines are read, which is also the case when the input is not a
+ * terminal.
+ */
+int setRawInputEnabled(int bRawInputIsRequested) {
+  static int bRestoreIsRegistered = 0;
+  const int anStopSignals[] = {SIGHUP, SIGINT, SIGQUIT, SIGTERM};
+  const int nStopSignalAmount = (int)(sizeof(anStopSignals) / sizeof(anStopSignals[0]));
+
+  restoreTerminal();
+
+  bRawInputIsEnabled = 0;
+
+  if (!bRawInputIsRequested || !isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &sCookedTerminalAttributes) != 0) {
+    return 0;
+  }
+
+  if (!bRestoreIsRegistered) {
+    for (int nSignalIndex = 0; nSignalIndex < nStopSignalAmount; nSignalIndex++) {
+      setSignalHandler(anStopSignals[nSignalIndex], restoreTerminalOnSignal);
+    }
+
+    setSignalHandler(SIGTSTP, suspendTerminalOnSignal);
+    setSignalHandler(SIGCONT, resumeTerminalOnSignal);
+
+    bRestoreIsRegistered = atexit(restoreTerminal) == 0;
+  }
+
+  bRawInputIsEnabled = 1;
+
+  return 1;
+}
+
+/**
+ * Sets the function that is called right before and after the game blocks on the player's input, which lets work that
+ * would otherwise be done after the input run while the player is thinking.
+ * @param fnHandler The function, or `NULL` to not call any.
+ */
+void setInputWaitHandler(InputWaitHandler fnHandler) {
+  fnInputWaitHandler = fnHandler;
+}
+
+/**
+ * Lets the input wait handler start its work and hands the printed text over as a chunk, after sending out the prompt
+ * so that the player is not kept waiting.
+ */
+static void beginInputWait(void) {
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+  if (nOutputChunkHandlerAmount > 0) {
+    fflush(stdout);
+    flushOutputChunk();
+  }
+#endif
+
+  if (fnInputWaitHandler == NULL) return;
+
+  fflush(stdout);
+  fnInputWaitHandler(1);
+}
+
+/** Lets the input wait handler stop its work now that the input has arrived. */
+static void endInputWait(void) {
+  if (fnInputWaitHandler != NULL) fnInputWaitHandler(0);
+}
+
+/**
+ * Reads a single keystroke from the terminal in raw mode, skipping whitespace like `scanf(" %c")` does.
+ * @returns The first non-whitespace character typed, or `'\0'` if the input has ended.
+ */
+static char getRawCharacterInput(void) {
+  int nCharacter;
+
+  sRawTerminalAttributes = sCookedTerminalAttributes;
+
+  // Keep the signals of the control keys, so that the game can still be interrupted.
+  sRawTerminalAttributes.c_lflag &= ~(ICANON | ECHO);
+  sRawTerminalAttributes.c_cc[VMIN] = 1;
+  sRawTerminalAttributes.c_cc[VTIME] = 0;
+
+  fflush(stdout);
+
+  bTerminalIsRaw = tcsetattr(STDIN_FILENO, TCSANOW, &sRawTerminalAttributes) == 0;
+
+  beginInputWait();
+
+  do {
+    nCharacter = getchar();
+  } while (nCharacter != EOF && isspace(nCharacter));
+
+  endInputWait();
+  restoreTerminal();
+
+  // A single keystroke is never a typed-ahead command.
+  discardQueuedInput();
+
+  if (nCharacter == EOF) return '\0';
+
+  // Echo the keystroke ourselves, so that the choice stays visible like a typed line.
+  printRenderedText("%c\n", nCharacter);
+
+  return (char)nCharacter;
+}
+
+/**
+ * Checks whether the player has already typed the input of the next prompt on the current line, in which case the
+ * prompt does not have to be printed out.
+ * @returns `1` if there is unread input on the current line or `0` if the next prompt has to wait for a new line.
+ */
+int hasQueuedInput(void) {
+  while (isspace((unsigned char)acInputLine[nInputLineIndex])) nInputLineIndex++;
+
+  return acInputLine[nInputLineIndex] != '\0';
+}
+
+/**
+ * Checks whether the current line was typed with more than one token, like `B G 40 Y`, which completes a whole command
+ * without stopping at every prompt.
+ * @returns `1` if the current line is a typed-ahead command or `0` if it is not.
+ */
+int isInputTypedAhead(void) {
+  return bInputLineIsTypedAhead;
+}
+
+/**
+ * Discards the rest of the current line, which is done after an invalid input so that the rest of a typed-ahead command
+ * is not applied to the wrong prompts.
+ */
+void discardQueuedInput(void) {
+  acInputLine[0] = '\0';
+  nInputLineIndex = 0;
+  bInputLineIsTypedAhead = 0;
+}
+
+/**
+ * Reads the next line that is not blank into the input line, which is then consumed one token at a time.
+ * @returns `1` if a line was read or `0` if the input has ended.
+ */
+static int readInputLine(void) {
+  beginInputWait();
+
+  do {
+    nInputLineIndex = 0;
+
+    if (fgets(acInputLine, INPUT_LINE_SIZE, stdin) == NULL) {
+      acInputLine[0] = '\0';
+
+      endInputWait();
+
+      return 0;
+    }
+  } while (!hasQueuedInput());
+
+  endInputWait();
+
+  // A line with more than one token is a command typed ahead through the following prompts.
+  int nTokenAmount = 0;
+
+  for (int nCharacterIndex = 0; acInputLine[nCharacterIndex] != '\0'; nCharacterIndex++) {
+    if (!isspace((unsigned char)acInputLine[nCharacterIndex]) &&
+        (nCharacterIndex == 0 || isspace((unsigned char)acInputLine[nCharacterIndex - 1]))) {
+      nTokenAmount++;
+    }
+  }
+
+  bInputLineIsTypedAhead = nTokenAmount > 1;
+
+  return 1;
+}
+
+/**
+ * Prompts the player to input an integer into the console, unless it has already been typed ahead.
  * @param nLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first integer value inputted into the console..
+ * @returns The first integer value inputted into the console, or the smallest integer value if the input is not an
+ * integer.
  */
 int getIntegerInput(int nLeftPaddingSize) {
-  int nPlayerResponse;
+  if (!hasQueuedInput()) {
+    printRenderedText("\n");
+
+    printRenderedText("%*c%% ", nLeftPaddingSize, ' ');
+
+    if (!readInputLine()) return INT_MIN;
+  }
+
+  char *pcInput = &acInputLine[nInputLineIndex];
+  char *pcInputEnd;
+  long lPlayerResponse = strtol(pcInput, &pcInputEnd, 10);
 
-  printf("\n");
+  // Skip the whole token if it is not an integer, like `scanf(" %d")` would never do.
+  if (pcInputEnd == pcInput) {
+    while (acInputLine[nInputLineIndex] != '\0' && !isspace((unsigned char)acInputLine[nInputLineIndex])) {
+      nInputLineIndex++;
+    }
 
-  printf("%*c%% ", nLeftPaddingSize, ' ');
-  scanf(" %d", &nPlayerResponse);
+    return INT_MIN;
+  }
 
-  return nPlayerResponse;
+  nInputLineIndex += (int)(pcInputEnd - pcInput);
+
+  if (lPlayerResponse > INT_MAX) return INT_MAX;
+
+  return lPlayerResponse < INT_MIN ? INT_MIN : (int)lPlayerResponse;
 }
 
 /**
- * Prompts the player to input a character into the console.
+ * Prompts the player to input a character into the console, unless it has already been typed ahead.
  * @param nLeftPaddingSize The number of spaces to move the console cursor to the right.
- * @returns The first character value inputted into the console.
+ * @returns The first character value inputted into the console, or `'\0'` if the input has ended.
  */
 char getCharacterInput(int nLeftPaddingSize) {
-  char cPlayerResponse;
+  if (!hasQueuedInput()) {
+    printRenderedText("\n");
+
+    printRenderedText("%*c%% ", nLeftPaddingSize, ' ');
 
-  printf("\n");
+    if (bRawInputIsEnabled) return getRawCharacterInput();
 
-  printf("%*c%% ", nLeftPaddingSize, ' ');
-  scanf(" %c", &cPlayerResponse);
+    if (!readInputLine()) return '\0';
+  }
 
-  return cPlayerResponse;
+  return acInputLine[nInputLineIndex++];
 }
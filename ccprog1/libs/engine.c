@@ -0,0 +1,299 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "engine.h"
+
+#include "prompts.h"
+#include "trading.h"
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+#define SPLITMIX_INCREMENT 0x9E3779B97F4A7C15ULL
+
+/**
+ * Sets a game's state to the start of a new game in the initial port. The market prices are not generated.
+ * @param[out] pGameState The state of the game.
+ * @param nPlayerInitialBalance The number of gold coins the player starts with.
+ */
+void initializeGameState(GameState *pGameState, int nPlayerInitialBalance) {
+  pGameState->cPortId = INITIAL_PORT_ID;
+  pGameState->nPlayerTurns = 0;
+  pGameState->nPlayerInitialBalance = nPlayerInitialBalance;
+  pGameState->nPlayerBalance = nPlayerInitialBalance;
+  pGameState->nShipCargoLimit = TIER_ONE_SHIP_CARGO_LIMIT;
+  pGameState->bPlayerHasQuit = 0;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    pGameState->anShipCargoAmounts[nCargoIndex] = 0;
+    pGameState->anMarketPrices[nCargoIndex] = 0;
+  }
+}
+
+/**
+ * Generates random market prices for the port that the player is currently in.
+ * @param[out] pGameState The state of the game.
+ */
+void generateGameMarketPrices(GameState *pGameState) {
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    int nMinimumPrice;
+    int nMaximumPrice;
+
+    getCargoPriceRange(pGameState->cPortId, getCargoId(nCargoIndex), &nMinimumPrice, &nMaximumPrice);
+
+    pGameState->anMarketPrices[nCargoIndex] = generateRandomPrice(nMinimumPrice, nMaximumPrice);
+  }
+}
+
+/**
+ * Turns a seed into the state of an xorshift64* generator, which is independent for every caller unlike `rand()`.
+ * @param ullSeed The seed.
+ * @returns A generator state that is never `0`.
+ */
+unsigned long long seedRandomState(unsigned long long ullSeed) {
+  // Scramble the seed with SplitMix64 so that consecutive seeds do not start with similar states.
+  unsigned long long ullRandomState = ullSeed + SPLITMIX_INCREMENT;
+
+  ullRandomState = (ullRandomState ^ (ullRandomState >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  ullRandomState = (ullRandomState ^ (ullRandomState >> 27)) * 0x94D049BB133111EBULL;
+  ullRandomState ^= ullRandomState >> 31;
+
+  return ullRandomState != 0 ? ullRandomState : SPLITMIX_INCREMENT;
+}
+
+/**
+ * Generates the next pseudorandom number of an xorshift64* generator.
+ * @param[out] pullRandomState The generator's state.
+ * @pre @p pullRandomState must not point to `0`.
+ * @returns A pseudorandom 64-bit integer.
+ */
+unsigned long long generateNextRandomNumber(unsigned long long *pullRandomState) {
+  *pullRandomState ^= *pullRandomState >> 12;
+  *pullRandomState ^= *pullRandomState << 25;
+  *pullRandomState ^= *pullRandomState >> 27;
+
+  return *pullRandomState * 2685821657736338717ULL;
+}
+
+/**
+ * Generates a random price within the provided maximum and minimum prices from an xorshift64* generator.
+ * @param[out] pullRandomState The generator's state.
+ * @param nMinimumPrice The minimum allowed price.
+ * @param nMaximumPrice The maximum allowed price.
+ * @returns An integer value within the range of `nMinimumPrice` and `nMaximumPrice`.
+ */
+int generateSeededRandomPrice(unsigned long long *pullRandomState, int nMinimumPrice, int nMaximumPrice) {
+  // Use the high bits, which are the most random bits of xorshift64*.
+  return (int)((generateNextRandomNumber(pullRandomState) >> 32) % (nMaximumPrice - nMinimumPrice + 1)) +
+         nMinimumPrice;
+}
+
+/**
+ * Generates random market prices for the port that the player is currently in from an xorshift64* generator, which
+ * makes the prices reproducible and safe to generate from multiple threads.
+ * @param[out] pGameState The state of the game.
+ * @param[out] pullRandomState The generator's state.
+ */
+void generateSeededGameMarketPrices(GameState *pGameState, unsigned long long *pullRandomState) {
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    int nMinimumPrice;
+    int nMaximumPrice;
+
+    getCargoPriceRange(pGameState->cPortId, getCargoId(nCargoIndex), &nMinimumPrice, &nMaximumPrice);
+
+    pGameState->anMarketPrices[nCargoIndex] = generateSeededRandomPrice(pullRandomState, nMinimumPrice, nMaximumPrice);
+  }
+}
+
+/**
+ * Gets the total amount of cargo carried by the ship.
+ * @param pGameState The state of the game.
+ * @returns The sum of the amount of every cargo carried by the ship.
+ */
+int getShipTotalCargoAmount(const GameState *pGameState) {
+  int nShipTotalCargoAmount = 0;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    nShipTotalCargoAmount += pGameState->anShipCargoAmounts[nCargoIndex];
+  }
+
+  return nShipTotalCargoAmount;
+}
+
+/**
+ * Checks whether the action prompt offers buying, which it only does when the balance covers every cargo's market
+ * price.
+ * @param pGameState The state of the game.
+ * @returns `1` if buying is offered or `0` if it is not.
+ */
+static int isBuyingOffered(const GameState *pGameState) {
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    if (pGameState->nPlayerBalance < pGameState->anMarketPrices[nCargoIndex]) return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Gets the largest amount of a cargo that the player can both afford and store, which is `0` whenever buying is not
+ * offered.
+ * @param pGameState The state of the game.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @returns An integer value greater than or equal to `0`.
+ */
+int getMaximumBuyAmount(const GameState *pGameState, char cCargoId) {
+  int nCargoPrice = pGameState->anMarketPrices[getCargoIndex(cCargoId)];
+  int nShipFreeCargoSpace = pGameState->nShipCargoLimit - getShipTotalCargoAmount(pGameState);
+
+  if (nCargoPrice <= 0 || pGameState->nPlayerBalance <= 0 || nShipFreeCargoSpace <= 0 || !isBuyingOffered(pGameState)) {
+    return 0;
+  }
+
+  int nAffordableCargoAmount = pGameState->nPlayerBalance / nCargoPrice;
+
+  return nAffordableCargoAmount < nShipFreeCargoSpace ? nAffordableCargoAmount : nShipFreeCargoSpace;
+}
+
+/**
+ * Checks whether an action follows the same rules that the game's prompts enforce.
+ * @param pGameState The state of the game.
+ * @param pGameAction The action to check.
+ * @returns `1` if the action can be done or `0` if it cannot.
+ */
+int isGameActionValid(const GameState *pGameState, const GameAction *pGameAction) {
+  if (isGameOver(pGameState)) return 0;
+
+  switch (pGameAction->cActionId) {
+    case BUY_ACTION_ID: {
+      int nCargoIndex = getCargoIndex(pGameAction->cCargoId);
+
+      return nCargoIndex >= 0 && pGameAction->nCargoAmount > 0 && isBuyingOffered(pGameState) &&
+             getShipTotalCargoAmount(pGameState) + pGameAction->nCargoAmount <= pGameState->nShipCargoLimit &&
+             pGameState->nPlayerBalance >= pGameAction->nCargoAmount * pGameState->anMarketPrices[nCargoIndex];
+    }
+    case SELL_ACTION_ID: {
+      int nCargoIndex = getCargoIndex(pGameAction->cCargoId);
+
+      return nCargoIndex >= 0 && pGameAction->nCargoAmount > 0 &&
+             pGameState->anShipCargoAmounts[nCargoIndex] >= pGameAction->nCargoAmount;
+    }
+    case UPGRADE_ACTION_ID: {
+      int nShipUpgradeCost = getShipUpgradeCost(pGameState->nShipCargoLimit);
+
+      return nShipUpgradeCost > 0 && pGameState->nPlayerBalance >= nShipUpgradeCost;
+    }
+    case NAVIGATE_ACTION_ID: {
+      return getPortIndex(pGameAction->cPortId) >= 0 && pGameAction->cPortId != pGameState->cPortId;
+    }
+    case QUIT_ACTION_ID: {
+      return 1;
+    }
+    default: {
+      return 0;
+    }
+  }
+}
+
+/**
+ * Applies an action to a game's state without printing anything to the console.
+ * @param[out] pGameState The state of the game.
+ * @param pGameAction The action to apply.
+ * @returns `1` if the action was applied or `0` if it was invalid and ignored.
+ * @post After navigating, the market prices must be regenerated for the new port by the caller.
+ */
+int applyGameAction(GameState *pGameState, const GameAction *pGameAction) {
+  if (!isGameActionValid(pGameState, pGameAction)) return 0;
+
+  switch (pGameAction->cActionId) {
+    case BUY_ACTION_ID: {
+      int nCargoIndex = getCargoIndex(pGameAction->cCargoId);
+
+      pGameState->nPlayerBalance -= pGameAction->nCargoAmount * pGameState->anMarketPrices[nCargoIndex];
+      pGameState->anShipCargoAmounts[nCargoIndex] += pGameAction->nCargoAmount;
+
+      break;
+    }
+    case SELL_ACTION_ID: {
+      int nCargoIndex = getCargoIndex(pGameAction->cCargoId);
+
+      pGameState->nPlayerBalance += pGameAction->nCargoAmount * pGameState->anMarketPrices[nCargoIndex];
+      pGameState->anShipCargoAmounts[nCargoIndex] -= pGameAction->nCargoAmount;
+
+      break;
+    }
+    case UPGRADE_ACTION_ID: {
+      pGameState->nPlayerBalance -= getShipUpgradeCost(pGameState->nShipCargoLimit);
+      pGameState->nShipCargoLimit = getShipUpgradedCargoLimit(pGameState->nShipCargoLimit);
+
+      break;
+    }
+    case NAVIGATE_ACTION_ID: {
+      pGameState->cPortId = pGameAction->cPortId;
+      pGameState->nPlayerTurns++;
+
+      break;
+    }
+    // Set to default instead of 'Q' to satisfy the compiler
+    default: {
+      pGameState->bPlayerHasQuit = 1;
+
+      break;
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * Checks whether the player has exhausted all of their turns or has quit.
+ * @param pGameState The state of the game.
+ * @returns `1` if the game is over or `0` if it is not.
+ */
+int isGameOver(const GameState *pGameState) {
+  return pGameState->nPlayerTurns >= MAXIMUM_PLAYER_TURNS || pGameState->bPlayerHasQuit;
+}
+
+/**
+ * Mixes an integer into an FNV-1a hash one byte at a time.
+ * @param ullHash The hash so far.
+ * @param nValue The integer to mix in.
+ * @returns The updated hash.
+ */
+static unsigned long long mixIntoHash(unsigned long long ullHash, int nValue) {
+  unsigned int unValue = (unsigned int)nValue;
+
+  for (int nByteIndex = 0; nByteIndex < 4; nByteIndex++) {
+    ullHash ^= (unValue >> (nByteIndex * 8)) & 0xFF;
+    ullHash *= FNV_PRIME;
+  }
+
+  return ullHash;
+}
+
+/**
+ * Hashes every field of a game's state, which is used to identify and compare states.
+ * @param pGameState The state of the game.
+ * @returns A 64-bit FNV-1a hash.
+ */
+unsigned long long hashGameState(const GameState *pGameState) {
+  unsigned long long ullHash = FNV_OFFSET_BASIS;
+
+  ullHash = mixIntoHash(ullHash, pGameState->cPortId);
+  ullHash = mixIntoHash(ullHash, pGameState->nPlayerTurns);
+  ullHash = mixIntoHash(ullHash, pGameState->nPlayerInitialBalance);
+  ullHash = mixIntoHash(ullHash, pGameState->nPlayerBalance);
+  ullHash = mixIntoHash(ullHash, pGameState->nShipCargoLimit);
+  ullHash = mixIntoHash(ullHash, pGameState->bPlayerHasQuit);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    ullHash = mixIntoHash(ullHash, pGameState->anShipCargoAmounts[nCargoIndex]);
+    ullHash = mixIntoHash(ullHash, pGameState->anMarketPrices[nCargoIndex]);
+  }
+
+  return ullHash;
+}
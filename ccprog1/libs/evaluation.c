@@ -0,0 +1,80 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "evaluation.h"
+
+#include <math.h>
+
+/**
+ * Sets up a sequential test without any pairs.
+ * @param[out] pTest The test.
+ * @param dIndifferenceMargin The smallest mean difference that matters.
+ * @pre @p dIndifferenceMargin must have a positive value.
+ * @param dErrorRate The chance of deciding on the wrong value when the true mean difference is the margin.
+ * @pre @p dErrorRate must have a value within the range of `0` and `0.5`, exclusive.
+ */
+void initializeSequentialTest(SequentialTest *pTest, double dIndifferenceMargin, double dErrorRate) {
+  pTest->dIndifferenceMargin = dIndifferenceMargin;
+  // Wald's bounds, with the same error rate for both decisions.
+  pTest->dLowerBound = log(dErrorRate / (1 - dErrorRate));
+  pTest->dUpperBound = log((1 - dErrorRate) / dErrorRate);
+  pTest->llPairAmount = 0;
+  pTest->dDifferenceSum = 0;
+  pTest->dDifferenceSquareSum = 0;
+}
+
+/**
+ * Adds a pair of values to a sequential test.
+ * @param[out] pTest The test.
+ * @param dFirstValue The first value.
+ * @param dSecondValue The second value, which is paired with the first.
+ */
+void addSequentialTestPair(SequentialTest *pTest, double dFirstValue, double dSecondValue) {
+  double dDifference = dFirstValue - dSecondValue;
+
+  pTest->llPairAmount++;
+  pTest->dDifferenceSum += dDifference;
+  pTest->dDifferenceSquareSum += dDifference * dDifference;
+}
+
+/**
+ * Gets the log-likelihood ratio of the first value being larger over the second value being larger.
+ * @param pTest The test.
+ * @returns The log-likelihood ratio, or `0` before the minimum number of pairs.
+ */
+double getSequentialTestLogLikelihoodRatio(const SequentialTest *pTest) {
+  if (pTest->llPairAmount < SEQUENTIAL_TEST_MINIMUM_PAIR_AMOUNT) return 0;
+
+  double dMean = pTest->dDifferenceSum / pTest->llPairAmount;
+  double dVariance = (pTest->dDifferenceSquareSum - dMean * pTest->dDifferenceSum) / (pTest->llPairAmount - 1);
+
+  // Differences that never vary are decided by their sign alone.
+  if (dVariance <= 0) {
+    if (pTest->dDifferenceSum > 0) return HUGE_VAL;
+    if (pTest->dDifferenceSum < 0) return -HUGE_VAL;
+
+    return 0;
+  }
+
+  // The normal log-likelihoods of the mean difference being +margin and -margin differ by this much.
+  return 2 * pTest->dIndifferenceMargin * pTest->dDifferenceSum / dVariance;
+}
+
+/**
+ * Gets the decision of a sequential test.
+ * @param pTest The test.
+ * @returns `1` if the first value is larger, `-1` if the second value is larger, or `0` if there is not enough evidence
+ * yet.
+ */
+int getSequentialTestDecision(const SequentialTest *pTest) {
+  double dLogLikelihoodRatio = getSequentialTestLogLikelihoodRatio(pTest);
+
+  if (dLogLikelihoodRatio >= pTest->dUpperBound) return 1;
+  if (dLogLikelihoodRatio <= pTest->dLowerBound) return -1;
+
+  return 0;
+}
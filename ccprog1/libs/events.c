@@ -0,0 +1,538 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "events.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "engine.h"
+#include "prompts.h"
+#include "trading.h"
+
+// The kind of an event is stored in the lowest bits of its first byte, and its small fields in the rest.
+#define EVENT_KIND_BIT_AMOUNT 3
+#define EVENT_KIND_MASK ((1 << EVENT_KIND_BIT_AMOUNT) - 1)
+
+// The kinds of events in the order of their stored codes.
+static const char acEventIds[] = {GAME_START_EVENT_ID, MARKET_EVENT_ID, TRADE_EVENT_ID,
+                                  UPGRADE_EVENT_ID,    VOYAGE_EVENT_ID, GAME_END_EVENT_ID};
+
+// The sources of market prices in the order of their stored codes.
+static const char acPriceSourceIds[] = {RAND_PRICE_SOURCE_ID, SEEDED_PRICE_SOURCE_ID, TAPE_PRICE_SOURCE_ID,
+                                        LIVE_PRICE_SOURCE_ID};
+
+// Rolling state hashes are stored as fixed-size integers since they are evenly spread.
+#define STATE_HASH_SIZE 4
+
+/**
+ * Maps a signed integer to an unsigned one so that integers near zero take few bytes, such as `-1` to `1`.
+ * @param llValue The signed integer.
+ * @returns The zigzag-encoded integer.
+ */
+static unsigned long long encodeZigzag(long long llValue) {
+  return ((unsigned long long)llValue << 1) ^ (unsigned long long)(llValue < 0 ? -1 : 0);
+}
+
+/**
+ * Maps a zigzag-encoded integer back to its signed integer.
+ * @param ullValue The zigzag-encoded integer.
+ * @returns The signed integer.
+ */
+static long long decodeZigzag(unsigned long long ullValue) {
+  return (long long)(ullValue >> 1) ^ -(long long)(ullValue & 1);
+}
+
+/**
+ * Writes an unsigned integer with 7 bits per byte, where the highest bit of a byte tells if more bytes follow.
+ * @param[out] aucBytes The bytes to write to.
+ * @param ullValue The integer.
+ * @returns The number of bytes written, which is at most `10`.
+ */
+static int encodeVarint(unsigned char aucBytes[], unsigned long long ullValue) {
+  int nByteAmount = 0;
+
+  while (ullValue >= 0x80) {
+    aucBytes[nByteAmount++] = (unsigned char)(ullValue | 0x80);
+    ullValue >>= 7;
+  }
+
+  aucBytes[nByteAmount++] = (unsigned char)ullValue;
+
+  return nByteAmount;
+}
+
+/**
+ * Writes a rolling state hash as little-endian bytes.
+ * @param[out] aucBytes The bytes to write to.
+ * @param unStateHash The hash.
+ * @returns The number of bytes written, which is always `4`.
+ */
+static int encodeStateHash(unsigned char aucBytes[], unsigned int unStateHash) {
+  for (int nByteIndex = 0; nByteIndex < STATE_HASH_SIZE; nByteIndex++) {
+    aucBytes[nByteIndex] = (unsigned char)(unStateHash >> (nByteIndex * 8));
+  }
+
+  return STATE_HASH_SIZE;
+}
+
+/**
+ * Gets the minimum market price of a cargo in a port.
+ * @param cPortId The port's ID.
+ * @param nCargoIndex The index of the cargo.
+ * @returns The minimum price.
+ */
+static int getMinimumMarketPrice(char cPortId, int nCargoIndex) {
+  int nMinimumPrice;
+  int nMaximumPrice;
+
+  getCargoPriceRange(cPortId, getCargoId(nCargoIndex), &nMinimumPrice, &nMaximumPrice);
+
+  return nMinimumPrice;
+}
+
+/**
+ * Updates what a writer or reader remembers about the game with an event.
+ * @param[out] pContext The writer's or reader's memory.
+ * @param pGameEvent The event.
+ */
+static void updateEventLogContext(EventLogContext *pContext, const GameEvent *pGameEvent) {
+  switch (pGameEvent->cEventId) {
+    case GAME_START_EVENT_ID: {
+      pContext->nPlayerTurns = 0;
+      pContext->cPortId = INITIAL_PORT_ID;
+      pContext->nPlayerInitialBalance = pGameEvent->nPlayerBalance;
+      pContext->nShipCargoLimit = TIER_ONE_SHIP_CARGO_LIMIT;
+
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) pContext->anMarketPrices[nCargoIndex] = 0;
+
+      break;
+    }
+    case MARKET_EVENT_ID: {
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+        pContext->anMarketPrices[nCargoIndex] = pGameEvent->anMarketPrices[nCargoIndex];
+      }
+
+      break;
+    }
+    case UPGRADE_EVENT_ID: {
+      pContext->nShipCargoLimit = getShipUpgradedCargoLimit(pContext->nShipCargoLimit);
+
+      break;
+    }
+    case VOYAGE_EVENT_ID: {
+      pContext->cPortId = pGameEvent->cPortId;
+      pContext->nPlayerTurns++;
+
+      break;
+    }
+  }
+}
+
+/**
+ * Opens a new event log file for writing, replacing any file with the same path.
+ * @param[out] pWriter The writer.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the file was opened or `0` if it could not be.
+ */
+int openEventLogWriter(EventLogWriter *pWriter, const char *strFilePath) {
+  pWriter->pFile = fopen(strFilePath, "wb");
+
+  if (pWriter->pFile == NULL) return 0;
+
+  memcpy(pWriter->aucBuffer, EVENT_LOG_MAGIC, strlen(EVENT_LOG_MAGIC));
+  pWriter->aucBuffer[strlen(EVENT_LOG_MAGIC)] = EVENT_LOG_VERSION;
+  pWriter->nBufferSize = strlen(EVENT_LOG_MAGIC) + 1;
+  pWriter->llEventAmount = 0;
+
+  GameEvent sGameEvent = {0};
+
+  sGameEvent.cEventId = GAME_START_EVENT_ID;
+
+  updateEventLogContext(&pWriter->sContext, &sGameEvent);
+
+  return 1;
+}
+
+/**
+ * Writes an event to an event log, flushing the writer's buffer to the file when it is nearly full.
+ * @param[out] pWriter The writer.
+ * @param pGameEvent The event. Only the fields that are not filled in by the reader are written.
+ * @pre Every game's events must start with a game start event.
+ * @returns `1` if the event was written or `0` if the file could not be written to or the event's kind, price source,
+ * cargo, or port is unknown.
+ */
+int writeGameEvent(EventLogWriter *pWriter, const GameEvent *pGameEvent) {
+  if (pWriter->nBufferSize > EVENT_LOG_BUFFER_SIZE - EVENT_LOG_MAXIMUM_EVENT_SIZE && !flushEventLogWriter(pWriter)) {
+    return 0;
+  }
+
+  EventLogContext *pContext = &pWriter->sContext;
+  unsigned char *aucBytes = &pWriter->aucBuffer[pWriter->nBufferSize];
+  int nKindCode = 0;
+
+  while (nKindCode < (int)sizeof(acEventIds) && acEventIds[nKindCode] != pGameEvent->cEventId) nKindCode++;
+
+  if (nKindCode == (int)sizeof(acEventIds)) return 0;
+
+  int nByteAmount = 1;
+
+  aucBytes[0] = nKindCode;
+
+  switch (pGameEvent->cEventId) {
+    case GAME_START_EVENT_ID: {
+      int nPriceSourceCode = 0;
+
+      while (nPriceSourceCode < (int)sizeof(acPriceSourceIds) &&
+             acPriceSourceIds[nPriceSourceCode] != pGameEvent->cPriceSourceId) {
+        nPriceSourceCode++;
+      }
+
+      if (nPriceSourceCode == (int)sizeof(acPriceSourceIds)) return 0;
+
+      aucBytes[0] |= nPriceSourceCode << EVENT_KIND_BIT_AMOUNT;
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount], pGameEvent->ullSeed);
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount], encodeZigzag(pGameEvent->nPlayerId));
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount], encodeZigzag(pGameEvent->nPlayerBalance));
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount], encodeZigzag(pGameEvent->nPlayerProfitTarget));
+
+      break;
+    }
+    case MARKET_EVENT_ID: {
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+        int nPriceDifference =
+          pGameEvent->anMarketPrices[nCargoIndex] - getMinimumMarketPrice(pContext->cPortId, nCargoIndex);
+
+        nByteAmount += encodeVarint(&aucBytes[nByteAmount], encodeZigzag(nPriceDifference));
+      }
+
+      break;
+    }
+    case TRADE_EVENT_ID: {
+      int nCargoIndex = getCargoIndex(pGameEvent->cCargoId);
+
+      if (nCargoIndex < 0) return 0;
+
+      aucBytes[0] |= ((pGameEvent->cActionId == SELL_ACTION_ID) | nCargoIndex << 1) << EVENT_KIND_BIT_AMOUNT;
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount], pGameEvent->nCargoAmount);
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount],
+                                  encodeZigzag(pGameEvent->nCargoPrice - pContext->anMarketPrices[nCargoIndex]));
+
+      break;
+    }
+    case VOYAGE_EVENT_ID: {
+      int nPortIndex = getPortIndex(pGameEvent->cPortId);
+
+      if (nPortIndex < 0) return 0;
+
+      aucBytes[0] |= nPortIndex << EVENT_KIND_BIT_AMOUNT;
+      nByteAmount += encodeStateHash(&aucBytes[nByteAmount], pGameEvent->unStateHash);
+
+      break;
+    }
+    case GAME_END_EVENT_ID: {
+      long long llBalanceDifference = (long long)pGameEvent->nPlayerBalance - pContext->nPlayerInitialBalance;
+
+      nByteAmount += encodeVarint(&aucBytes[nByteAmount], encodeZigzag(llBalanceDifference));
+      nByteAmount += encodeStateHash(&aucBytes[nByteAmount], pGameEvent->unStateHash);
+
+      break;
+    }
+  }
+
+  pWriter->nBufferSize += nByteAmount;
+  pWriter->llEventAmount++;
+
+  updateEventLogContext(pContext, pGameEvent);
+
+  return 1;
+}
+
+/**
+ * Writes the buffer of an event log writer to its file and hands the file's own buffer to the operating system.
+ * @param[out] pWriter The writer.
+ * @returns `1` if the buffer was written or `0` if the file could not be written to.
+ */
+int flushEventLogWriter(EventLogWriter *pWriter) {
+  int bIsWritten =
+    pWriter->nBufferSize == 0 || fwrite(pWriter->aucBuffer, pWriter->nBufferSize, 1, pWriter->pFile) == 1;
+
+  pWriter->nBufferSize = 0;
+
+  return fflush(pWriter->pFile) == 0 && bIsWritten;
+}
+
+/**
+ * Flushes the buffer of an event log writer and closes its file.
+ * @param[out] pWriter The writer.
+ * @returns `1` if every event was written or `0` if the file could not be written to.
+ */
+int closeEventLogWriter(EventLogWriter *pWriter) {
+  int bIsWritten = flushEventLogWriter(pWriter);
+
+  bIsWritten = fclose(pWriter->pFile) == 0 && bIsWritten;
+  pWriter->pFile = NULL;
+
+  return bIsWritten;
+}
+
+/**
+ * Moves the unread bytes of an event log reader's buffer to its start and fills the rest from its file.
+ * @param[out] pReader The reader.
+ */
+static void refillEventLogReader(EventLogReader *pReader) {
+  int nUnreadSize = pReader->nBufferSize - pReader->nBufferPosition;
+
+  memmove(pReader->aucBuffer, &pReader->aucBuffer[pReader->nBufferPosition], nUnreadSize);
+
+  pReader->nBufferPosition = 0;
+  pReader->nBufferSize =
+    nUnreadSize + fread(&pReader->aucBuffer[nUnreadSize], 1, EVENT_LOG_BUFFER_SIZE - nUnreadSize, pReader->pFile);
+}
+
+/**
+ * Reads an unsigned integer with 7 bits per byte from an event log reader's buffer.
+ * @param[out] pReader The reader.
+ * @param[out] pullValue The integer.
+ * @returns `1` if the integer was read or `0` if the buffer ended or the integer is too long.
+ */
+static int readVarint(EventLogReader *pReader, unsigned long long *pullValue) {
+  *pullValue = 0;
+
+  for (int nShift = 0; nShift < 64 && pReader->nBufferPosition < pReader->nBufferSize; nShift += 7) {
+    unsigned char ucByte = pReader->aucBuffer[pReader->nBufferPosition++];
+
+    *pullValue |= (unsigned long long)(ucByte & 0x7F) << nShift;
+
+    if (!(ucByte & 0x80)) return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * Reads a zigzag-encoded integer with 7 bits per byte from an event log reader's buffer.
+ * @param[out] pReader The reader.
+ * @param[out] pnValue The signed integer.
+ * @returns `1` if the integer was read or `0` if the buffer ended or the integer is too long.
+ */
+static int readZigzagVarint(EventLogReader *pReader, int *pnValue) {
+  unsigned long long ullValue;
+
+  if (!readVarint(pReader, &ullValue)) return 0;
+
+  *pnValue = (int)decodeZigzag(ullValue);
+
+  return 1;
+}
+
+/**
+ * Reads a rolling state hash as little-endian bytes from an event log reader's buffer.
+ * @param[out] pReader The reader.
+ * @param[out] punStateHash The hash.
+ * @returns `1` if the hash was read or `0` if the buffer ended.
+ */
+static int readStateHash(EventLogReader *pReader, unsigned int *punStateHash) {
+  if (pReader->nBufferSize - pReader->nBufferPosition < STATE_HASH_SIZE) return 0;
+
+  *punStateHash = 0;
+
+  for (int nByteIndex = 0; nByteIndex < STATE_HASH_SIZE; nByteIndex++) {
+    *punStateHash |= (unsigned int)pReader->aucBuffer[pReader->nBufferPosition++] << (nByteIndex * 8);
+  }
+
+  return 1;
+}
+
+/**
+ * Opens an event log file for reading.
+ * @param[out] pReader The reader.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the file was opened or `0` if it does not exist or is not an event log.
+ */
+int openEventLogReader(EventLogReader *pReader, const char *strFilePath) {
+  pReader->pFile = fopen(strFilePath, "rb");
+
+  if (pReader->pFile == NULL) return 0;
+
+  pReader->nBufferSize = 0;
+  pReader->nBufferPosition = 0;
+  pReader->llEventAmount = 0;
+
+  refillEventLogReader(pReader);
+
+  int nHeaderSize = strlen(EVENT_LOG_MAGIC) + 1;
+
+  if (pReader->nBufferSize < nHeaderSize || memcmp(pReader->aucBuffer, EVENT_LOG_MAGIC, nHeaderSize - 1) != 0 ||
+      pReader->aucBuffer[nHeaderSize - 1] != EVENT_LOG_VERSION) {
+    closeEventLogReader(pReader);
+
+    return 0;
+  }
+
+  pReader->nBufferPosition = nHeaderSize;
+
+  GameEvent sGameEvent = {0};
+
+  sGameEvent.cEventId = GAME_START_EVENT_ID;
+
+  updateEventLogContext(&pReader->sContext, &sGameEvent);
+
+  return 1;
+}
+
+/**
+ * Reads the next event from an event log.
+ * @param[out] pReader The reader.
+ * @param[out] pGameEvent The event, including the fields that are filled in by the reader.
+ * @returns `1` if an event was read, `0` if there are no events left, or `-1` if the log is corrupted.
+ */
+int readGameEvent(EventLogReader *pReader, GameEvent *pGameEvent) {
+  if (pReader->nBufferSize - pReader->nBufferPosition < EVENT_LOG_MAXIMUM_EVENT_SIZE) refillEventLogReader(pReader);
+
+  if (pReader->nBufferPosition == pReader->nBufferSize) return 0;
+
+  EventLogContext *pContext = &pReader->sContext;
+  unsigned char ucFirstByte = pReader->aucBuffer[pReader->nBufferPosition++];
+  int nKindCode = ucFirstByte & EVENT_KIND_MASK;
+  int nSmallFields = ucFirstByte >> EVENT_KIND_BIT_AMOUNT;
+  int bIsRead = 1;
+
+  if (nKindCode >= (int)sizeof(acEventIds)) return -1;
+
+  pGameEvent->cEventId = acEventIds[nKindCode];
+  pGameEvent->nPlayerTurns = pContext->nPlayerTurns;
+  pGameEvent->cPortId = pContext->cPortId;
+
+  switch (pGameEvent->cEventId) {
+    case GAME_START_EVENT_ID: {
+      if (nSmallFields >= (int)sizeof(acPriceSourceIds)) return -1;
+
+      pGameEvent->cPriceSourceId = acPriceSourceIds[nSmallFields];
+      bIsRead = readVarint(pReader, &pGameEvent->ullSeed) && readZigzagVarint(pReader, &pGameEvent->nPlayerId) &&
+                readZigzagVarint(pReader, &pGameEvent->nPlayerBalance) &&
+                readZigzagVarint(pReader, &pGameEvent->nPlayerProfitTarget);
+      pGameEvent->nPlayerTurns = 0;
+      pGameEvent->cPortId = INITIAL_PORT_ID;
+
+      break;
+    }
+    case MARKET_EVENT_ID: {
+      for (int nCargoIndex = 0; bIsRead && nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+        bIsRead = readZigzagVarint(pReader, &pGameEvent->anMarketPrices[nCargoIndex]);
+        pGameEvent->anMarketPrices[nCargoIndex] += getMinimumMarketPrice(pContext->cPortId, nCargoIndex);
+      }
+
+      break;
+    }
+    case TRADE_EVENT_ID: {
+      unsigned long long ullCargoAmount;
+      int nCargoIndex = nSmallFields >> 1;
+
+      if (nCargoIndex >= CARGO_AMOUNT) return -1;
+
+      pGameEvent->cActionId = nSmallFields & 1 ? SELL_ACTION_ID : BUY_ACTION_ID;
+      pGameEvent->cCargoId = getCargoId(nCargoIndex);
+      bIsRead = readVarint(pReader, &ullCargoAmount) && readZigzagVarint(pReader, &pGameEvent->nCargoPrice);
+      pGameEvent->nCargoAmount = (int)ullCargoAmount;
+      pGameEvent->nCargoPrice += pContext->anMarketPrices[nCargoIndex];
+
+      break;
+    }
+    case UPGRADE_EVENT_ID: {
+      pGameEvent->nShipCargoLimit = getShipUpgradedCargoLimit(pContext->nShipCargoLimit);
+      pGameEvent->nShipUpgradeCost = getShipUpgradeCost(pContext->nShipCargoLimit);
+
+      break;
+    }
+    case VOYAGE_EVENT_ID: {
+      if (nSmallFields >= PORT_AMOUNT) return -1;
+
+      pGameEvent->cPortId = getPortId(nSmallFields);
+      bIsRead = readStateHash(pReader, &pGameEvent->unStateHash);
+
+      break;
+    }
+    case GAME_END_EVENT_ID: {
+      bIsRead = readZigzagVarint(pReader, &pGameEvent->nPlayerBalance);
+      pGameEvent->nPlayerBalance += pContext->nPlayerInitialBalance;
+      bIsRead = bIsRead && readStateHash(pReader, &pGameEvent->unStateHash);
+
+      break;
+    }
+  }
+
+  if (!bIsRead) return -1;
+
+  pReader->llEventAmount++;
+
+  updateEventLogContext(pContext, pGameEvent);
+
+  return 1;
+}
+
+/**
+ * Closes the file of an event log reader.
+ * @param[out] pReader The reader.
+ */
+void closeEventLogReader(EventLogReader *pReader) {
+  if (pReader->pFile != NULL) fclose(pReader->pFile);
+
+  pReader->pFile = NULL;
+}
+
+/**
+ * Rolls the hash of a game's state into the hashes of the states before it.
+ * @param unStateHash The rolling hash so far, which is `0` at the start of a game.
+ * @param pGameState The state of the game.
+ * @returns The updated rolling hash.
+ */
+unsigned int rollGameStateHash(unsigned int unStateHash, const GameState *pGameState) {
+  unsigned long long ullHash = hashGameState(pGameState) ^ (unStateHash * 0x9E3779B97F4A7C15ULL);
+
+  return (unsigned int)(ullHash ^ (ullHash >> 32));
+}
+
+/**
+ * Sets up an event from an action done in a game, before the action is applied. For a navigation, the state is also
+ * rolled into the event's rolling state hash, which must be kept from the game's previous events.
+ * @param pGameState The state of the game before the action.
+ * @param pGameAction The action, which must be a buy, sell, upgrade, or navigation.
+ * @param[out] pGameEvent The event.
+ */
+void setGameActionEvent(const GameState *pGameState, const GameAction *pGameAction, GameEvent *pGameEvent) {
+  pGameEvent->nPlayerTurns = pGameState->nPlayerTurns;
+  pGameEvent->cPortId = pGameState->cPortId;
+
+  switch (pGameAction->cActionId) {
+    case BUY_ACTION_ID:
+    case SELL_ACTION_ID: {
+      pGameEvent->cEventId = TRADE_EVENT_ID;
+      pGameEvent->cActionId = pGameAction->cActionId;
+      pGameEvent->cCargoId = pGameAction->cCargoId;
+      pGameEvent->nCargoAmount = pGameAction->nCargoAmount;
+      pGameEvent->nCargoPrice = pGameState->anMarketPrices[getCargoIndex(pGameAction->cCargoId)];
+
+      break;
+    }
+    case UPGRADE_ACTION_ID: {
+      pGameEvent->cEventId = UPGRADE_EVENT_ID;
+      pGameEvent->nShipCargoLimit = getShipUpgradedCargoLimit(pGameState->nShipCargoLimit);
+      pGameEvent->nShipUpgradeCost = getShipUpgradeCost(pGameState->nShipCargoLimit);
+
+      break;
+    }
+    // Set to default instead of 'N' to satisfy the compiler
+    default: {
+      pGameEvent->cEventId = VOYAGE_EVENT_ID;
+      pGameEvent->cPortId = pGameAction->cPortId;
+      pGameEvent->unStateHash = rollGameStateHash(pGameEvent->unStateHash, pGameState);
+
+      break;
+    }
+  }
+}
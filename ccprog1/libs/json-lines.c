@@ -0,0 +1,208 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "json-lines.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// The closing brace and the line break are always given room at the end of the buffer.
+#define JSON_LINE_END_SIZE 2
+
+/**
+ * Appends raw characters to a JSON object, or marks it as overflowed if they do not fit.
+ * @param[out] pJsonLine The JSON object.
+ * @param acCharacters The characters.
+ * @param nCharacterAmount The number of characters.
+ * @returns `1` if the characters were appended or `0` if they did not fit.
+ */
+static int appendJsonCharacters(JsonLine *pJsonLine, const char acCharacters[], int nCharacterAmount) {
+  if (pJsonLine->nSize + nCharacterAmount > JSON_LINE_BUFFER_SIZE - JSON_LINE_END_SIZE) {
+    pJsonLine->bHasOverflowed = 1;
+
+    return 0;
+  }
+
+  memcpy(&pJsonLine->acBuffer[pJsonLine->nSize], acCharacters, nCharacterAmount);
+  pJsonLine->nSize += nCharacterAmount;
+
+  return 1;
+}
+
+/**
+ * Appends an integer to a JSON object in decimal.
+ * @param[out] pJsonLine The JSON object.
+ * @param llValue The integer.
+ * @returns `1` if the integer was appended or `0` if it did not fit.
+ */
+static int appendJsonInteger(JsonLine *pJsonLine, long long llValue) {
+  // Enough for the sign and the 20 digits of the largest magnitude.
+  char acDigits[21];
+  int nDigitPosition = sizeof(acDigits);
+  unsigned long long ullMagnitude = llValue < 0 ? 0ULL - (unsigned long long)llValue : (unsigned long long)llValue;
+
+  do {
+    acDigits[--nDigitPosition] = (char)('0' + ullMagnitude % 10);
+    ullMagnitude /= 10;
+  } while (ullMagnitude > 0);
+
+  if (llValue < 0) acDigits[--nDigitPosition] = '-';
+
+  return appendJsonCharacters(pJsonLine, &acDigits[nDigitPosition], sizeof(acDigits) - nDigitPosition);
+}
+
+/**
+ * Appends the separator and the key of a new field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key.
+ * @returns The size of the JSON object before the field, which the field is rolled back to if its value does not fit.
+ */
+static int appendJsonKey(JsonLine *pJsonLine, const char *strKey) {
+  int nFieldStart = pJsonLine->nSize;
+
+  if (pJsonLine->bHasField) appendJsonCharacters(pJsonLine, ",", 1);
+
+  appendJsonCharacters(pJsonLine, "\"", 1);
+  appendJsonCharacters(pJsonLine, strKey, (int)strlen(strKey));
+  appendJsonCharacters(pJsonLine, "\":", 2);
+
+  return nFieldStart;
+}
+
+/**
+ * Ends a field of a JSON object, dropping the whole field if any part of it did not fit.
+ * @param[out] pJsonLine The JSON object.
+ * @param nFieldStart The size of the JSON object before the field.
+ */
+static void endJsonField(JsonLine *pJsonLine, int nFieldStart) {
+  if (pJsonLine->bHasOverflowed) {
+    pJsonLine->nSize = nFieldStart;
+  } else {
+    pJsonLine->bHasField = 1;
+  }
+}
+
+/**
+ * Starts a new JSON object.
+ * @param[out] pJsonLine The JSON object.
+ */
+void beginJsonLine(JsonLine *pJsonLine) {
+  pJsonLine->acBuffer[0] = '{';
+  pJsonLine->nSize = 1;
+  pJsonLine->bHasField = 0;
+  pJsonLine->bHasOverflowed = 0;
+}
+
+/**
+ * Adds an integer field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param llValue The field's value.
+ */
+void addJsonIntegerField(JsonLine *pJsonLine, const char *strKey, long long llValue) {
+  int nFieldStart = appendJsonKey(pJsonLine, strKey);
+
+  appendJsonInteger(pJsonLine, llValue);
+  endJsonField(pJsonLine, nFieldStart);
+}
+
+/**
+ * Adds a boolean field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param bValue The field's value.
+ */
+void addJsonBooleanField(JsonLine *pJsonLine, const char *strKey, int bValue) {
+  int nFieldStart = appendJsonKey(pJsonLine, strKey);
+
+  if (bValue) {
+    appendJsonCharacters(pJsonLine, "true", 4);
+  } else {
+    appendJsonCharacters(pJsonLine, "false", 5);
+  }
+
+  endJsonField(pJsonLine, nFieldStart);
+}
+
+/**
+ * Adds a string field to a JSON object, escaping the string's quotes, backslashes, and control characters.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param strValue The field's value.
+ */
+void addJsonStringField(JsonLine *pJsonLine, const char *strKey, const char *strValue) {
+  static const char acHexDigits[] = "0123456789abcdef";
+  int nFieldStart = appendJsonKey(pJsonLine, strKey);
+
+  appendJsonCharacters(pJsonLine, "\"", 1);
+
+  for (const char *pcCharacter = strValue; *pcCharacter != '\0'; pcCharacter++) {
+    unsigned char ucCharacter = (unsigned char)*pcCharacter;
+
+    if (ucCharacter == '"' || ucCharacter == '\\') {
+      char acEscape[2] = {'\\', (char)ucCharacter};
+
+      appendJsonCharacters(pJsonLine, acEscape, 2);
+    } else if (ucCharacter < 0x20) {
+      char acEscape[6] = {'\\', 'u', '0', '0', acHexDigits[ucCharacter >> 4], acHexDigits[ucCharacter & 0xF]};
+
+      appendJsonCharacters(pJsonLine, acEscape, 6);
+    } else {
+      appendJsonCharacters(pJsonLine, (const char *)&ucCharacter, 1);
+    }
+  }
+
+  appendJsonCharacters(pJsonLine, "\"", 1);
+  endJsonField(pJsonLine, nFieldStart);
+}
+
+/**
+ * Adds a field to a JSON object whose value is a string of a single character, such as a port's or cargo's ID.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param cValue The field's value.
+ */
+void addJsonCharacterField(JsonLine *pJsonLine, const char *strKey, char cValue) {
+  char strValue[2] = {cValue, '\0'};
+
+  addJsonStringField(pJsonLine, strKey, strValue);
+}
+
+/**
+ * Adds an array of integers field to a JSON object.
+ * @param[out] pJsonLine The JSON object.
+ * @param strKey The field's key, which must not need escaping.
+ * @param anValues The field's values.
+ * @param nValueAmount The number of values.
+ */
+void addJsonIntegerArrayField(JsonLine *pJsonLine, const char *strKey, const int anValues[], int nValueAmount) {
+  int nFieldStart = appendJsonKey(pJsonLine, strKey);
+
+  appendJsonCharacters(pJsonLine, "[", 1);
+
+  for (int nValueIndex = 0; nValueIndex < nValueAmount; nValueIndex++) {
+    if (nValueIndex > 0) appendJsonCharacters(pJsonLine, ",", 1);
+
+    appendJsonInteger(pJsonLine, anValues[nValueIndex]);
+  }
+
+  appendJsonCharacters(pJsonLine, "]", 1);
+  endJsonField(pJsonLine, nFieldStart);
+}
+
+/**
+ * Ends a JSON object and writes it out as a single line.
+ * @param[out] pJsonLine The JSON object.
+ * @param[out] pStream The stream to write the line to.
+ * @returns `1` if the whole object was written or `0` if a field was dropped or the stream could not be written to.
+ */
+int writeJsonLine(JsonLine *pJsonLine, FILE *pStream) {
+  pJsonLine->acBuffer[pJsonLine->nSize++] = '}';
+  pJsonLine->acBuffer[pJsonLine->nSize++] = '\n';
+
+  return fwrite(pJsonLine->acBuffer, pJsonLine->nSize, 1, pStream) == 1 && !pJsonLine->bHasOverflowed;
+}
@@ -0,0 +1,253 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose sigaction() and isatty() from the POSIX standard.
+#define _POSIX_C_SOURCE 200809L
+
+#include "layout.h"
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#define SEPARATOR_CHARACTER "━"
+
+/** A template that has been moved for a console width, which is reused until the width changes. */
+typedef struct LayoutTemplate {
+  const char *strTemplate;
+  char *strLaidOutTemplate;
+  int nLayoutGeneration;
+} LayoutTemplate;
+
+static int nForcedLayoutWidth = 0;
+static int nLayoutWidth = 0;
+static int nLayoutShiftSize = 0;
+// Incremented whenever the width changes, which invalidates every cached template.
+static int nLayoutGeneration = 0;
+static char *strLayoutSeparator = NULL;
+static LayoutTemplate asLayoutTemplates[LAYOUT_TEMPLATE_CACHE_SIZE];
+static volatile sig_atomic_t bLayoutIsStale = 1;
+
+/**
+ * Marks the layout to be computed again before the next screen is printed.
+ * @param nSignal The received signal, which is always `SIGWINCH`.
+ */
+static void markLayoutStale(int nSignal) {
+  (void)nSignal;
+
+  bLayoutIsStale = 1;
+}
+
+/**
+ * Reads the width of the terminal, and starts listening for it being resized.
+ * @returns The number of columns in the terminal, or `156` if the output is not a terminal.
+ */
+static int detectLayoutWidth(void) {
+  static int bResizeIsHandled = 0;
+  struct winsize sWindowSize;
+
+  if (!isatty(STDOUT_FILENO) || ioctl(STDOUT_FILENO, TIOCGWINSZ, &sWindowSize) != 0 || sWindowSize.ws_col == 0) {
+    return MAX_PRINT_WIDTH;
+  }
+
+  if (!bResizeIsHandled) {
+    struct sigaction sAction;
+
+    memset(&sAction, 0, sizeof(sAction));
+    sAction.sa_handler = markLayoutStale;
+    // Resizing while the player is typing must not interrupt the input.
+    sAction.sa_flags = SA_RESTART;
+    sigemptyset(&sAction.sa_mask);
+
+    bResizeIsHandled = sigaction(SIGWINCH, &sAction, NULL) == 0;
+  }
+
+  return sWindowSize.ws_col;
+}
+
+/** Computes the layout again if the terminal has been resized since it was last computed. */
+static void refreshLayout(void) {
+  if (!bLayoutIsStale) return;
+
+  bLayoutIsStale = 0;
+
+  int nWidth = nForcedLayoutWidth > 0 ? nForcedLayoutWidth : detectLayoutWidth();
+
+  if (nWidth > MAXIMUM_LAYOUT_WIDTH) nWidth = MAXIMUM_LAYOUT_WIDTH;
+
+  // Resizing only the terminal's height keeps every cached template.
+  if (nWidth == nLayoutWidth) return;
+
+  int nSeparatorCharacterSize = (int)strlen(SEPARATOR_CHARACTER);
+  char *strSeparator = realloc(strLayoutSeparator, (size_t)nWidth * nSeparatorCharacterSize + 1);
+
+  if (strSeparator == NULL) return;
+
+  for (int nColumn = 0; nColumn < nWidth; nColumn++) {
+    memcpy(strSeparator + nColumn * nSeparatorCharacterSize, SEPARATOR_CHARACTER, nSeparatorCharacterSize);
+  }
+
+  strSeparator[nWidth * nSeparatorCharacterSize] = '\0';
+
+  strLayoutSeparator = strSeparator;
+  nLayoutWidth = nWidth;
+  nLayoutShiftSize = (nWidth - MAX_PRINT_WIDTH) / 2;
+  nLayoutGeneration++;
+}
+
+/**
+ * Gets the number of spaces that the least indented line of a template starts with.
+ * @param strTemplate The template.
+ * @returns The smallest indentation, or `0` if no line is indented.
+ */
+static int getTemplateIndentationSize(const char *strTemplate) {
+  int nMinimumIndentationSize = 0;
+  const char *pcCharacter = strTemplate;
+
+  while (*pcCharacter != '\0') {
+    int nIndentationSize = 0;
+
+    while (pcCharacter[nIndentationSize] == ' ') nIndentationSize++;
+
+    if (nIndentationSize > 0 && (nMinimumIndentationSize == 0 || nIndentationSize < nMinimumIndentationSize)) {
+      nMinimumIndentationSize = nIndentationSize;
+    }
+
+    while (*pcCharacter != '\0' && *pcCharacter++ != '\n') continue;
+  }
+
+  return nMinimumIndentationSize;
+}
+
+/**
+ * Moves every indented line of a template by the same number of columns. A template is never moved past the left edge,
+ * so that the lines of a box stay aligned in narrow consoles.
+ * @param strTemplate The template.
+ * @param nShiftSize The number of columns to move the lines to the right, or to the left if negative.
+ * @returns The moved template, which must be freed, or `NULL` if it could not be allocated.
+ */
+static char *moveTemplate(const char *strTemplate, int nShiftSize) {
+  int nLineAmount = 1;
+  int nIndentationSize = getTemplateIndentationSize(strTemplate);
+
+  if (nShiftSize < -nIndentationSize) nShiftSize = -nIndentationSize;
+
+  for (const char *pcCharacter = strTemplate; *pcCharacter != '\0'; pcCharacter++) {
+    if (*pcCharacter == '\n') nLineAmount++;
+  }
+
+  size_t nMaximumSize = strlen(strTemplate) + (nShiftSize > 0 ? (size_t)nLineAmount * nShiftSize : 0) + 1;
+  char *strMovedTemplate = malloc(nMaximumSize);
+
+  if (strMovedTemplate == NULL) return NULL;
+
+  const char *pcCharacter = strTemplate;
+  char *pcMovedCharacter = strMovedTemplate;
+
+  while (*pcCharacter != '\0') {
+    // Only indented lines are art, while the rest are either empty or continue a line.
+    if (*pcCharacter == ' ') {
+      if (nShiftSize > 0) {
+        memset(pcMovedCharacter, ' ', nShiftSize);
+        pcMovedCharacter += nShiftSize;
+      } else {
+        pcCharacter -= nShiftSize;
+      }
+    }
+
+    while (*pcCharacter != '\0' && *pcCharacter != '\n') *pcMovedCharacter++ = *pcCharacter++;
+
+    if (*pcCharacter == '\n') *pcMovedCharacter++ = *pcCharacter++;
+  }
+
+  *pcMovedCharacter = '\0';
+
+  return strMovedTemplate;
+}
+
+/**
+ * Overrides the detection of the console's width, which is otherwise read from the terminal.
+ * @param nWidth The number of columns to lay the screens out for, or `0` to detect it again.
+ */
+void setLayoutWidth(int nWidth) {
+  nForcedLayoutWidth = nWidth;
+  bLayoutIsStale = 1;
+}
+
+/**
+ * Gets the number of columns that the screens are laid out for. The width is read from the terminal once, and only
+ * read again after the terminal has been resized. It is `156` if the output is not a terminal.
+ * @returns An integer value within the range of `1` and `1024`.
+ */
+int getLayoutWidth(void) {
+  refreshLayout();
+
+  return nLayoutWidth > 0 ? nLayoutWidth : MAX_PRINT_WIDTH;
+}
+
+/**
+ * Gets the left padding that centers text in the console, from the padding that centered it in `156` columns.
+ * @param nDesignPaddingSize The number of spaces that centered the text in `156` columns.
+ * @returns An integer value greater than or equal to `0`.
+ */
+int getLayoutPaddingSize(int nDesignPaddingSize) {
+  refreshLayout();
+
+  return nDesignPaddingSize + nLayoutShiftSize > 0 ? nDesignPaddingSize + nLayoutShiftSize : 0;
+}
+
+/**
+ * Gets a separator line that spans the console's width.
+ * @returns The separator line, which is reused until the width changes.
+ */
+const char *getLayoutSeparator(void) {
+  refreshLayout();
+
+  return strLayoutSeparator != NULL ? strLayoutSeparator : "";
+}
+
+/**
+ * Gets a multi-line template, drawn for `156` columns, with every indented line moved to center it in the console. The
+ * lines are moved together, but never past the left edge. The moved templates are cached and reused, so every template
+ * is only moved once for every width.
+ * @param strTemplate The template, which must be a string literal or otherwise never be freed.
+ * @returns The moved template, or @p strTemplate itself if it does not have to be moved.
+ */
+const char *getLayoutTemplate(const char *strTemplate) {
+  refreshLayout();
+
+  if (nLayoutShiftSize == 0) return strTemplate;
+
+  // Templates are identified by their address, which is probed linearly from its hash.
+  int nSlotIndex = (int)((uintptr_t)strTemplate % LAYOUT_TEMPLATE_CACHE_SIZE);
+
+  for (int nProbeAmount = 0; nProbeAmount < LAYOUT_TEMPLATE_CACHE_SIZE; nProbeAmount++) {
+    LayoutTemplate *pLayoutTemplate = &asLayoutTemplates[(nSlotIndex + nProbeAmount) % LAYOUT_TEMPLATE_CACHE_SIZE];
+
+    if (pLayoutTemplate->strTemplate != NULL && pLayoutTemplate->strTemplate != strTemplate) continue;
+
+    if (pLayoutTemplate->strTemplate == NULL || pLayoutTemplate->nLayoutGeneration != nLayoutGeneration) {
+      char *strLaidOutTemplate = moveTemplate(strTemplate, nLayoutShiftSize);
+
+      if (strLaidOutTemplate == NULL) return strTemplate;
+
+      free(pLayoutTemplate->strLaidOutTemplate);
+
+      pLayoutTemplate->strTemplate = strTemplate;
+      pLayoutTemplate->strLaidOutTemplate = strLaidOutTemplate;
+      pLayoutTemplate->nLayoutGeneration = nLayoutGeneration;
+    }
+
+    return pLayoutTemplate->strLaidOutTemplate;
+  }
+
+  // Templates that do not fit in the cache are printed as they were drawn.
+  return strTemplate;
+}
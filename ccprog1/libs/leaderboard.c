@@ -0,0 +1,327 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose mmap(), fstat(), and ftruncate() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "leaderboard.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "prompts.h"
+
+#define LEADERBOARD_STALE_UPDATE_AMOUNT (~0ULL)
+
+/**
+ * Gets the best profit in a merchant's record.
+ * @param ullBestProfitAndGames The record's best profit and number of games.
+ * @returns The best profit, which is meaningless if the merchant has not played yet.
+ */
+static int getRecordBestProfit(unsigned long long ullBestProfitAndGames) {
+  return (int)(unsigned int)(ullBestProfitAndGames >> 32);
+}
+
+/**
+ * Gets the number of games in a merchant's record.
+ * @param ullBestProfitAndGames The record's best profit and number of games.
+ * @returns An integer value greater than or equal to `0`.
+ */
+static int getRecordGameAmount(unsigned long long ullBestProfitAndGames) {
+  return (int)(unsigned int)(ullBestProfitAndGames & 0xFFFFFFFFULL);
+}
+
+/**
+ * Checks whether a merchant ranks above another, by their best profit and then by their merchant ID.
+ * @param pLeaderboard The leaderboard.
+ * @param nPlayerId The merchant ID.
+ * @param nOtherPlayerId The other merchant ID.
+ * @returns `1` if the merchant ranks above the other or `0` if they do not.
+ */
+static int isLeaderboardEntryBetter(const Leaderboard *pLeaderboard, int nPlayerId, int nOtherPlayerId) {
+  const LeaderboardRecord *asRecords = pLeaderboard->pFile->asRecords;
+  int nBestProfit = getRecordBestProfit(
+    __atomic_load_n(&asRecords[nPlayerId - MINIMUM_PLAYER_ID_VALUE].ullBestProfitAndGames, __ATOMIC_RELAXED));
+  int nOtherBestProfit = getRecordBestProfit(
+    __atomic_load_n(&asRecords[nOtherPlayerId - MINIMUM_PLAYER_ID_VALUE].ullBestProfitAndGames, __ATOMIC_RELAXED));
+
+  return nBestProfit > nOtherBestProfit || (nBestProfit == nOtherBestProfit && nPlayerId < nOtherPlayerId);
+}
+
+/**
+ * Swaps two merchants in a leaderboard's heap.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param nIndex The index of one merchant.
+ * @param nOtherIndex The index of the other merchant.
+ */
+static void swapLeaderboardTop(Leaderboard *pLeaderboard, int nIndex, int nOtherIndex) {
+  int nPlayerId = pLeaderboard->anTopPlayerIds[nIndex];
+
+  pLeaderboard->anTopPlayerIds[nIndex] = pLeaderboard->anTopPlayerIds[nOtherIndex];
+  pLeaderboard->anTopPlayerIds[nOtherIndex] = nPlayerId;
+  pLeaderboard->anTopIndices[pLeaderboard->anTopPlayerIds[nIndex] - MINIMUM_PLAYER_ID_VALUE] = nIndex;
+  pLeaderboard->anTopIndices[nPlayerId - MINIMUM_PLAYER_ID_VALUE] = nOtherIndex;
+}
+
+/**
+ * Moves a merchant towards the root of a leaderboard's heap while they rank below their parent.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param nIndex The merchant's index in the heap.
+ */
+static void siftLeaderboardTopUp(Leaderboard *pLeaderboard, int nIndex) {
+  while (nIndex > 0) {
+    int nParentIndex = (nIndex - 1) / 2;
+
+    if (!isLeaderboardEntryBetter(pLeaderboard, pLeaderboard->anTopPlayerIds[nParentIndex],
+                                  pLeaderboard->anTopPlayerIds[nIndex])) {
+      return;
+    }
+
+    swapLeaderboardTop(pLeaderboard, nIndex, nParentIndex);
+
+    nIndex = nParentIndex;
+  }
+}
+
+/**
+ * Moves a merchant away from the root of a leaderboard's heap while they rank above either of their children.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param nIndex The merchant's index in the heap.
+ */
+static void siftLeaderboardTopDown(Leaderboard *pLeaderboard, int nIndex) {
+  for (;;) {
+    int nWorstIndex = nIndex;
+
+    for (int nChildIndex = 2 * nIndex + 1; nChildIndex <= 2 * nIndex + 2; nChildIndex++) {
+      if (nChildIndex < pLeaderboard->nTopPlayerAmount &&
+          isLeaderboardEntryBetter(pLeaderboard, pLeaderboard->anTopPlayerIds[nWorstIndex],
+                                   pLeaderboard->anTopPlayerIds[nChildIndex])) {
+        nWorstIndex = nChildIndex;
+      }
+    }
+
+    if (nWorstIndex == nIndex) return;
+
+    swapLeaderboardTop(pLeaderboard, nIndex, nWorstIndex);
+
+    nIndex = nWorstIndex;
+  }
+}
+
+/**
+ * Brings a merchant's place in a leaderboard's heap up to date after their best profit rose or they played their
+ * first game. A best profit never falls, so a merchant only ever moves towards the bottom of the heap or into it.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param nPlayerId The merchant ID.
+ */
+static void updateLeaderboardTop(Leaderboard *pLeaderboard, int nPlayerId) {
+  int nIndex = pLeaderboard->anTopIndices[nPlayerId - MINIMUM_PLAYER_ID_VALUE];
+
+  if (nIndex >= 0) {
+    siftLeaderboardTopDown(pLeaderboard, nIndex);
+  } else if (pLeaderboard->nTopPlayerAmount < pLeaderboard->nTopAmount) {
+    nIndex = pLeaderboard->nTopPlayerAmount++;
+
+    pLeaderboard->anTopPlayerIds[nIndex] = nPlayerId;
+    pLeaderboard->anTopIndices[nPlayerId - MINIMUM_PLAYER_ID_VALUE] = nIndex;
+
+    siftLeaderboardTopUp(pLeaderboard, nIndex);
+  } else if (isLeaderboardEntryBetter(pLeaderboard, nPlayerId, pLeaderboard->anTopPlayerIds[0])) {
+    // Replace the merchant with the worst profit, who is at the root.
+    pLeaderboard->anTopIndices[pLeaderboard->anTopPlayerIds[0] - MINIMUM_PLAYER_ID_VALUE] = -1;
+    pLeaderboard->anTopPlayerIds[0] = nPlayerId;
+    pLeaderboard->anTopIndices[nPlayerId - MINIMUM_PLAYER_ID_VALUE] = 0;
+
+    siftLeaderboardTopDown(pLeaderboard, 0);
+  }
+}
+
+/**
+ * Rebuilds a leaderboard's heap from every record in its file.
+ * @param[out] pLeaderboard The leaderboard.
+ */
+static void rebuildLeaderboardTop(Leaderboard *pLeaderboard) {
+  // Read the update amount first, so that a game recorded during the rebuild makes the next query rebuild again.
+  pLeaderboard->ullSeenUpdateAmount = __atomic_load_n(&pLeaderboard->pFile->ullUpdateAmount, __ATOMIC_ACQUIRE);
+
+  for (int nIndex = 0; nIndex < pLeaderboard->nTopPlayerAmount; nIndex++) {
+    pLeaderboard->anTopIndices[pLeaderboard->anTopPlayerIds[nIndex] - MINIMUM_PLAYER_ID_VALUE] = -1;
+  }
+
+  pLeaderboard->nTopPlayerAmount = 0;
+
+  for (int nPlayerId = MINIMUM_PLAYER_ID_VALUE; nPlayerId <= MAXIMUM_PLAYER_ID_VALUE; nPlayerId++) {
+    const LeaderboardRecord *pRecord = &pLeaderboard->pFile->asRecords[nPlayerId - MINIMUM_PLAYER_ID_VALUE];
+
+    if (getRecordGameAmount(__atomic_load_n(&pRecord->ullBestProfitAndGames, __ATOMIC_RELAXED)) > 0) {
+      updateLeaderboardTop(pLeaderboard, nPlayerId);
+    }
+  }
+}
+
+/**
+ * Opens a leaderboard file, creating it if it does not exist, and maps it into memory. Its top merchants are only
+ * gathered once they are first asked for.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param strFilePath The path of the file.
+ * @param nTopAmount The number of merchants to keep the best of.
+ * @pre @p nTopAmount must have an integer value within the range of `1` and `16`.
+ * @returns `1` if the file was opened or `0` if it could not be or is not a leaderboard file.
+ */
+int openLeaderboard(Leaderboard *pLeaderboard, const char *strFilePath, int nTopAmount) {
+  static const char acEmptyMagic[sizeof(LEADERBOARD_FILE_MAGIC) - 1] = {0};
+  int nFileDescriptor = open(strFilePath, O_RDWR | O_CREAT, 0644);
+  struct stat sFileStatus;
+  void *pMemory = MAP_FAILED;
+
+  if (nFileDescriptor < 0) return 0;
+
+  // A new file is zeroed when it is first extended, even if several processes extend it at once.
+  if (fstat(nFileDescriptor, &sFileStatus) == 0 &&
+      (sFileStatus.st_size == sizeof(LeaderboardFile) ||
+       (sFileStatus.st_size == 0 && ftruncate(nFileDescriptor, sizeof(LeaderboardFile)) == 0))) {
+    pMemory = mmap(NULL, sizeof(LeaderboardFile), PROT_READ | PROT_WRITE, MAP_SHARED, nFileDescriptor, 0);
+  }
+
+  close(nFileDescriptor);
+
+  if (pMemory == MAP_FAILED) return 0;
+
+  LeaderboardFile *pFile = pMemory;
+
+  // Every process that finds the header empty writes the same one, so they never have to agree on who writes it.
+  if (memcmp(pFile->acMagic, acEmptyMagic, sizeof(pFile->acMagic)) == 0) {
+    pFile->nVersion = LEADERBOARD_FILE_VERSION;
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(pFile->acMagic, LEADERBOARD_FILE_MAGIC, sizeof(pFile->acMagic));
+  }
+
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+  if (memcmp(pFile->acMagic, LEADERBOARD_FILE_MAGIC, sizeof(pFile->acMagic)) != 0 ||
+      pFile->nVersion != LEADERBOARD_FILE_VERSION) {
+    munmap(pMemory, sizeof(LeaderboardFile));
+
+    return 0;
+  }
+
+  pLeaderboard->pFile = pFile;
+  pLeaderboard->nTopAmount = nTopAmount;
+  pLeaderboard->nTopPlayerAmount = 0;
+
+  // Leave the heap out of date, so that it is only built if the top merchants are asked for, and a process that only
+  // records a game never has to read every record. No file is ever updated this many times.
+  pLeaderboard->ullSeenUpdateAmount = LEADERBOARD_STALE_UPDATE_AMOUNT;
+
+  for (int nPlayerIndex = 0; nPlayerIndex < LEADERBOARD_RECORD_AMOUNT; nPlayerIndex++) {
+    pLeaderboard->anTopIndices[nPlayerIndex] = -1;
+  }
+
+  return 1;
+}
+
+/**
+ * Records a finished game on a leaderboard, without ever waiting for another process.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param nPlayerId The player's merchant ID.
+ * @pre @p nPlayerId must have an integer value within the range of `0` and `999`.
+ * @param nPlayerProfit The profit the player made.
+ * @param nPlayerTurns The number of turns the player took.
+ */
+void recordLeaderboardGame(Leaderboard *pLeaderboard, int nPlayerId, int nPlayerProfit, int nPlayerTurns) {
+  LeaderboardRecord *pRecord = &pLeaderboard->pFile->asRecords[nPlayerId - MINIMUM_PLAYER_ID_VALUE];
+  unsigned long long ullBestProfitAndGames = __atomic_load_n(&pRecord->ullBestProfitAndGames, __ATOMIC_RELAXED);
+  unsigned long long ullNewBestProfitAndGames;
+
+  // Retry only if another process recorded a game for the same merchant in between.
+  do {
+    int nBestProfit = getRecordBestProfit(ullBestProfitAndGames);
+    int nGameAmount = getRecordGameAmount(ullBestProfitAndGames);
+
+    if (nGameAmount == 0 || nPlayerProfit > nBestProfit) nBestProfit = nPlayerProfit;
+
+    ullNewBestProfitAndGames = (unsigned long long)(unsigned int)nBestProfit << 32 | (unsigned int)(nGameAmount + 1);
+  } while (!__atomic_compare_exchange_n(&pRecord->ullBestProfitAndGames, &ullBestProfitAndGames,
+                                        ullNewBestProfitAndGames, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+  __atomic_fetch_add(&pRecord->llTotalTurns, nPlayerTurns, __ATOMIC_RELAXED);
+
+  // Only update the heap in place if no other process has recorded a game since it was last brought up to date.
+  unsigned long long ullUpdateAmount = __atomic_fetch_add(&pLeaderboard->pFile->ullUpdateAmount, 1, __ATOMIC_ACQ_REL);
+
+  if (ullUpdateAmount == pLeaderboard->ullSeenUpdateAmount) {
+    pLeaderboard->ullSeenUpdateAmount = ullUpdateAmount + 1;
+
+    updateLeaderboardTop(pLeaderboard, nPlayerId);
+  }
+}
+
+/**
+ * Reads a merchant's standing on a leaderboard.
+ * @param pLeaderboard The leaderboard.
+ * @param nPlayerId The merchant ID.
+ * @pre @p nPlayerId must have an integer value within the range of `0` and `999`.
+ * @param[out] pEntry The merchant's standing, whose game amount is `0` if they have not played yet.
+ */
+void readLeaderboardEntry(const Leaderboard *pLeaderboard, int nPlayerId, LeaderboardEntry *pEntry) {
+  const LeaderboardRecord *pRecord = &pLeaderboard->pFile->asRecords[nPlayerId - MINIMUM_PLAYER_ID_VALUE];
+  unsigned long long ullBestProfitAndGames = __atomic_load_n(&pRecord->ullBestProfitAndGames, __ATOMIC_RELAXED);
+
+  pEntry->nPlayerId = nPlayerId;
+  pEntry->nGameAmount = getRecordGameAmount(ullBestProfitAndGames);
+  pEntry->nBestProfit = pEntry->nGameAmount > 0 ? getRecordBestProfit(ullBestProfitAndGames) : 0;
+  pEntry->llTotalTurns = __atomic_load_n(&pRecord->llTotalTurns, __ATOMIC_RELAXED);
+}
+
+/**
+ * Gets the merchants with the best profits on a leaderboard, rebuilding the heap first if another process has
+ * recorded a game since it was last brought up to date.
+ * @param[out] pLeaderboard The leaderboard.
+ * @param[out] asEntries The merchants' standings, from the best profit to the worst.
+ * @returns The number of merchants, which is at most the leaderboard's top amount.
+ */
+int getLeaderboardTop(Leaderboard *pLeaderboard, LeaderboardEntry asEntries[LEADERBOARD_MAXIMUM_TOP_AMOUNT]) {
+  if (__atomic_load_n(&pLeaderboard->pFile->ullUpdateAmount, __ATOMIC_ACQUIRE) != pLeaderboard->ullSeenUpdateAmount) {
+    rebuildLeaderboardTop(pLeaderboard);
+  }
+
+  int anPlayerIds[LEADERBOARD_MAXIMUM_TOP_AMOUNT];
+  int nPlayerAmount = pLeaderboard->nTopPlayerAmount;
+
+  // The heap only holds a few merchants, so an insertion sort puts them in order.
+  for (int nIndex = 0; nIndex < nPlayerAmount; nIndex++) {
+    int nPlayerId = pLeaderboard->anTopPlayerIds[nIndex];
+    int nSortedIndex = nIndex;
+
+    for (; nSortedIndex > 0 && isLeaderboardEntryBetter(pLeaderboard, nPlayerId, anPlayerIds[nSortedIndex - 1]);
+         nSortedIndex--) {
+      anPlayerIds[nSortedIndex] = anPlayerIds[nSortedIndex - 1];
+    }
+
+    anPlayerIds[nSortedIndex] = nPlayerId;
+  }
+
+  for (int nIndex = 0; nIndex < nPlayerAmount; nIndex++) {
+    readLeaderboardEntry(pLeaderboard, anPlayerIds[nIndex], &asEntries[nIndex]);
+  }
+
+  return nPlayerAmount;
+}
+
+/**
+ * Unmaps a leaderboard file.
+ * @param[out] pLeaderboard The leaderboard.
+ */
+void closeLeaderboard(Leaderboard *pLeaderboard) {
+  munmap(pLeaderboard->pFile, sizeof(LeaderboardFile));
+
+  pLeaderboard->pFile = NULL;
+}
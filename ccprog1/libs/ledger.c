@@ -0,0 +1,197 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose nanosleep(), fileno(), and fsync() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "ledger.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "events.h"
+
+/**
+ * Sleeps the calling thread.
+ * @param lNanoseconds The number of nanoseconds to sleep for.
+ */
+static void sleepLedgerThread(long lNanoseconds) {
+  struct timespec sDuration = {0, lNanoseconds};
+
+  nanosleep(&sDuration, NULL);
+}
+
+/**
+ * Syncs a ledger's file to the disk.
+ * @param[out] pLedger The ledger.
+ */
+static void syncLedger(Ledger *pLedger) {
+  if (fsync(fileno(pLedger->sWriter.pFile)) != 0) pLedger->bHasFailed = 1;
+
+  pLedger->llSyncAmount++;
+}
+
+/**
+ * Writes every event in a ledger's ring as one batch.
+ * @param[out] pLedger The ledger.
+ * @returns The number of events written.
+ */
+static int writeLedgerBatch(Ledger *pLedger) {
+  // Read the head only after the ring's events are visible, which the game thread publishes with the head.
+  unsigned long long ullHead = __atomic_load_n(&pLedger->ullHead, __ATOMIC_ACQUIRE);
+  unsigned long long ullTail = pLedger->ullTail;
+  int nBatchSize = (int)(ullHead - ullTail);
+  int bHasGameEnd = 0;
+
+  if (nBatchSize == 0) return 0;
+
+  for (; ullTail != ullHead; ullTail++) {
+    const GameEvent *pGameEvent = &pLedger->asEvents[ullTail & (pLedger->nCapacity - 1)];
+
+    if (!writeGameEvent(&pLedger->sWriter, pGameEvent)) pLedger->bHasFailed = 1;
+
+    bHasGameEnd = bHasGameEnd || pGameEvent->cEventId == GAME_END_EVENT_ID;
+
+    // Give the slot back as soon as it has been copied so that a large batch does not fill the ring.
+    __atomic_store_n(&pLedger->ullTail, ullTail + 1, __ATOMIC_RELEASE);
+  }
+
+  if (!flushEventLogWriter(&pLedger->sWriter)) pLedger->bHasFailed = 1;
+
+  if (pLedger->cSyncPolicyId == BATCH_SYNC_POLICY_ID ||
+      (pLedger->cSyncPolicyId == GAME_SYNC_POLICY_ID && bHasGameEnd)) {
+    syncLedger(pLedger);
+  }
+
+  pLedger->llWrittenAmount += nBatchSize;
+  pLedger->llBatchAmount++;
+
+  if (nBatchSize > pLedger->nMaximumBatchSize) pLedger->nMaximumBatchSize = nBatchSize;
+
+  return nBatchSize;
+}
+
+/**
+ * Writes a ledger's events in batches until the ledger is closed and its ring is empty.
+ * @param pArgument The ledger.
+ * @returns Nothing.
+ */
+static void *runLedgerWriter(void *pArgument) {
+  Ledger *pLedger = pArgument;
+  long lIdleNanoseconds = LEDGER_MINIMUM_IDLE_NANOSECONDS;
+
+  for (;;) {
+    // Check for closing before emptying the ring, since every event is pushed before the ledger is closed.
+    int bIsClosing = __atomic_load_n(&pLedger->bIsClosing, __ATOMIC_ACQUIRE);
+
+    if (writeLedgerBatch(pLedger) > 0) {
+      lIdleNanoseconds = LEDGER_MINIMUM_IDLE_NANOSECONDS;
+    } else if (bIsClosing) {
+      break;
+    } else {
+      sleepLedgerThread(lIdleNanoseconds);
+
+      if (lIdleNanoseconds < LEDGER_MAXIMUM_IDLE_NANOSECONDS) lIdleNanoseconds *= 2;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * Opens a new event log file for writing by a background thread, replacing any file with the same path. If the
+ * thread cannot be started, the events are written by the game thread instead.
+ * @param[out] pLedger The ledger.
+ * @param strFilePath The path of the file.
+ * @param nCapacity The number of events that the ring can hold.
+ * @pre @p nCapacity must be a power of two within the range of `1` and `4096`.
+ * @param cFullPolicyId `'D'` to drop events or `'W'` to wait for space when the ring is full.
+ * @param cSyncPolicyId `'N'` to never sync the file, `'B'` to sync after every batch, or `'G'` to sync after every
+ * batch with a game end.
+ * @returns `1` if the file was opened or `0` if it could not be.
+ */
+int openLedger(Ledger *pLedger, const char *strFilePath, int nCapacity, char cFullPolicyId, char cSyncPolicyId) {
+  if (!openEventLogWriter(&pLedger->sWriter, strFilePath)) return 0;
+
+  pLedger->ullHead = 0;
+  pLedger->ullCachedTail = 0;
+  pLedger->bIsClosing = 0;
+  pLedger->llPushedAmount = 0;
+  pLedger->llDroppedAmount = 0;
+  pLedger->llWaitedAmount = 0;
+  pLedger->ullTail = 0;
+  pLedger->llWrittenAmount = 0;
+  pLedger->llBatchAmount = 0;
+  pLedger->llSyncAmount = 0;
+  pLedger->nMaximumBatchSize = 0;
+  pLedger->bHasFailed = 0;
+  pLedger->nCapacity = nCapacity;
+  pLedger->cFullPolicyId = cFullPolicyId;
+  pLedger->cSyncPolicyId = cSyncPolicyId;
+  pLedger->bThreadIsStarted = pthread_create(&pLedger->sThread, NULL, runLedgerWriter, pLedger) == 0;
+
+  return 1;
+}
+
+/**
+ * Pushes an event into a ledger's ring without doing any I/O.
+ * @param[out] pLedger The ledger.
+ * @param pGameEvent The event.
+ * @returns `1` if the event was pushed or `0` if it was dropped.
+ */
+int pushLedgerEvent(Ledger *pLedger, const GameEvent *pGameEvent) {
+  unsigned long long ullHead = pLedger->ullHead;
+
+  // Only look at the writer thread's tail when the last one seen says that the ring is full.
+  if (ullHead - pLedger->ullCachedTail == (unsigned long long)pLedger->nCapacity) {
+    pLedger->ullCachedTail = __atomic_load_n(&pLedger->ullTail, __ATOMIC_ACQUIRE);
+
+    if (ullHead - pLedger->ullCachedTail == (unsigned long long)pLedger->nCapacity) {
+      if (pLedger->cFullPolicyId == DROP_FULL_POLICY_ID) {
+        pLedger->llDroppedAmount++;
+
+        return 0;
+      }
+
+      pLedger->llWaitedAmount++;
+
+      do {
+        sleepLedgerThread(LEDGER_WAIT_NANOSECONDS);
+
+        pLedger->ullCachedTail = __atomic_load_n(&pLedger->ullTail, __ATOMIC_ACQUIRE);
+      } while (ullHead - pLedger->ullCachedTail == (unsigned long long)pLedger->nCapacity);
+    }
+  }
+
+  pLedger->asEvents[ullHead & (pLedger->nCapacity - 1)] = *pGameEvent;
+  pLedger->llPushedAmount++;
+
+  // Publish the event to the writer thread together with the head.
+  __atomic_store_n(&pLedger->ullHead, ullHead + 1, __ATOMIC_RELEASE);
+
+  // Without a writer thread, the game thread writes its own events.
+  if (!pLedger->bThreadIsStarted) writeLedgerBatch(pLedger);
+
+  return 1;
+}
+
+/**
+ * Writes every pushed event, stops the writer thread, and closes the ledger's file.
+ * @param[out] pLedger The ledger.
+ * @returns `1` if every pushed event was written or `0` if the file could not be written to.
+ */
+int closeLedger(Ledger *pLedger) {
+  __atomic_store_n(&pLedger->bIsClosing, 1, __ATOMIC_RELEASE);
+
+  if (pLedger->bThreadIsStarted) pthread_join(pLedger->sThread, NULL);
+
+  int bIsWritten = closeEventLogWriter(&pLedger->sWriter) && !pLedger->bHasFailed;
+
+  return bIsWritten && pLedger->llWrittenAmount == pLedger->llPushedAmount;
+}
@@ -0,0 +1,412 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "outcomes.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "compression.h"
+#include "engine.h"
+#include "prompts.h"
+#include "trading.h"
+
+// A column chunk starts with its codec and its stored size.
+#define OUTCOME_CHUNK_HEADER_SIZE 5
+
+/** A column of an outcome file, which stores a single field of every row. */
+typedef struct OutcomeColumn {
+  const char *strName;
+  /** `'B'` for an unsigned 8-bit, `'I'` for a signed 32-bit, or `'Q'` for an unsigned 64-bit integer. */
+  char cTypeId;
+  /** The position of the field within a `GameOutcome`. */
+  size_t ulFieldOffset;
+} OutcomeColumn;
+
+// The columns in the order that they are stored in every row group.
+static const OutcomeColumn asOutcomeColumns[OUTCOME_COLUMN_AMOUNT] = {
+  {"seed", UNSIGNED_LONG_COLUMN_TYPE_ID, offsetof(GameOutcome, ullSeed)},
+  {"strategy", UNSIGNED_BYTE_COLUMN_TYPE_ID, offsetof(GameOutcome, cStrategyId)},
+  {"balance", INTEGER_COLUMN_TYPE_ID, offsetof(GameOutcome, nPlayerBalance)},
+  {"profit", INTEGER_COLUMN_TYPE_ID, offsetof(GameOutcome, nPlayerProfit)},
+  {"turns", UNSIGNED_BYTE_COLUMN_TYPE_ID, offsetof(GameOutcome, ucPlayerTurns)},
+  {"upgrades", UNSIGNED_BYTE_COLUMN_TYPE_ID, offsetof(GameOutcome, ucUpgradeAmount)},
+  {"coconut_volume", INTEGER_COLUMN_TYPE_ID, offsetof(GameOutcome, anCargoVolumes)},
+  {"rice_volume", INTEGER_COLUMN_TYPE_ID, offsetof(GameOutcome, anCargoVolumes) + sizeof(int)},
+  {"silk_volume", INTEGER_COLUMN_TYPE_ID, offsetof(GameOutcome, anCargoVolumes) + 2 * sizeof(int)},
+  {"gun_volume", INTEGER_COLUMN_TYPE_ID, offsetof(GameOutcome, anCargoVolumes) + 3 * sizeof(int)},
+};
+
+/**
+ * Starts counting the outcome of a new game played by a bot.
+ * @param[out] pRecorder The recorder, which must be given to `playSimulatedGame()` with `chooseRecordedAction()`.
+ * @param fnStrategy The bot's strategy.
+ * @param pContext The bot's own parameters and memory.
+ * @param ullSeed The game's seed, or its index in a price tape.
+ * @param cStrategyId A character that identifies the bot.
+ */
+void startGameOutcome(OutcomeRecorder *pRecorder, GameStrategy fnStrategy, void *pContext, unsigned long long ullSeed,
+                      char cStrategyId) {
+  GameOutcome sGameOutcome = {0};
+
+  sGameOutcome.ullSeed = ullSeed;
+  sGameOutcome.cStrategyId = cStrategyId;
+
+  pRecorder->fnStrategy = fnStrategy;
+  pRecorder->pContext = pContext;
+  pRecorder->sOutcome = sGameOutcome;
+}
+
+/**
+ * Decides the next action of a recorded bot, counting the action into its game's outcome if it is valid.
+ * @param pGameState The current state of the game.
+ * @param pContext The recorder, which must be an `OutcomeRecorder`.
+ * @param[out] pGameAction The action that the bot wants to do.
+ */
+void chooseRecordedAction(const GameState *pGameState, void *pContext, GameAction *pGameAction) {
+  OutcomeRecorder *pRecorder = pContext;
+
+  pRecorder->fnStrategy(pGameState, pRecorder->pContext, pGameAction);
+
+  // Invalid actions are ignored by the game, so they are not counted either.
+  if (!isGameActionValid(pGameState, pGameAction)) return;
+
+  if (pGameAction->cActionId == BUY_ACTION_ID || pGameAction->cActionId == SELL_ACTION_ID) {
+    pRecorder->sOutcome.anCargoVolumes[getCargoIndex(pGameAction->cCargoId)] += pGameAction->nCargoAmount;
+  } else if (pGameAction->cActionId == UPGRADE_ACTION_ID) {
+    pRecorder->sOutcome.ucUpgradeAmount++;
+  }
+}
+
+/**
+ * Finishes the outcome of a recorded bot's game.
+ * @param[out] pRecorder The recorder.
+ * @param pGameState The state of the game when it ended.
+ */
+void finishGameOutcome(OutcomeRecorder *pRecorder, const GameState *pGameState) {
+  pRecorder->sOutcome.nPlayerBalance = pGameState->nPlayerBalance;
+  pRecorder->sOutcome.nPlayerProfit = pGameState->nPlayerBalance - pGameState->nPlayerInitialBalance;
+  pRecorder->sOutcome.ucPlayerTurns = (unsigned char)pGameState->nPlayerTurns;
+}
+
+/**
+ * Gets the number of bytes that every value of a column takes.
+ * @param cTypeId The column's type.
+ * @returns `1`, `4`, or `8`.
+ */
+static int getOutcomeColumnWidth(char cTypeId) {
+  switch (cTypeId) {
+    case UNSIGNED_BYTE_COLUMN_TYPE_ID: {
+      return 1;
+    }
+    case INTEGER_COLUMN_TYPE_ID: {
+      return 4;
+    }
+    // Set to default instead of 'Q' to satisfy the compiler
+    default: {
+      return 8;
+    }
+  }
+}
+
+/**
+ * Writes an unsigned integer as little-endian bytes.
+ * @param[out] aucBytes The bytes to write to.
+ * @param ullValue The integer.
+ * @param nWidth The number of bytes to write.
+ */
+static void encodeLittleEndian(unsigned char aucBytes[], unsigned long long ullValue, int nWidth) {
+  for (int nByteIndex = 0; nByteIndex < nWidth; nByteIndex++) {
+    aucBytes[nByteIndex] = (unsigned char)(ullValue >> (nByteIndex * 8));
+  }
+}
+
+/**
+ * Reads an unsigned integer from little-endian bytes.
+ * @param aucBytes The bytes.
+ * @param nWidth The number of bytes to read.
+ * @returns The integer.
+ */
+static unsigned long long decodeLittleEndian(const unsigned char aucBytes[], int nWidth) {
+  unsigned long long ullValue = 0;
+
+  for (int nByteIndex = 0; nByteIndex < nWidth; nByteIndex++) {
+    ullValue |= (unsigned long long)aucBytes[nByteIndex] << (nByteIndex * 8);
+  }
+
+  return ullValue;
+}
+
+/**
+ * Writes every column of an outcome writer's row group as a chunk.
+ * @param[out] pWriter The writer.
+ * @returns `1` if the row group was written or `0` if the file could not be written to.
+ */
+static int writeOutcomeRowGroup(OutcomeWriter *pWriter) {
+  unsigned char aucHeader[OUTCOME_CHUNK_HEADER_SIZE];
+  int bIsWritten;
+
+  if (pWriter->nRowGroupSize == 0) return 1;
+
+  encodeLittleEndian(aucHeader, pWriter->nRowGroupSize, 4);
+
+  bIsWritten = fwrite(aucHeader, 4, 1, pWriter->pFile) == 1;
+  pWriter->llStoredSize += 4;
+
+  for (int nColumnIndex = 0; nColumnIndex < OUTCOME_COLUMN_AMOUNT; nColumnIndex++) {
+    int nRawSize = pWriter->nRowGroupSize * getOutcomeColumnWidth(asOutcomeColumns[nColumnIndex].cTypeId);
+    const unsigned char *aucChunk = pWriter->aaucColumns[nColumnIndex];
+    int nStoredSize = nRawSize;
+
+    aucHeader[0] = RAW_COLUMN_CODEC_ID;
+
+    // Keep the column as it is if compressing does not make it smaller.
+    if (pWriter->bIsCompressing) {
+      int nCompressedSize = compressLzBlock(aucChunk, nRawSize, pWriter->aucCompressed);
+
+      if (nCompressedSize < nRawSize) {
+        aucHeader[0] = LZ_COLUMN_CODEC_ID;
+        aucChunk = pWriter->aucCompressed;
+        nStoredSize = nCompressedSize;
+      }
+    }
+
+    encodeLittleEndian(&aucHeader[1], nStoredSize, 4);
+
+    bIsWritten = bIsWritten && fwrite(aucHeader, OUTCOME_CHUNK_HEADER_SIZE, 1, pWriter->pFile) == 1 &&
+                 fwrite(aucChunk, nStoredSize, 1, pWriter->pFile) == 1;
+    pWriter->llRawSize += nRawSize;
+    pWriter->llStoredSize += OUTCOME_CHUNK_HEADER_SIZE + nStoredSize;
+  }
+
+  pWriter->nRowGroupSize = 0;
+
+  return bIsWritten;
+}
+
+/**
+ * Opens a new outcome file for writing, replacing any file with the same path, and writes the columns' names and
+ * types.
+ * @param[out] pWriter The writer.
+ * @param strFilePath The path of the file.
+ * @param bIsCompressing `1` to compress the columns or `0` to store them as they are.
+ * @returns `1` if the file was opened or `0` if it could not be.
+ */
+int openOutcomeWriter(OutcomeWriter *pWriter, const char *strFilePath, int bIsCompressing) {
+  pWriter->pFile = fopen(strFilePath, "wb");
+
+  if (pWriter->pFile == NULL) return 0;
+
+  pWriter->bIsCompressing = bIsCompressing;
+  pWriter->nRowGroupSize = 0;
+  pWriter->llRowAmount = 0;
+  pWriter->llRawSize = 0;
+
+  fputs(OUTCOME_FILE_MAGIC, pWriter->pFile);
+  fputc(OUTCOME_FILE_VERSION, pWriter->pFile);
+  fputc(OUTCOME_COLUMN_AMOUNT, pWriter->pFile);
+
+  pWriter->llStoredSize = strlen(OUTCOME_FILE_MAGIC) + 2;
+
+  // Every column is described by its type, the length of its name, and its name.
+  for (int nColumnIndex = 0; nColumnIndex < OUTCOME_COLUMN_AMOUNT; nColumnIndex++) {
+    const OutcomeColumn *pColumn = &asOutcomeColumns[nColumnIndex];
+
+    fputc(pColumn->cTypeId, pWriter->pFile);
+    fputc((int)strlen(pColumn->strName), pWriter->pFile);
+    fputs(pColumn->strName, pWriter->pFile);
+
+    pWriter->llStoredSize += 2 + strlen(pColumn->strName);
+  }
+
+  return 1;
+}
+
+/**
+ * Adds a row to an outcome file, writing the row group when it is full.
+ * @param[out] pWriter The writer.
+ * @param pGameOutcome The row.
+ * @returns `1` if the row was added or `0` if the file could not be written to.
+ */
+int writeGameOutcome(OutcomeWriter *pWriter, const GameOutcome *pGameOutcome) {
+  const unsigned char *pucRow = (const unsigned char *)pGameOutcome;
+
+  for (int nColumnIndex = 0; nColumnIndex < OUTCOME_COLUMN_AMOUNT; nColumnIndex++) {
+    const OutcomeColumn *pColumn = &asOutcomeColumns[nColumnIndex];
+    const unsigned char *pucField = pucRow + pColumn->ulFieldOffset;
+    int nWidth = getOutcomeColumnWidth(pColumn->cTypeId);
+    unsigned long long ullValue;
+
+    if (pColumn->cTypeId == UNSIGNED_BYTE_COLUMN_TYPE_ID) {
+      ullValue = *pucField;
+    } else if (pColumn->cTypeId == INTEGER_COLUMN_TYPE_ID) {
+      int nValue;
+
+      memcpy(&nValue, pucField, sizeof(nValue));
+
+      ullValue = (unsigned int)nValue;
+    } else {
+      memcpy(&ullValue, pucField, sizeof(ullValue));
+    }
+
+    encodeLittleEndian(&pWriter->aaucColumns[nColumnIndex][pWriter->nRowGroupSize * nWidth], ullValue, nWidth);
+  }
+
+  pWriter->nRowGroupSize++;
+  pWriter->llRowAmount++;
+
+  return pWriter->nRowGroupSize < OUTCOME_ROW_GROUP_SIZE || writeOutcomeRowGroup(pWriter);
+}
+
+/**
+ * Writes the last row group of an outcome file and closes it.
+ * @param[out] pWriter The writer.
+ * @returns `1` if every row was written or `0` if the file could not be written to.
+ */
+int closeOutcomeWriter(OutcomeWriter *pWriter) {
+  int bIsWritten = writeOutcomeRowGroup(pWriter);
+
+  bIsWritten = fclose(pWriter->pFile) == 0 && bIsWritten;
+  pWriter->pFile = NULL;
+
+  return bIsWritten;
+}
+
+/**
+ * Opens an outcome file for reading.
+ * @param[out] pReader The reader.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the file was opened or `0` if it does not exist or does not have the expected columns.
+ */
+int openOutcomeReader(OutcomeReader *pReader, const char *strFilePath) {
+  pReader->pFile = fopen(strFilePath, "rb");
+
+  if (pReader->pFile == NULL) return 0;
+
+  pReader->nRowGroupSize = 0;
+  pReader->nRowPosition = 0;
+  pReader->llRowAmount = 0;
+
+  char acMagic[sizeof(OUTCOME_FILE_MAGIC)] = {0};
+  int bIsValid = fread(acMagic, strlen(OUTCOME_FILE_MAGIC), 1, pReader->pFile) == 1 &&
+                 strcmp(acMagic, OUTCOME_FILE_MAGIC) == 0 && fgetc(pReader->pFile) == OUTCOME_FILE_VERSION &&
+                 fgetc(pReader->pFile) == OUTCOME_COLUMN_AMOUNT;
+
+  // The columns must be the same ones, in the same order, that this reader knows.
+  for (int nColumnIndex = 0; bIsValid && nColumnIndex < OUTCOME_COLUMN_AMOUNT; nColumnIndex++) {
+    const OutcomeColumn *pColumn = &asOutcomeColumns[nColumnIndex];
+    char acName[256] = {0};
+    int nNameLength;
+
+    bIsValid = fgetc(pReader->pFile) == pColumn->cTypeId && (nNameLength = fgetc(pReader->pFile)) != EOF &&
+               fread(acName, 1, nNameLength, pReader->pFile) == (size_t)nNameLength &&
+               strcmp(acName, pColumn->strName) == 0;
+  }
+
+  if (!bIsValid) {
+    closeOutcomeReader(pReader);
+
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Reads the next row group of an outcome file into its reader's columns.
+ * @param[out] pReader The reader.
+ * @returns `1` if a row group was read, `0` if there are no row groups left, or `-1` if the file is corrupted.
+ */
+static int readOutcomeRowGroup(OutcomeReader *pReader) {
+  unsigned char aucHeader[OUTCOME_CHUNK_HEADER_SIZE];
+  size_t ulHeaderSize = fread(aucHeader, 1, 4, pReader->pFile);
+
+  if (ulHeaderSize == 0) return 0;
+
+  int nRowGroupSize = (int)decodeLittleEndian(aucHeader, 4);
+
+  if (ulHeaderSize != 4 || nRowGroupSize < 1 || nRowGroupSize > OUTCOME_ROW_GROUP_SIZE) return -1;
+
+  for (int nColumnIndex = 0; nColumnIndex < OUTCOME_COLUMN_AMOUNT; nColumnIndex++) {
+    int nRawSize = nRowGroupSize * getOutcomeColumnWidth(asOutcomeColumns[nColumnIndex].cTypeId);
+
+    if (fread(aucHeader, OUTCOME_CHUNK_HEADER_SIZE, 1, pReader->pFile) != 1) return -1;
+
+    unsigned long long ullStoredSize = decodeLittleEndian(&aucHeader[1], 4);
+
+    if (aucHeader[0] == RAW_COLUMN_CODEC_ID) {
+      if (ullStoredSize != (unsigned long long)nRawSize ||
+          fread(pReader->aaucColumns[nColumnIndex], nRawSize, 1, pReader->pFile) != 1) {
+        return -1;
+      }
+    } else if (aucHeader[0] == LZ_COLUMN_CODEC_ID) {
+      if (ullStoredSize > sizeof(pReader->aucCompressed) ||
+          fread(pReader->aucCompressed, (size_t)ullStoredSize, 1, pReader->pFile) != 1 ||
+          decompressLzBlock(pReader->aucCompressed, (int)ullStoredSize, pReader->aaucColumns[nColumnIndex],
+                            OUTCOME_COLUMN_CHUNK_CAPACITY) != nRawSize) {
+        return -1;
+      }
+    } else {
+      return -1;
+    }
+  }
+
+  pReader->nRowGroupSize = nRowGroupSize;
+  pReader->nRowPosition = 0;
+
+  return 1;
+}
+
+/**
+ * Reads the next row of an outcome file.
+ * @param[out] pReader The reader.
+ * @param[out] pGameOutcome The row.
+ * @returns `1` if a row was read, `0` if there are no rows left, or `-1` if the file is corrupted.
+ */
+int readGameOutcome(OutcomeReader *pReader, GameOutcome *pGameOutcome) {
+  if (pReader->nRowPosition == pReader->nRowGroupSize) {
+    int nReadResult = readOutcomeRowGroup(pReader);
+
+    if (nReadResult != 1) return nReadResult;
+  }
+
+  unsigned char *pucRow = (unsigned char *)pGameOutcome;
+
+  for (int nColumnIndex = 0; nColumnIndex < OUTCOME_COLUMN_AMOUNT; nColumnIndex++) {
+    const OutcomeColumn *pColumn = &asOutcomeColumns[nColumnIndex];
+    unsigned char *pucField = pucRow + pColumn->ulFieldOffset;
+    int nWidth = getOutcomeColumnWidth(pColumn->cTypeId);
+    unsigned long long ullValue =
+      decodeLittleEndian(&pReader->aaucColumns[nColumnIndex][pReader->nRowPosition * nWidth], nWidth);
+
+    if (pColumn->cTypeId == UNSIGNED_BYTE_COLUMN_TYPE_ID) {
+      *pucField = (unsigned char)ullValue;
+    } else if (pColumn->cTypeId == INTEGER_COLUMN_TYPE_ID) {
+      int nValue = (int)(unsigned int)ullValue;
+
+      memcpy(pucField, &nValue, sizeof(nValue));
+    } else {
+      memcpy(pucField, &ullValue, sizeof(ullValue));
+    }
+  }
+
+  pReader->nRowPosition++;
+  pReader->llRowAmount++;
+
+  return 1;
+}
+
+/**
+ * Closes the file of an outcome reader.
+ * @param[out] pReader The reader.
+ */
+void closeOutcomeReader(OutcomeReader *pReader) {
+  if (pReader->pFile != NULL) fclose(pReader->pFile);
+
+  pReader->pFile = NULL;
+}
@@ -0,0 +1,315 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose pthread_once() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "planning.h"
+
+#include <pthread.h>
+
+#include "trading.h"
+
+static const int anShipCargoLimits[SHIP_UPGRADE_TIER_AMOUNT + 1] = {
+  TIER_ONE_SHIP_CARGO_LIMIT, TIER_TWO_SHIP_CARGO_LIMIT, TIER_THREE_SHIP_CARGO_LIMIT, TIER_FOUR_SHIP_CARGO_LIMIT};
+static const int anShipUpgradeCosts[SHIP_UPGRADE_TIER_AMOUNT] = {
+  TIER_TWO_SHIP_UPGRADE_COST, TIER_THREE_SHIP_UPGRADE_COST, TIER_FOUR_SHIP_UPGRADE_COST};
+
+// The tables are computed on their first use, which can happen on several bot and tuning threads at once.
+static pthread_once_t sShipUpgradeValuesOnce = PTHREAD_ONCE_INIT;
+static int aanShipUpgradeValues[SHIP_UPGRADE_TIER_AMOUNT][MAXIMUM_PLAYER_TURNS + 1][BALANCE_BUCKET_AMOUNT];
+
+static pthread_once_t sRouteValuesOnce = PTHREAD_ONCE_INIT;
+static double aadRouteValues[MAXIMUM_PLAYER_TURNS + 1][PORT_AMOUNT][PORT_AMOUNT];
+static int aanRecommendedPortIndexes[MAXIMUM_PLAYER_TURNS + 1][PORT_AMOUNT];
+
+/**
+ * Clamps the number of turns the player has exhausted into the number of turns they have remaining.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns An integer value within the range of `0` and `MAXIMUM_PLAYER_TURNS`.
+ */
+static int getRemainingTurns(int nPlayerTurns) {
+  int nRemainingTurns = MAXIMUM_PLAYER_TURNS - nPlayerTurns;
+
+  if (nRemainingTurns < 0) nRemainingTurns = 0;
+
+  if (nRemainingTurns > MAXIMUM_PLAYER_TURNS) nRemainingTurns = MAXIMUM_PLAYER_TURNS;
+
+  return nRemainingTurns;
+}
+
+/**
+ * Gets the expected market price of every cargo in every port, which is the middle of its price range.
+ * @param[out] adExpectedPrices The expected market prices, indexed by port and then by cargo.
+ */
+static void getExpectedPrices(double adExpectedPrices[PORT_AMOUNT][CARGO_AMOUNT]) {
+  for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      int nMinimumPrice;
+      int nMaximumPrice;
+
+      getCargoPriceRange(getPortId(nPortIndex), getCargoId(nCargoIndex), &nMinimumPrice, &nMaximumPrice);
+
+      adExpectedPrices[nPortIndex][nCargoIndex] = (nMinimumPrice + nMaximumPrice) / 2.0;
+    }
+  }
+}
+
+/**
+ * Projects the player's balance after every voyage when they repeatedly sail back and forth between the two most
+ * profitable ports, buying as much of the best cargo as they can afford and store before each voyage.
+ * @param adExpectedPrices The expected market prices, indexed by port and then by cargo.
+ * @param nShipCargoLimit The maximum amount of cargo that the ship can carry.
+ * @param dPlayerBalance The player's starting gold coin balance.
+ * @param[out] adProjectedBalances The best projected balance after each number of voyages.
+ */
+static void projectBalances(double adExpectedPrices[PORT_AMOUNT][CARGO_AMOUNT], int nShipCargoLimit,
+                            double dPlayerBalance, double adProjectedBalances[MAXIMUM_PLAYER_TURNS]) {
+  for (int nVoyageAmount = 0; nVoyageAmount < MAXIMUM_PLAYER_TURNS; nVoyageAmount++) {
+    adProjectedBalances[nVoyageAmount] = dPlayerBalance;
+  }
+
+  for (int nFirstPortIndex = 0; nFirstPortIndex < PORT_AMOUNT; nFirstPortIndex++) {
+    for (int nSecondPortIndex = 0; nSecondPortIndex < PORT_AMOUNT; nSecondPortIndex++) {
+      if (nFirstPortIndex == nSecondPortIndex) continue;
+
+      double dBalance = dPlayerBalance;
+
+      for (int nVoyageAmount = 1; nVoyageAmount < MAXIMUM_PLAYER_TURNS; nVoyageAmount++) {
+        // Alternate the direction of every voyage.
+        int nSourcePortIndex = nVoyageAmount % 2 ? nFirstPortIndex : nSecondPortIndex;
+        int nDestinationPortIndex = nVoyageAmount % 2 ? nSecondPortIndex : nFirstPortIndex;
+        double dBestGain = 0;
+
+        for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+          double dBuyPrice = adExpectedPrices[nSourcePortIndex][nCargoIndex];
+          double dSellPrice = adExpectedPrices[nDestinationPortIndex][nCargoIndex];
+          int nCargoAmount = dBalance > 0 ? (int)(dBalance / dBuyPrice) : 0;
+
+          if (nCargoAmount > nShipCargoLimit) nCargoAmount = nShipCargoLimit;
+
+          if (nCargoAmount * (dSellPrice - dBuyPrice) > dBestGain) dBestGain = nCargoAmount * (dSellPrice - dBuyPrice);
+        }
+
+        dBalance += dBestGain;
+
+        if (dBalance > adProjectedBalances[nVoyageAmount]) adProjectedBalances[nVoyageAmount] = dBalance;
+      }
+    }
+  }
+}
+
+/** Precomputes the expected net value of every ship upgrade for every remaining turn count and balance bucket. */
+static void computeShipUpgradeValues(void) {
+  double adExpectedPrices[PORT_AMOUNT][CARGO_AMOUNT];
+
+  getExpectedPrices(adExpectedPrices);
+
+  for (int nBalanceBucket = 0; nBalanceBucket < BALANCE_BUCKET_AMOUNT; nBalanceBucket++) {
+    // Use the middle of the bucket as its representative balance.
+    double dPlayerBalance = BALANCE_BUCKET_BASE_SIZE / 2.0;
+
+    if (nBalanceBucket > 0) dPlayerBalance = 1.5 * BALANCE_BUCKET_BASE_SIZE * (1 << (nBalanceBucket - 1));
+
+    for (int nTierIndex = 0; nTierIndex < SHIP_UPGRADE_TIER_AMOUNT; nTierIndex++) {
+      double adCurrentBalances[MAXIMUM_PLAYER_TURNS];
+      double adUpgradedBalances[MAXIMUM_PLAYER_TURNS];
+      // The upgrade can only be bought once it's affordable, so never assume a balance below its cost.
+      double dAffordableBalance =
+        dPlayerBalance < anShipUpgradeCosts[nTierIndex] ? anShipUpgradeCosts[nTierIndex] : dPlayerBalance;
+
+      projectBalances(adExpectedPrices, anShipCargoLimits[nTierIndex], dAffordableBalance, adCurrentBalances);
+      projectBalances(adExpectedPrices, anShipCargoLimits[nTierIndex + 1],
+                      dAffordableBalance - anShipUpgradeCosts[nTierIndex], adUpgradedBalances);
+
+      for (int nRemainingTurns = 0; nRemainingTurns <= MAXIMUM_PLAYER_TURNS; nRemainingTurns++) {
+        // The last voyage ends the game, so the cargo bought before it can never be sold.
+        int nVoyageAmount = nRemainingTurns > 0 ? nRemainingTurns - 1 : 0;
+
+        aanShipUpgradeValues[nTierIndex][nRemainingTurns][nBalanceBucket] =
+          (int)(adUpgradedBalances[nVoyageAmount] - adCurrentBalances[nVoyageAmount]);
+      }
+    }
+  }
+}
+
+/**
+ * Gets the index of the balance bucket that a gold coin balance falls into. Bucket `0` contains balances below `128`,
+ * and every bucket after it doubles the size of the previous one.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @returns An integer value within the range of `0` and `15`.
+ */
+int getBalanceBucket(int nPlayerBalance) {
+  if (nPlayerBalance < BALANCE_BUCKET_BASE_SIZE) return 0;
+
+  int nBalanceBucket = 1;
+
+  while (nBalanceBucket < BALANCE_BUCKET_AMOUNT - 1 && nPlayerBalance >= BALANCE_BUCKET_BASE_SIZE << nBalanceBucket) {
+    nBalanceBucket++;
+  }
+
+  return nBalanceBucket;
+}
+
+/**
+ * Gets the expected net value of upgrading the ship to its next tier before the game ends. The value is read from a
+ * table, indexed by the ship's tier, the remaining turns, and the balance bucket, which is precomputed from the port
+ * market price ranges on the first call.
+ * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @param nPlayerBalance The player's gold coin balance.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns The expected number of gold coins gained (or lost if negative) by the end of the game from upgrading, or `0`
+ * if the ship is already in the highest tier.
+ */
+int getShipUpgradeValue(int nShipCurrentCargoLimit, int nPlayerBalance, int nPlayerTurns) {
+  int nTierIndex;
+
+  if (nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
+    nTierIndex = 0;
+  } else if (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
+    nTierIndex = 1;
+  } else if (nShipCurrentCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT) {
+    nTierIndex = 2;
+  } else {
+    return 0;
+  }
+
+  pthread_once(&sShipUpgradeValuesOnce, computeShipUpgradeValues);
+
+  return aanShipUpgradeValues[nTierIndex][getRemainingTurns(nPlayerTurns)][getBalanceBucket(nPlayerBalance)];
+}
+
+/**
+ * Gets the expected margin of a single cargo space on a voyage when the player buys the cargo with the best margin
+ * after seeing the source port's market prices. Every buy price is uniformly distributed within its range, so the
+ * expected best margin is summed from the product of every cargo's margin distribution.
+ * @param nSourcePortIndex The index of the port to buy cargo from.
+ * @param nDestinationPortIndex The index of the port to sell cargo to.
+ * @returns The expected number of gold coins earned per cargo space.
+ */
+static double getExpectedBestMargin(int nSourcePortIndex, int nDestinationPortIndex) {
+  int anMinimumBuyPrices[CARGO_AMOUNT];
+  int anMaximumBuyPrices[CARGO_AMOUNT];
+  // Twice the expected sell prices, which keeps the margins' distributions in whole numbers.
+  int anDoubledSellPrices[CARGO_AMOUNT];
+  int nDoubledMaximumMargin = 0;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    int nMinimumSellPrice;
+    int nMaximumSellPrice;
+
+    getCargoPriceRange(getPortId(nSourcePortIndex), getCargoId(nCargoIndex), &anMinimumBuyPrices[nCargoIndex],
+                       &anMaximumBuyPrices[nCargoIndex]);
+    getCargoPriceRange(getPortId(nDestinationPortIndex), getCargoId(nCargoIndex), &nMinimumSellPrice,
+                       &nMaximumSellPrice);
+
+    anDoubledSellPrices[nCargoIndex] = nMinimumSellPrice + nMaximumSellPrice;
+
+    if (anDoubledSellPrices[nCargoIndex] - 2 * anMinimumBuyPrices[nCargoIndex] > nDoubledMaximumMargin) {
+      nDoubledMaximumMargin = anDoubledSellPrices[nCargoIndex] - 2 * anMinimumBuyPrices[nCargoIndex];
+    }
+  }
+
+  // E[max] is the sum of P(max > y) over every whole number y, and P(max <= y) is the product of every P(margin <= y).
+  double dDoubledExpectedMargin = 0;
+
+  for (int nDoubledMargin = 0; nDoubledMargin < nDoubledMaximumMargin; nDoubledMargin++) {
+    double dProbability = 1;
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      // The margin is at most y when the buy price is at least half of (doubled sell price - y), rounded up.
+      int nLowestBuyPrice = (anDoubledSellPrices[nCargoIndex] - nDoubledMargin + 1) / 2;
+
+      if (nLowestBuyPrice < anMinimumBuyPrices[nCargoIndex]) nLowestBuyPrice = anMinimumBuyPrices[nCargoIndex];
+
+      int nPriceAmount = anMaximumBuyPrices[nCargoIndex] - anMinimumBuyPrices[nCargoIndex] + 1;
+      int nMatchingPriceAmount = anMaximumBuyPrices[nCargoIndex] - nLowestBuyPrice + 1;
+
+      dProbability *= nMatchingPriceAmount > 0 ? (double)nMatchingPriceAmount / nPriceAmount : 0;
+    }
+
+    dDoubledExpectedMargin += 1 - dProbability;
+  }
+
+  return dDoubledExpectedMargin / 2;
+}
+
+/** Precomputes the Bellman value of every route and the recommended port for every remaining turn count. */
+static void computeRouteValues(void) {
+  double aadExpectedMargins[PORT_AMOUNT][PORT_AMOUNT];
+  double aadPortValues[MAXIMUM_PLAYER_TURNS + 1][PORT_AMOUNT];
+
+  for (int nSourcePortIndex = 0; nSourcePortIndex < PORT_AMOUNT; nSourcePortIndex++) {
+    for (int nDestinationPortIndex = 0; nDestinationPortIndex < PORT_AMOUNT; nDestinationPortIndex++) {
+      aadExpectedMargins[nSourcePortIndex][nDestinationPortIndex] =
+        nSourcePortIndex == nDestinationPortIndex ? 0 : getExpectedBestMargin(nSourcePortIndex, nDestinationPortIndex);
+    }
+  }
+
+  for (int nRemainingTurns = 0; nRemainingTurns <= MAXIMUM_PLAYER_TURNS; nRemainingTurns++) {
+    for (int nSourcePortIndex = 0; nSourcePortIndex < PORT_AMOUNT; nSourcePortIndex++) {
+      aadPortValues[nRemainingTurns][nSourcePortIndex] = 0;
+      aanRecommendedPortIndexes[nRemainingTurns][nSourcePortIndex] = (nSourcePortIndex + 1) % PORT_AMOUNT;
+
+      for (int nDestinationPortIndex = 0; nDestinationPortIndex < PORT_AMOUNT; nDestinationPortIndex++) {
+        double dRouteValue = 0;
+
+        // The last voyage ends the game, so the cargo bought before it can never be sold.
+        if (nSourcePortIndex != nDestinationPortIndex && nRemainingTurns > 1) {
+          dRouteValue = aadExpectedMargins[nSourcePortIndex][nDestinationPortIndex] +
+                        aadPortValues[nRemainingTurns - 1][nDestinationPortIndex];
+        }
+
+        aadRouteValues[nRemainingTurns][nSourcePortIndex][nDestinationPortIndex] = dRouteValue;
+
+        if (dRouteValue > aadPortValues[nRemainingTurns][nSourcePortIndex]) {
+          aadPortValues[nRemainingTurns][nSourcePortIndex] = dRouteValue;
+          aanRecommendedPortIndexes[nRemainingTurns][nSourcePortIndex] = nDestinationPortIndex;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Gets the expected number of gold coins that a single cargo space earns from sailing to a port and then planning
+ * every voyage after it optimally until the game ends. The value is read from a Bellman value table, indexed by the
+ * remaining turns and the two ports, which is precomputed from the port market price ranges on the first call.
+ * @param cCurrentPortId The current port's ID.
+ * @pre @p cCurrentPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param cDestinationPortId The ID of the port to sail to.
+ * @pre @p cDestinationPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns The expected number of gold coins earned per cargo space, or `0` if sailing to the port is not allowed.
+ */
+int getRouteValue(char cCurrentPortId, char cDestinationPortId, int nPlayerTurns) {
+  int nSourcePortIndex = getPortIndex(cCurrentPortId);
+  int nDestinationPortIndex = getPortIndex(cDestinationPortId);
+
+  if (nSourcePortIndex < 0 || nDestinationPortIndex < 0) return 0;
+
+  pthread_once(&sRouteValuesOnce, computeRouteValues);
+
+  return (int)aadRouteValues[getRemainingTurns(nPlayerTurns)][nSourcePortIndex][nDestinationPortIndex];
+}
+
+/**
+ * Gets the ID of the port that is expected to earn the most gold coins by the end of the game when sailed to next.
+ * @param cCurrentPortId The current port's ID.
+ * @pre @p cCurrentPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @returns A character value of `'T'` for Tondo, `'M'` for Manila, `'P'` for Pandakan, or `'S'` for Sapa.
+ */
+char getRecommendedPortId(char cCurrentPortId, int nPlayerTurns) {
+  int nSourcePortIndex = getPortIndex(cCurrentPortId);
+
+  if (nSourcePortIndex < 0) nSourcePortIndex = 0;
+
+  pthread_once(&sRouteValuesOnce, computeRouteValues);
+
+  return getPortId(aanRecommendedPortIndexes[getRemainingTurns(nPlayerTurns)][nSourcePortIndex]);
+}
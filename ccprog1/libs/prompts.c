@@ -11,18 +11,21 @@
 #include <stdio.h>
 
 #include "console.h"
+#include "layout.h"
+#include "planning.h"
+#include "rendering.h"
 #include "trading.h"
 
 /**
  * Prompts the player to input their preferred merchant ID.
  * @returns An integer value within the range of `0` and `999`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForPlayerId(void) {
-  int nLeftPaddingSize = 56;
+  int nLeftPaddingSize = getLayoutPaddingSize(56);
 
-  printf("%*cEnter your preferred merchant code (0 - 999)\n", nLeftPaddingSize, ' ');
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cEnter your preferred merchant code (0 - 999)\n", nLeftPaddingSize, ' ');
+  }
 
   int nPlayerId;
   // If the merchant ID the player provided is invalid, repeatedly make the player input a new one until it's valid.
@@ -32,12 +35,13 @@ int promptForPlayerId(void) {
     nPlayerId = getIntegerInput(nLeftPaddingSize);
 
     if (nPlayerId < MINIMUM_PLAYER_ID_VALUE || nPlayerId > MAXIMUM_PLAYER_ID_VALUE) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer within the range of 0 - 999!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter an integer within the range of 0 - 999!\n", nLeftPaddingSize,
+                      ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return nPlayerId;
@@ -46,13 +50,13 @@ int promptForPlayerId(void) {
 /**
  * Prompts the player to input the number of gold coins they want to start with.
  * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForInitialBalance(void) {
-  int nLeftPaddingSize = 57;
+  int nLeftPaddingSize = getLayoutPaddingSize(57);
 
-  printf("%*cEnter your preferred initial balance (> 0)\n", nLeftPaddingSize, ' ');
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cEnter your preferred initial balance (> 0)\n", nLeftPaddingSize, ' ');
+  }
 
   int nPlayerInitialBalance;
   // If the initial balance the player provided is invalid, repeatedly make the player input a new one until it's valid.
@@ -62,12 +66,12 @@ int promptForInitialBalance(void) {
     nPlayerInitialBalance = getIntegerInput(nLeftPaddingSize);
 
     if (nPlayerInitialBalance < MINIMUM_INITIAL_BALANCE) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer greater than 0!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter an integer greater than 0!\n", nLeftPaddingSize, ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return nPlayerInitialBalance;
@@ -76,13 +80,13 @@ int promptForInitialBalance(void) {
 /**
  * Prompts the player to input their desired profit target.
  * @returns An integer value greater than `20`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForProfitTarget(void) {
-  int nLeftPaddingSize = 62;
+  int nLeftPaddingSize = getLayoutPaddingSize(62);
 
-  printf("%*cEnter your target profit (>= 20)\n", nLeftPaddingSize, ' ');
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cEnter your target profit (>= 20)\n", nLeftPaddingSize, ' ');
+  }
 
   int nPlayerProfitTarget;
   // If the profit target the player provided is invalid, repeatedly make the player input a new one until it's valid.
@@ -92,12 +96,13 @@ int promptForProfitTarget(void) {
     nPlayerProfitTarget = getIntegerInput(nLeftPaddingSize);
 
     if (nPlayerProfitTarget < MINIMUM_TARGET_PROFIT) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer greater than or equal to 20!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter an integer greater than or equal to 20!\n", nLeftPaddingSize,
+                      ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return nPlayerProfitTarget;
@@ -106,13 +111,13 @@ int promptForProfitTarget(void) {
 /**
  * Prompts the player to input a confirmation of their prior decision.
  * @returns `1` if the player confirms or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForConfirmation(void) {
-  int nLeftPaddingSize = 67;
+  int nLeftPaddingSize = getLayoutPaddingSize(67);
 
-  printf("%*cAre you sure? [Y / N]\n", nLeftPaddingSize, ' ');
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cAre you sure? [Y / N]\n", nLeftPaddingSize, ' ');
+  }
 
   char cPlayerHadConfirmed;
   // Repeatedly make the player input a 'Y' or 'N' until it's valid.
@@ -122,12 +127,13 @@ int promptForConfirmation(void) {
     cPlayerHadConfirmed = toupper(getCharacterInput(nLeftPaddingSize));
 
     if (cPlayerHadConfirmed != YES_ID && cPlayerHadConfirmed != NO_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize,
+                      ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   if (cPlayerHadConfirmed == YES_ID) {
@@ -139,9 +145,12 @@ int promptForConfirmation(void) {
 
 /** Prompts the player to press the enter or return key to continue the game. */
 void promptForContinuation(void) {
-  int nLeftPaddingSize = 62;
+  // A typed-ahead command already ends with the screen that it leads to.
+  if (isInputTypedAhead()) return;
 
-  printf("%*cEnter any character to continue\n", nLeftPaddingSize, ' ');
+  int nLeftPaddingSize = getLayoutPaddingSize(62);
+
+  if (!hasQueuedInput()) printRenderedText("%*cEnter any character to continue\n", nLeftPaddingSize, ' ');
 
   getCharacterInput(nLeftPaddingSize);
 }
@@ -160,29 +169,31 @@ void promptForContinuation(void) {
  */
 char promptForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlayerBalance, int nCoconutMarketPrice,
                        int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice) {
-  int nLeftPaddingSize = 65;
+  int nLeftPaddingSize = getLayoutPaddingSize(65);
 
-  printf("%*cWhat would you like to do?\n", nLeftPaddingSize, ' ');
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cWhat would you like to do?\n", nLeftPaddingSize, ' ');
 
-  // Print out all viable action ID choices.
-  if (nShipTotalCargoAmount < nShipCargoLimit && nPlayerBalance >= nCoconutMarketPrice &&
-      nPlayerBalance >= nRiceMarketPrice && nPlayerBalance >= nSilkMarketPrice && nPlayerBalance >= nGunMarketPrice)
-    printf("%*c‣ [B] Buy Cargo\n", nLeftPaddingSize, ' ');
+    // Print out all viable action ID choices.
+    if (nShipTotalCargoAmount < nShipCargoLimit && nPlayerBalance >= nCoconutMarketPrice &&
+        nPlayerBalance >= nRiceMarketPrice && nPlayerBalance >= nSilkMarketPrice && nPlayerBalance >= nGunMarketPrice)
+      printRenderedText("%*c‣ [B] Buy Cargo\n", nLeftPaddingSize, ' ');
 
-  if (nShipTotalCargoAmount > 0) printf("%*c‣ [S] Sell Cargo\n", nLeftPaddingSize, ' ');
+    if (nShipTotalCargoAmount > 0) printRenderedText("%*c‣ [S] Sell Cargo\n", nLeftPaddingSize, ' ');
 
-  if (nShipCargoLimit < TIER_FOUR_SHIP_CARGO_LIMIT &&
-      ((nShipCargoLimit == 75 && nPlayerBalance >= TIER_TWO_SHIP_UPGRADE_COST) ||
-       (nShipCargoLimit == 150 && nPlayerBalance >= TIER_THREE_SHIP_UPGRADE_COST) ||
-       (nShipCargoLimit == 225 && nPlayerBalance >= TIER_FOUR_SHIP_UPGRADE_COST))) {
-    printf("%*c‣ [U] Upgrade Ship\n", nLeftPaddingSize, ' ');
-  }
+    if (nShipCargoLimit < TIER_FOUR_SHIP_CARGO_LIMIT &&
+        ((nShipCargoLimit == 75 && nPlayerBalance >= TIER_TWO_SHIP_UPGRADE_COST) ||
+         (nShipCargoLimit == 150 && nPlayerBalance >= TIER_THREE_SHIP_UPGRADE_COST) ||
+         (nShipCargoLimit == 225 && nPlayerBalance >= TIER_FOUR_SHIP_UPGRADE_COST))) {
+      printRenderedText("%*c‣ [U] Upgrade Ship\n", nLeftPaddingSize, ' ');
+    }
 
-  printf("%*c‣ [N] Navigate To a Different Port\n", nLeftPaddingSize, ' ');
+    printRenderedText("%*c‣ [N] Navigate To a Different Port\n", nLeftPaddingSize, ' ');
 
-  printf("\n");
+    printRenderedText("\n");
 
-  printf("%*c‣ [Q] Quit Game\n", nLeftPaddingSize, ' ');
+    printRenderedText("%*c‣ [Q] Quit Game\n", nLeftPaddingSize, ' ');
+  }
 
   char cChosenActionId;
   // If the action ID the player provided is invalid, repeatedly make the player input a new one until it's valid.
@@ -193,37 +204,28 @@ char promptForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlay
 
     if (cChosenActionId != BUY_ACTION_ID && cChosenActionId != SELL_ACTION_ID && cChosenActionId != UPGRADE_ACTION_ID &&
         cChosenActionId != NAVIGATE_ACTION_ID && cChosenActionId != QUIT_ACTION_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize,
+                      ' ');
     } else if (cChosenActionId == BUY_ACTION_ID && nShipTotalCargoAmount == nShipCargoLimit) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough storage to buy more cargo!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough storage to buy more cargo!\n", nLeftPaddingSize, ' ');
     } else if (cChosenActionId == BUY_ACTION_ID &&
                (nPlayerBalance <= nCoconutMarketPrice && nPlayerBalance <= nRiceMarketPrice &&
                 nPlayerBalance <= nSilkMarketPrice && nPlayerBalance <= nGunMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou can't afford to buy any cargo!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou can't afford to buy any cargo!\n", nLeftPaddingSize, ' ');
     } else if (cChosenActionId == SELL_ACTION_ID && nShipTotalCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou have no cargo to sell!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou have no cargo to sell!\n", nLeftPaddingSize, ' ');
     } else if (cChosenActionId == UPGRADE_ACTION_ID && nShipCargoLimit == TIER_FOUR_SHIP_CARGO_LIMIT) {
-      setConsoleColorToRed();
-      printf("%*cYour ship is already in the highest tier!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYour ship is already in the highest tier!\n", nLeftPaddingSize, ' ');
     } else if (cChosenActionId == UPGRADE_ACTION_ID &&
                ((nShipCargoLimit == 75 && nPlayerBalance < TIER_TWO_SHIP_UPGRADE_COST) ||
                 (nShipCargoLimit == 150 && nPlayerBalance < TIER_THREE_SHIP_UPGRADE_COST) ||
                 (nShipCargoLimit == 225 && nPlayerBalance < TIER_FOUR_SHIP_UPGRADE_COST))) {
-      setConsoleColorToRed();
-      printf("%*cYou can't afford to upgrade your ship!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou can't afford to upgrade your ship!\n", nLeftPaddingSize, ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return cChosenActionId;
@@ -248,37 +250,39 @@ char promptForActionId(int nShipTotalCargoAmount, int nShipCargoLimit, int nPlay
 char promptForCargoId(char cTransactionType, int nPlayerBalance, int nCoconutMarketPrice, int nRiceMarketPrice,
                       int nSilkMarketPrice, int nGunMarketPrice, int nShipCoconutCargoAmount, int nShipRiceCargoAmount,
                       int nShipSilkCargoAmount, int nShipGunCargoAmount) {
-  int nLeftPaddingSize = 64;
+  int nLeftPaddingSize = getLayoutPaddingSize(64);
 
-  // Print out the correct prompt.
-  if (cTransactionType == BUY_ACTION_ID) {
-    printf("%*cWhat would you like to buy?\n", nLeftPaddingSize, ' ');
-  } else {
-    printf("%*cWhat would you like to sell?\n", nLeftPaddingSize, ' ');
-  }
+  if (!hasQueuedInput()) {
+    // Print out the correct prompt.
+    if (cTransactionType == BUY_ACTION_ID) {
+      printRenderedText("%*cWhat would you like to buy?\n", nLeftPaddingSize, ' ');
+    } else {
+      printRenderedText("%*cWhat would you like to sell?\n", nLeftPaddingSize, ' ');
+    }
 
-  // Print out all viable cargo ID choices.
-  if (cTransactionType == BUY_ACTION_ID) {
-    if (nPlayerBalance > nCoconutMarketPrice) printf("%*c‣ [C] Coconut\n", nLeftPaddingSize, ' ');
+    // Print out all viable cargo ID choices.
+    if (cTransactionType == BUY_ACTION_ID) {
+      if (nPlayerBalance > nCoconutMarketPrice) printRenderedText("%*c‣ [C] Coconut\n", nLeftPaddingSize, ' ');
 
-    if (nPlayerBalance > nRiceMarketPrice) printf("%*c‣ [R] Rice\n", nLeftPaddingSize, ' ');
+      if (nPlayerBalance > nRiceMarketPrice) printRenderedText("%*c‣ [R] Rice\n", nLeftPaddingSize, ' ');
 
-    if (nPlayerBalance > nSilkMarketPrice) printf("%*c‣ [S] Silk\n", nLeftPaddingSize, ' ');
+      if (nPlayerBalance > nSilkMarketPrice) printRenderedText("%*c‣ [S] Silk\n", nLeftPaddingSize, ' ');
 
-    if (nPlayerBalance > nGunMarketPrice) printf("%*c‣ [G] Gun\n", nLeftPaddingSize, ' ');
-  } else {
-    if (nShipCoconutCargoAmount > 0) printf("%*c‣ [C] Coconut\n", nLeftPaddingSize, ' ');
+      if (nPlayerBalance > nGunMarketPrice) printRenderedText("%*c‣ [G] Gun\n", nLeftPaddingSize, ' ');
+    } else {
+      if (nShipCoconutCargoAmount > 0) printRenderedText("%*c‣ [C] Coconut\n", nLeftPaddingSize, ' ');
 
-    if (nShipRiceCargoAmount > 0) printf("%*c‣ [R] Rice\n", nLeftPaddingSize, ' ');
+      if (nShipRiceCargoAmount > 0) printRenderedText("%*c‣ [R] Rice\n", nLeftPaddingSize, ' ');
 
-    if (nShipSilkCargoAmount > 0) printf("%*c‣ [S] Silk\n", nLeftPaddingSize, ' ');
+      if (nShipSilkCargoAmount > 0) printRenderedText("%*c‣ [S] Silk\n", nLeftPaddingSize, ' ');
 
-    if (nShipGunCargoAmount > 0) printf("%*c‣ [G] Gun\n", nLeftPaddingSize, ' ');
-  }
+      if (nShipGunCargoAmount > 0) printRenderedText("%*c‣ [G] Gun\n", nLeftPaddingSize, ' ');
+    }
 
-  printf("\n");
+    printRenderedText("\n");
 
-  printf("%*c‣ [X] Return To Main Menu\n", nLeftPaddingSize, ' ');
+    printRenderedText("%*c‣ [X] Return To Main Menu\n", nLeftPaddingSize, ' ');
+  }
 
   char cChosenCargoId;
   // If the cargo ID the player provided is invalid, repeatedly make the player input a new one until it's valid.
@@ -289,48 +293,33 @@ char promptForCargoId(char cTransactionType, int nPlayerBalance, int nCoconutMar
 
     if (cChosenCargoId != COCONUT_CARGO_ID && cChosenCargoId != RICE_CARGO_ID && cChosenCargoId != SILK_CARGO_ID &&
         cChosenCargoId != GUN_CARGO_ID && cChosenCargoId != CANCEL_ACTION_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize,
+                      ' ');
     } else if (cTransactionType == BUY_ACTION_ID && cChosenCargoId == COCONUT_CARGO_ID &&
                nPlayerBalance < nCoconutMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy a coconut!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy a coconut!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == BUY_ACTION_ID && cChosenCargoId == RICE_CARGO_ID &&
                nPlayerBalance < nRiceMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy rice!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy rice!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == BUY_ACTION_ID && cChosenCargoId == SILK_CARGO_ID &&
                nPlayerBalance < nSilkMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy silk!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy silk!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == BUY_ACTION_ID && cChosenCargoId == 'G' && nPlayerBalance < nGunMarketPrice) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy a gun!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy a gun!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == SELL_ACTION_ID && cChosenCargoId == COCONUT_CARGO_ID &&
                nShipCoconutCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any coconuts to sell!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have any coconuts to sell!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == SELL_ACTION_ID && cChosenCargoId == RICE_CARGO_ID && nShipRiceCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any rice to sell!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have any rice to sell!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == SELL_ACTION_ID && cChosenCargoId == SILK_CARGO_ID && nShipSilkCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any silk to sell!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have any silk to sell!\n", nLeftPaddingSize, ' ');
     } else if (cTransactionType == SELL_ACTION_ID && cChosenCargoId == GUN_CARGO_ID && nShipGunCargoAmount == 0) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have any guns to sell!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have any guns to sell!\n", nLeftPaddingSize, ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return cChosenCargoId;
@@ -353,20 +342,20 @@ char promptForCargoId(char cTransactionType, int nPlayerBalance, int nCoconutMar
  * @param nShipSilkCargoAmount The amount of silk cargo carried by the ship.
  * @param nShipGunCargoAmount The amount of gun cargo carried by the ship.
  * @returns An integer value greater than `0`.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
 int promptForCargoAmount(char cTransactionType, int nShipCargoLimit, char cCargoId, int nPlayerBalance,
                          int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice, int nGunMarketPrice,
                          int nShipCoconutCargoAmount, int nShipRiceCargoAmount, int nShipSilkCargoAmount,
                          int nShipGunCargoAmount) {
-  int nLeftPaddingSize = 57;
+  int nLeftPaddingSize = getLayoutPaddingSize(57);
 
-  // Print out the correct prompt.
-  if (cTransactionType == BUY_ACTION_ID) {
-    printf("%*cEnter the amount of cargo you want to buy\n", nLeftPaddingSize, ' ');
-  } else {
-    printf("%*cEnter the amount of cargo you want to sell\n", nLeftPaddingSize, ' ');
+  if (!hasQueuedInput()) {
+    // Print out the correct prompt.
+    if (cTransactionType == BUY_ACTION_ID) {
+      printRenderedText("%*cEnter the amount of cargo you want to buy\n", nLeftPaddingSize, ' ');
+    } else {
+      printRenderedText("%*cEnter the amount of cargo you want to sell\n", nLeftPaddingSize, ' ');
+    }
   }
 
   int nCargoAmount;
@@ -377,53 +366,40 @@ int promptForCargoAmount(char cTransactionType, int nShipCargoLimit, char cCargo
     nCargoAmount = getIntegerInput(nLeftPaddingSize);
 
     if (nCargoAmount < 1) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter an integer greater than 0!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter an integer greater than 0!\n", nLeftPaddingSize, ' ');
     } else if (nCargoAmount > nShipCargoLimit) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough storage to buy this amount of cargo!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough storage to buy this amount of cargo!\n",
+                      nLeftPaddingSize, ' ');
     } else if (cTransactionType == BUY_ACTION_ID && cCargoId == COCONUT_CARGO_ID &&
                nPlayerBalance < (nCargoAmount * nCoconutMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d coconuts!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy %d coconuts!\n", nLeftPaddingSize, ' ',
+                      nCargoAmount);
     } else if (cTransactionType == BUY_ACTION_ID && cCargoId == RICE_CARGO_ID &&
                nPlayerBalance < (nCargoAmount * nRiceMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d rice!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy %d rice!\n", nLeftPaddingSize, ' ',
+                      nCargoAmount);
     } else if (cTransactionType == BUY_ACTION_ID && cCargoId == SILK_CARGO_ID &&
                nPlayerBalance < (nCargoAmount * nSilkMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d silk!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy %d silk!\n", nLeftPaddingSize, ' ',
+                      nCargoAmount);
     } else if (cTransactionType == BUY_ACTION_ID && cCargoId == GUN_CARGO_ID &&
                nPlayerBalance < (nCargoAmount * nGunMarketPrice)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to buy %d guns!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to buy %d guns!\n", nLeftPaddingSize, ' ',
+                      nCargoAmount);
     } else if (cTransactionType == SELL_ACTION_ID && cCargoId == COCONUT_CARGO_ID &&
                nShipCoconutCargoAmount < nCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d coconuts to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have %d coconuts to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
     } else if (cTransactionType == SELL_ACTION_ID && cCargoId == RICE_CARGO_ID && nShipRiceCargoAmount < nCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d rice to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have %d rice to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
     } else if (cTransactionType == SELL_ACTION_ID && cCargoId == SILK_CARGO_ID && nShipSilkCargoAmount < nCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d silk to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have %d silk to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
     } else if (cTransactionType == SELL_ACTION_ID && cCargoId == GUN_CARGO_ID && nShipGunCargoAmount < nCargoAmount) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have %d guns to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have %d guns to sell!\n", nLeftPaddingSize, ' ', nCargoAmount);
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return nCargoAmount;
@@ -433,31 +409,39 @@ int promptForCargoAmount(char cTransactionType, int nShipCargoLimit, char cCargo
  * Prompts the player to input a confirmation on whether they want to upgrade their ship or not.
  * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
  * @param nPlayerBalance The player's gold coin balance.
+ * @param nPlayerTurns The number of turns the player has exhausted.
  * @returns `1` if the player wants to upgrade or `0` if they do not.
- * @bug Inputting a character or a string, or even just a long integer or float, as a response will result in an
- * infinite loop because the buffer cannot be cleared with any of the prescribed functions.
  */
-int promptForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance) {
-  int nLeftPaddingSize = 57;
-
-  printf("%*cDo you want to upgrade your ship? [Y / N]\n", nLeftPaddingSize, ' ');
-
-  // Print out the correct ship upgrade details.
-  if (nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
-    printf(
-      "%*c• Cost: %d\n"
-      "%*c• New Cargo Capacity: %d\n",
-      nLeftPaddingSize, ' ', TIER_TWO_SHIP_UPGRADE_COST, nLeftPaddingSize, ' ', TIER_TWO_SHIP_CARGO_LIMIT);
-  } else if (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
-    printf(
-      "%*c• Cost: %d\n"
-      "%*c• New Cargo Capacity: %d\n",
-      nLeftPaddingSize, ' ', TIER_THREE_SHIP_UPGRADE_COST, nLeftPaddingSize, ' ', TIER_THREE_SHIP_CARGO_LIMIT);
-  } else {
-    printf(
-      "%*c• Cost: %d\n"
-      "%*c• New Cargo Capacity: %d\n",
-      nLeftPaddingSize, ' ', TIER_FOUR_SHIP_UPGRADE_COST, nLeftPaddingSize, ' ', TIER_FOUR_SHIP_CARGO_LIMIT);
+int promptForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance, int nPlayerTurns) {
+  int nLeftPaddingSize = getLayoutPaddingSize(57);
+
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cDo you want to upgrade your ship? [Y / N]\n", nLeftPaddingSize, ' ');
+
+    // Print out the correct ship upgrade details.
+    if (nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
+      printRenderedText(
+        "%*c• Cost: %d\n"
+        "%*c• New Cargo Capacity: %d\n",
+        nLeftPaddingSize, ' ', TIER_TWO_SHIP_UPGRADE_COST, nLeftPaddingSize, ' ', TIER_TWO_SHIP_CARGO_LIMIT);
+    } else if (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
+      printRenderedText(
+        "%*c• Cost: %d\n"
+        "%*c• New Cargo Capacity: %d\n",
+        nLeftPaddingSize, ' ', TIER_THREE_SHIP_UPGRADE_COST, nLeftPaddingSize, ' ', TIER_THREE_SHIP_CARGO_LIMIT);
+    } else {
+      printRenderedText(
+        "%*c• Cost: %d\n"
+        "%*c• New Cargo Capacity: %d\n",
+        nLeftPaddingSize, ' ', TIER_FOUR_SHIP_UPGRADE_COST, nLeftPaddingSize, ' ', TIER_FOUR_SHIP_CARGO_LIMIT);
+    }
+
+    // Print out whether the upgrade is expected to pay for itself before the game ends.
+    int nShipUpgradeValue = getShipUpgradeValue(nShipCurrentCargoLimit, nPlayerBalance, nPlayerTurns);
+
+    printRenderedText("%*c• Expected Net Value:", nLeftPaddingSize, ' ');
+
+    printStyledText(nShipUpgradeValue > 0 ? GREEN_COLOR_ID : RED_COLOR_ID, " %d Gold Coins\n", nShipUpgradeValue);
   }
 
   char cPlayerIsUpgrading;
@@ -468,19 +452,19 @@ int promptForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance) {
     cPlayerIsUpgrading = toupper(getCharacterInput(nLeftPaddingSize));
 
     if (cPlayerIsUpgrading != YES_ID && cPlayerIsUpgrading != NO_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize,
+                      ' ');
     } else if ((nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT && nPlayerBalance < TIER_TWO_SHIP_UPGRADE_COST) ||
                (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT && nPlayerBalance < TIER_THREE_SHIP_UPGRADE_COST) ||
                (nShipCurrentCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT &&
                 nPlayerBalance < TIER_FOUR_SHIP_UPGRADE_COST)) {
-      setConsoleColorToRed();
-      printf("%*cYou do not have enough gold coins to upgrade your ship!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou do not have enough gold coins to upgrade your ship!\n", nLeftPaddingSize,
+                      ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   if (cPlayerIsUpgrading == YES_ID) {
@@ -494,26 +478,40 @@ int promptForShipUpgrade(int nShipCurrentCargoLimit, int nPlayerBalance) {
  * Prompts the player to input the ID of the port they want to navigate to.
  * @param cCurrentPortId The current port's ID.
  * @pre @p cCurrentPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param nPlayerTurns The number of turns the player has exhausted.
  * @returns A character value of `'T'` for Tondo, `'M'` for Manila, `'P'` for Pandakan, `'S'` for Sapa, or `'X'` for
  * returning to the main menu.
  */
-char promptForPortId(char cCurrentPortId) {
-  int nLeftPaddingSize = 64;
+char promptForPortId(char cCurrentPortId, int nPlayerTurns) {
+  int nLeftPaddingSize = getLayoutPaddingSize(64);
+
+  if (!hasQueuedInput()) {
+    printRenderedText("%*cWhere would you like to go?\n", nLeftPaddingSize, ' ');
 
-  printf("%*cWhere would you like to go?\n", nLeftPaddingSize, ' ');
+    // Print out all viable port ID choices.
+    if (cCurrentPortId != 'T') printRenderedText("%*c‣ [T] Tondo \n", nLeftPaddingSize, ' ');
 
-  // Print out all viable port ID choices.
-  if (cCurrentPortId != 'T') printf("%*c‣ [T] Tondo \n", nLeftPaddingSize, ' ');
+    if (cCurrentPortId != 'M') printRenderedText("%*c‣ [M] Manila \n", nLeftPaddingSize, ' ');
 
-  if (cCurrentPortId != 'M') printf("%*c‣ [M] Manila \n", nLeftPaddingSize, ' ');
+    if (cCurrentPortId != 'P') printRenderedText("%*c‣ [P] Pandakan\n", nLeftPaddingSize, ' ');
 
-  if (cCurrentPortId != 'P') printf("%*c‣ [P] Pandakan\n", nLeftPaddingSize, ' ');
+    if (cCurrentPortId != 'S') printRenderedText("%*c‣ [S] Sapa\n", nLeftPaddingSize, ' ');
 
-  if (cCurrentPortId != 'S') printf("%*c‣ [S] Sapa\n", nLeftPaddingSize, ' ');
+    printRenderedText("\n");
 
-  printf("\n");
+    // Print out the port with the best expected earnings until the end of the game.
+    char cRecommendedPortId = getRecommendedPortId(cCurrentPortId, nPlayerTurns);
+    int nRouteValue = getRouteValue(cCurrentPortId, cRecommendedPortId, nPlayerTurns);
 
-  printf("%*c‣ [X] Return To Main Menu\n", nLeftPaddingSize, ' ');
+    if (nRouteValue > 0) {
+      printStyledText(GREEN_COLOR_ID, "%*c• Recommended: [%c] (~%d gold coins per cargo space)\n", nLeftPaddingSize,
+                      ' ', cRecommendedPortId, nRouteValue);
+
+      printRenderedText("\n");
+    }
+
+    printRenderedText("%*c‣ [X] Return To Main Menu\n", nLeftPaddingSize, ' ');
+  }
 
   char cChosenPortId;
   // If the port ID the player provided is invalid, repeatedly make the player input a new one until it's valid.
@@ -524,28 +522,21 @@ char promptForPortId(char cCurrentPortId) {
 
     if (cChosenPortId != TONDO_PORT_ID && cChosenPortId != MANILA_PORT_ID && cChosenPortId != PANDAKAN_PORT_ID &&
         cChosenPortId != SAPA_PORT_ID && cChosenPortId != CANCEL_ACTION_ID) {
-      setConsoleColorToRed();
-      printf("%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cPlease only enter one of the provided character options!\n", nLeftPaddingSize,
+                      ' ');
     } else if (cChosenPortId == TONDO_PORT_ID && cCurrentPortId == TONDO_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Tondo!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou are already in the port of Tondo!\n", nLeftPaddingSize, ' ');
     } else if (cChosenPortId == MANILA_PORT_ID && cCurrentPortId == MANILA_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Manila!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou are already in the port of Manila!\n", nLeftPaddingSize, ' ');
     } else if (cChosenPortId == PANDAKAN_PORT_ID && cCurrentPortId == PANDAKAN_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Pandakan!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou are already in the port of Pandakan!\n", nLeftPaddingSize, ' ');
     } else if (cChosenPortId == SAPA_PORT_ID && cCurrentPortId == SAPA_PORT_ID) {
-      setConsoleColorToRed();
-      printf("%*cYou are already in the port of Sapa!\n", nLeftPaddingSize, ' ');
-      resetConsoleColor();
+      printStyledText(RED_COLOR_ID, "%*cYou are already in the port of Sapa!\n", nLeftPaddingSize, ' ');
     } else {
       bInputIsValid = 1;
     }
+
+    if (!bInputIsValid) discardQueuedInput();
   } while (!bInputIsValid);
 
   return cChosenPortId;
@@ -0,0 +1,258 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose clock_gettime(), nanosleep(), and isatty() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "recording.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "console.h"
+#include "json-lines.h"
+#include "layout.h"
+#include "rendering.h"
+
+// Written by the game thread.
+static long long llWaitedChunkAmount = 0;
+
+// Written by the writer thread.
+static long long llRecordedChunkAmount = 0;
+
+/**
+ * Gets the counters of the current or last session recording, which are only exact after it has been stopped.
+ * @param[out] llRecordedAmount The number of output chunks written to the file.
+ * @param[out] llWaitedAmount The number of output chunks that had to wait for space because the ring was full.
+ */
+void getSessionRecordingAmounts(long long *llRecordedAmount, long long *llWaitedAmount) {
+  *llRecordedAmount = llRecordedChunkAmount;
+  *llWaitedAmount = llWaitedChunkAmount;
+}
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+// The recording's file, if one has been started.
+static FILE *pRecordingFile = NULL;
+static struct timespec sRecordingStart;
+
+// The ring of output chunks, which only the game thread pushes into and only the writer thread pops from.
+static unsigned long long ullRecordingHead = 0;
+static unsigned long long ullRecordingTail = 0;
+static int bRecordingIsStopping = 0;
+static RecordedChunk asRecordedChunks[SESSION_RECORDING_CAPACITY];
+
+// Only used by the writer thread.
+static int bRecordingHasFailed = 0;
+
+static int bRecordingThreadIsStarted = 0;
+static pthread_t sRecordingThread;
+
+/**
+ * Writes an output chunk's text as an escaped JSON string.
+ * @param pText The text, which is not null-terminated.
+ * @param nTextSize The number of characters in the text.
+ */
+static void writeRecordedText(const char *pText, int nTextSize) {
+  static const char acHexDigits[] = "0123456789abcdef";
+
+  putc('"', pRecordingFile);
+
+  for (int nCharacterIndex = 0; nCharacterIndex < nTextSize; nCharacterIndex++) {
+    unsigned char ucCharacter = (unsigned char)pText[nCharacterIndex];
+
+    if (ucCharacter == '"' || ucCharacter == '\\') {
+      putc('\\', pRecordingFile);
+      putc(ucCharacter, pRecordingFile);
+    } else if (ucCharacter == '\n') {
+      fputs("\\n", pRecordingFile);
+    } else if (ucCharacter == '\r') {
+      fputs("\\r", pRecordingFile);
+    } else if (ucCharacter < 0x20 || ucCharacter == 0x7F) {
+      // The color codes start with an escape character, which is the most common one to be written this way.
+      fprintf(pRecordingFile, "\\u00%c%c", acHexDigits[ucCharacter >> 4], acHexDigits[ucCharacter & 0xF]);
+    } else {
+      putc(ucCharacter, pRecordingFile);
+    }
+  }
+
+  putc('"', pRecordingFile);
+}
+
+/**
+ * Writes every output chunk in the ring as an event.
+ * @returns The number of output chunks popped from the ring.
+ */
+static int writeRecordedChunks(void) {
+  // Read the head only after the ring's chunks are visible, which the game thread publishes with the head.
+  unsigned long long ullHead = __atomic_load_n(&ullRecordingHead, __ATOMIC_ACQUIRE);
+  unsigned long long ullTail = ullRecordingTail;
+  int nChunkAmount = (int)(ullHead - ullTail);
+
+  if (nChunkAmount == 0) return 0;
+
+  for (; ullTail != ullHead; ullTail++) {
+    const RecordedChunk *pChunk = &asRecordedChunks[ullTail % SESSION_RECORDING_CAPACITY];
+
+    fprintf(pRecordingFile, "[%.6f, \"o\", ", pChunk->dSeconds);
+    writeRecordedText(pChunk->acText, pChunk->nTextSize);
+    fputs("]\n", pRecordingFile);
+
+    llRecordedChunkAmount++;
+
+    // Give the slot back as soon as it has been written so that the game thread does not drop the next chunk.
+    __atomic_store_n(&ullRecordingTail, ullTail + 1, __ATOMIC_RELEASE);
+  }
+
+  if (fflush(pRecordingFile) != 0) bRecordingHasFailed = 1;
+
+  return nChunkAmount;
+}
+
+/**
+ * Writes the recorded output chunks until the recording is stopped and its ring is empty.
+ * @param pArgument Nothing.
+ * @returns Nothing.
+ */
+static void *runSessionRecordingWriter(void *pArgument) {
+  long lIdleNanoseconds = SESSION_RECORDING_MINIMUM_IDLE_NANOSECONDS;
+
+  (void)pArgument;
+
+  for (;;) {
+    // Check for stopping before emptying the ring, since every chunk is pushed before the recording is stopped.
+    int bIsStopping = __atomic_load_n(&bRecordingIsStopping, __ATOMIC_ACQUIRE);
+
+    if (writeRecordedChunks() > 0) {
+      lIdleNanoseconds = SESSION_RECORDING_MINIMUM_IDLE_NANOSECONDS;
+    } else if (bIsStopping) {
+      break;
+    } else {
+      struct timespec sDuration = {0, lIdleNanoseconds};
+
+      nanosleep(&sDuration, NULL);
+
+      if (lIdleNanoseconds < SESSION_RECORDING_MAXIMUM_IDLE_NANOSECONDS) lIdleNanoseconds *= 2;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * Copies a chunk of the console's output into the recording's ring without doing any I/O.
+ * @param pText The text, which is not null-terminated.
+ * @param nTextSize The number of characters in the text.
+ */
+static void pushRecordedChunk(const char *pText, int nTextSize) {
+  unsigned long long ullHead = ullRecordingHead;
+
+  // The player never types fast enough to fill the ring, but a script or a pipe can.
+  if (ullHead - __atomic_load_n(&ullRecordingTail, __ATOMIC_ACQUIRE) == SESSION_RECORDING_CAPACITY) {
+    struct timespec sDuration = {0, SESSION_RECORDING_WAIT_NANOSECONDS};
+
+    llWaitedChunkAmount++;
+
+    do {
+      nanosleep(&sDuration, NULL);
+    } while (ullHead - __atomic_load_n(&ullRecordingTail, __ATOMIC_ACQUIRE) == SESSION_RECORDING_CAPACITY);
+  }
+
+  RecordedChunk *pChunk = &asRecordedChunks[ullHead % SESSION_RECORDING_CAPACITY];
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+
+  if (nTextSize > CONSOLE_FRAME_SIZE) nTextSize = CONSOLE_FRAME_SIZE;
+
+  pChunk->dSeconds = (double)(sNow.tv_sec - sRecordingStart.tv_sec) + (sNow.tv_nsec - sRecordingStart.tv_nsec) / 1e9;
+  pChunk->nTextSize = nTextSize;
+
+  memcpy(pChunk->acText, pText, nTextSize);
+
+  // Publish the chunk to the writer thread together with the head.
+  __atomic_store_n(&ullRecordingHead, ullHead + 1, __ATOMIC_RELEASE);
+
+  // Without a writer thread, the game thread writes its own chunks.
+  if (!bRecordingThreadIsStarted) writeRecordedChunks();
+}
+
+/**
+ * Starts recording everything printed to the console into an asciicast v2 file, replacing any file with the same
+ * path. The game thread only timestamps and copies every output chunk into a ring, which a background thread writes
+ * out from, and only waits for the thread if the ring is full. If the thread cannot be started, the chunks are written
+ * by the game thread instead.
+ * @param strFilePath The path of the file.
+ * @returns `1` if the recording was started or `0` if its file could not be opened or the console already has too
+ * many output chunk handlers.
+ */
+int startSessionRecording(const char *strFilePath) {
+  struct winsize sWindowSize;
+  int nHeight = SESSION_RECORDING_DEFAULT_HEIGHT;
+  JsonLine sHeader;
+
+  pRecordingFile = fopen(strFilePath, "w");
+
+  if (pRecordingFile == NULL) return 0;
+
+  if (isatty(STDOUT_FILENO) && ioctl(STDOUT_FILENO, TIOCGWINSZ, &sWindowSize) == 0 && sWindowSize.ws_row > 0) {
+    nHeight = sWindowSize.ws_row;
+  }
+
+  beginJsonLine(&sHeader);
+  addJsonIntegerField(&sHeader, "version", SESSION_RECORDING_VERSION);
+  addJsonIntegerField(&sHeader, "width", getLayoutWidth());
+  addJsonIntegerField(&sHeader, "height", nHeight);
+  addJsonIntegerField(&sHeader, "timestamp", time(NULL));
+
+  bRecordingHasFailed = !writeJsonLine(&sHeader, pRecordingFile);
+
+  clock_gettime(CLOCK_MONOTONIC, &sRecordingStart);
+
+  ullRecordingHead = 0;
+  ullRecordingTail = 0;
+  bRecordingIsStopping = 0;
+  llRecordedChunkAmount = 0;
+  llWaitedChunkAmount = 0;
+
+  if (!addOutputChunkHandler(pushRecordedChunk)) {
+    fclose(pRecordingFile);
+
+    pRecordingFile = NULL;
+
+    return 0;
+  }
+
+  bRecordingThreadIsStarted = pthread_create(&sRecordingThread, NULL, runSessionRecordingWriter, NULL) == 0;
+
+  return 1;
+}
+
+/**
+ * Writes every recorded output chunk, stops the writer thread, and closes the recording's file.
+ * @returns `1` if every output chunk was written or `0` if the file could not be written to.
+ */
+int stopSessionRecording(void) {
+  if (pRecordingFile == NULL) return 0;
+
+  fflush(stdout);
+  removeOutputChunkHandler(pushRecordedChunk);
+
+  __atomic_store_n(&bRecordingIsStopping, 1, __ATOMIC_RELEASE);
+
+  if (bRecordingThreadIsStarted) pthread_join(sRecordingThread, NULL);
+
+  int bIsWritten = fclose(pRecordingFile) == 0 && !bRecordingHasFailed;
+
+  pRecordingFile = NULL;
+
+  return bIsWritten;
+}
+#endif
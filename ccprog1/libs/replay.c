@@ -0,0 +1,219 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "replay.h"
+
+#include <stdlib.h>
+
+#include "engine.h"
+#include "events.h"
+#include "prompts.h"
+#include "simulation.h"
+#include "trading.h"
+
+/** Everything a replay remembers about the game being replayed. */
+typedef struct ReplayedGame {
+  GameState sGameState;
+  unsigned int unStateHash;
+  char cPriceSourceId;
+  const PriceTape *pPriceTape;
+  int nGameIndex;
+  unsigned short aunGeneratedPrices[PRICE_TAPE_GAME_PRICE_AMOUNT];
+  PriceTape sGeneratedPriceTape;
+} ReplayedGame;
+
+/**
+ * Starts replaying a game from its game start event.
+ * @param[out] pGame The replayed game.
+ * @param pGameEvent The game start event.
+ * @param pPriceTape The price tape that the games were simulated with, or `NULL` if none of them were.
+ * @returns `0` if the game can be replayed, or `'T'` if its price tape is missing or too short.
+ */
+static char startReplayedGame(ReplayedGame *pGame, const GameEvent *pGameEvent, const PriceTape *pPriceTape) {
+  initializeGameState(&pGame->sGameState, pGameEvent->nPlayerBalance);
+
+  pGame->unStateHash = 0;
+  pGame->cPriceSourceId = pGameEvent->cPriceSourceId;
+
+  switch (pGameEvent->cPriceSourceId) {
+    case RAND_PRICE_SOURCE_ID: {
+      srand((unsigned int)pGameEvent->ullSeed);
+
+      break;
+    }
+    case LIVE_PRICE_SOURCE_ID: {
+      break;
+    }
+    case SEEDED_PRICE_SOURCE_ID: {
+      generatePriceTapeGame(pGameEvent->ullSeed, pGame->aunGeneratedPrices);
+
+      pGame->sGeneratedPriceTape.nGameAmount = 1;
+      pGame->sGeneratedPriceTape.ullFirstSeed = pGameEvent->ullSeed;
+      pGame->sGeneratedPriceTape.aunPrices = pGame->aunGeneratedPrices;
+      pGame->pPriceTape = &pGame->sGeneratedPriceTape;
+      pGame->nGameIndex = 0;
+
+      break;
+    }
+    // Set to default instead of 'T' to satisfy the compiler
+    default: {
+      if (pPriceTape == NULL || pGameEvent->ullSeed >= (unsigned long long)pPriceTape->nGameAmount) {
+        return TAPE_DIVERGENCE_ID;
+      }
+
+      pGame->pPriceTape = pPriceTape;
+      pGame->nGameIndex = (int)pGameEvent->ullSeed;
+
+      break;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Replays an event of a game that has already started.
+ * @param[out] pGame The replayed game.
+ * @param pGameEvent The event, which must not be a game start event.
+ * @returns `0` if the event matches the replay, or the ID of the divergence if it does not.
+ */
+static char replayGameEvent(ReplayedGame *pGame, const GameEvent *pGameEvent) {
+  GameState *pGameState = &pGame->sGameState;
+  GameAction sGameAction = {0};
+
+  switch (pGameEvent->cEventId) {
+    case MARKET_EVENT_ID: {
+      if (pGame->cPriceSourceId == RAND_PRICE_SOURCE_ID) {
+        generateGameMarketPrices(pGameState);
+      } else if (pGame->cPriceSourceId == LIVE_PRICE_SOURCE_ID) {
+        // Ticked prices depend on when the player looked, so they are taken from the log if they are within range.
+        for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+          int nMinimumPrice;
+          int nMaximumPrice;
+
+          getCargoPriceRange(pGameState->cPortId, getCargoId(nCargoIndex), &nMinimumPrice, &nMaximumPrice);
+
+          if (pGameEvent->anMarketPrices[nCargoIndex] < nMinimumPrice ||
+              pGameEvent->anMarketPrices[nCargoIndex] > nMaximumPrice) {
+            return MARKET_DIVERGENCE_ID;
+          }
+
+          pGameState->anMarketPrices[nCargoIndex] = pGameEvent->anMarketPrices[nCargoIndex];
+        }
+      } else {
+        readPriceTapeMarketPrices(pGame->pPriceTape, pGame->nGameIndex, pGameState);
+      }
+
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+        if (pGameState->anMarketPrices[nCargoIndex] != pGameEvent->anMarketPrices[nCargoIndex]) {
+          return MARKET_DIVERGENCE_ID;
+        }
+      }
+
+      return 0;
+    }
+    case TRADE_EVENT_ID: {
+      if (pGameState->anMarketPrices[getCargoIndex(pGameEvent->cCargoId)] != pGameEvent->nCargoPrice) {
+        return MARKET_DIVERGENCE_ID;
+      }
+
+      sGameAction.cActionId = pGameEvent->cActionId;
+      sGameAction.cCargoId = pGameEvent->cCargoId;
+      sGameAction.nCargoAmount = pGameEvent->nCargoAmount;
+
+      break;
+    }
+    case UPGRADE_EVENT_ID: {
+      sGameAction.cActionId = UPGRADE_ACTION_ID;
+
+      break;
+    }
+    case VOYAGE_EVENT_ID: {
+      pGame->unStateHash = rollGameStateHash(pGame->unStateHash, pGameState);
+
+      if (pGame->unStateHash != pGameEvent->unStateHash) return STATE_DIVERGENCE_ID;
+
+      sGameAction.cActionId = NAVIGATE_ACTION_ID;
+      sGameAction.cPortId = pGameEvent->cPortId;
+
+      break;
+    }
+    // Set to default instead of 'E' to satisfy the compiler
+    default: {
+      // Games only end before the last turn when the player quits.
+      pGameState->bPlayerHasQuit = pGameState->nPlayerTurns < MAXIMUM_PLAYER_TURNS;
+      pGame->unStateHash = rollGameStateHash(pGame->unStateHash, pGameState);
+
+      if (pGameState->nPlayerBalance != pGameEvent->nPlayerBalance) return BALANCE_DIVERGENCE_ID;
+
+      if (pGame->unStateHash != pGameEvent->unStateHash) return STATE_DIVERGENCE_ID;
+
+      return 0;
+    }
+  }
+
+  return applyGameAction(pGameState, &sGameAction) ? 0 : ACTION_DIVERGENCE_ID;
+}
+
+/**
+ * Replays every game in an event log with the engine, stopping at the first divergence. Every game is started from its
+ * recorded seed, the market prices are generated again and compared with the recorded ones, every recorded trade,
+ * upgrade, and voyage is applied again, and the state at the end of every turn is checked against the recorded rolling
+ * state hash. Nothing is printed.
+ * @param[out] pReader The reader of the event log, which must not have read any events yet.
+ * @param pPriceTape The price tape that the games were simulated with, or `NULL` if none of them were.
+ * @param[out] pResult What happened while replaying.
+ * @returns `1` if every event was replayed or a divergence was found, or `0` if the log is corrupted.
+ */
+int replayEventLog(EventLogReader *pReader, const PriceTape *pPriceTape, ReplayResult *pResult) {
+  ReplayedGame sGame;
+  GameEvent sGameEvent;
+  int bIsInGame = 0;
+  int nReadResult;
+
+  pResult->llGameAmount = 0;
+  pResult->llEventAmount = 0;
+  pResult->llTurnAmount = 0;
+  pResult->cDivergenceId = 0;
+
+  while ((nReadResult = readGameEvent(pReader, &sGameEvent)) == 1) {
+    char cDivergenceId;
+
+    // Every game's events must be enclosed by a game start and a game end.
+    if (sGameEvent.cEventId == GAME_START_EVENT_ID) {
+      if (bIsInGame) return 0;
+
+      cDivergenceId = startReplayedGame(&sGame, &sGameEvent, pPriceTape);
+      bIsInGame = 1;
+    } else {
+      if (!bIsInGame) return 0;
+
+      cDivergenceId = replayGameEvent(&sGame, &sGameEvent);
+    }
+
+    pResult->llEventAmount++;
+
+    if (cDivergenceId != 0) {
+      pResult->cDivergenceId = cDivergenceId;
+      pResult->llDivergentGameIndex = pResult->llGameAmount;
+      pResult->sDivergentEvent = sGameEvent;
+      pResult->sDivergentGameState = sGame.sGameState;
+      pResult->unDivergentStateHash = sGame.unStateHash;
+
+      return 1;
+    }
+
+    if (sGameEvent.cEventId == VOYAGE_EVENT_ID) pResult->llTurnAmount++;
+
+    if (sGameEvent.cEventId == GAME_END_EVENT_ID) {
+      pResult->llGameAmount++;
+      bIsInGame = 0;
+    }
+  }
+
+  return nReadResult == 0 && !bIsInGame;
+}
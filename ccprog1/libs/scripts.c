@@ -0,0 +1,372 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scripts.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "engine.h"
+#include "planning.h"
+#include "prompts.h"
+#include "trading.h"
+
+/**
+ * Reads the next whitespace-separated token of a script line, stopping at the end of the line or at a comment.
+ * @param[out] ppcCharacter The position in the script's source, which is moved past the token.
+ * @param[out] acToken The token, which is cut off if it is too long.
+ * @returns `1` if a token was read or `0` if the line has no more tokens.
+ */
+static int readScriptToken(const char **ppcCharacter, char acToken[SCRIPT_TOKEN_SIZE]) {
+  const char *pcCharacter = *ppcCharacter;
+  int nTokenSize = 0;
+
+  while (*pcCharacter == ' ' || *pcCharacter == '\t' || *pcCharacter == '\r') pcCharacter++;
+
+  while (*pcCharacter != '\0' && *pcCharacter != '#' && !isspace((unsigned char)*pcCharacter)) {
+    if (nTokenSize < SCRIPT_TOKEN_SIZE - 1) acToken[nTokenSize++] = *pcCharacter;
+
+    pcCharacter++;
+  }
+
+  acToken[nTokenSize] = '\0';
+  *ppcCharacter = pcCharacter;
+
+  return nTokenSize > 0;
+}
+
+/**
+ * Gets the ID of a cargo from its name in a script.
+ * @param strName The name of the cargo.
+ * @returns `'C'`, `'R'`, `'S'`, or `'G'`, or `0` if the name is not a cargo's.
+ */
+static char getScriptCargoId(const char *strName) {
+  if (strcmp(strName, "coconut") == 0) return COCONUT_CARGO_ID;
+  if (strcmp(strName, "rice") == 0) return RICE_CARGO_ID;
+  if (strcmp(strName, "silk") == 0) return SILK_CARGO_ID;
+  if (strcmp(strName, "gun") == 0) return GUN_CARGO_ID;
+
+  return 0;
+}
+
+/**
+ * Gets the ID of a port from its name in a script.
+ * @param strName The name of the port.
+ * @returns `'T'`, `'M'`, `'P'`, `'S'`, or `'R'` for the recommended port, or `0` if the name is not a port's.
+ */
+static char getScriptPortId(const char *strName) {
+  if (strcmp(strName, "tondo") == 0) return TONDO_PORT_ID;
+  if (strcmp(strName, "manila") == 0) return MANILA_PORT_ID;
+  if (strcmp(strName, "pandakan") == 0) return PANDAKAN_PORT_ID;
+  if (strcmp(strName, "sapa") == 0) return SAPA_PORT_ID;
+  if (strcmp(strName, "recommended") == 0) return RECOMMENDED_PORT_ID;
+
+  return 0;
+}
+
+/**
+ * Reads a positive integer from a script.
+ * @param strToken The token to read.
+ * @param[out] pnValue The integer.
+ * @returns `1` if the token is a positive integer or `0` if it is not.
+ */
+static int readScriptInteger(const char *strToken, int *pnValue) {
+  char *pcTokenEnd;
+  long lValue = strtol(strToken, &pcTokenEnd, 10);
+
+  if (*pcTokenEnd != '\0' || lValue <= 0 || lValue > SCRIPT_MAXIMUM_OPERAND) return 0;
+
+  *pnValue = (int)lValue;
+
+  return 1;
+}
+
+/**
+ * Compiles a single line of a script into its instruction, if it has one.
+ * @param pcLine The start of the line in the script's source.
+ * @param[out] pScript The script being compiled.
+ * @param[out] anLoopIndices The indices of the loop instructions that have not been ended yet.
+ * @param[out] pnLoopDepth The number of loops that have not been ended yet.
+ * @returns `1` if the line was compiled or `0` if it has an error.
+ */
+static int compileScriptLine(const char *pcLine, Script *pScript, int anLoopIndices[SCRIPT_MAXIMUM_LOOP_DEPTH],
+                             int *pnLoopDepth) {
+  char aacTokens[4][SCRIPT_TOKEN_SIZE];
+  int nTokenAmount = 0;
+
+  while (nTokenAmount < 4 && readScriptToken(&pcLine, aacTokens[nTokenAmount])) nTokenAmount++;
+
+  if (nTokenAmount == 0) return 1;
+
+  // Every command has at most three tokens.
+  if (nTokenAmount == 4 || pScript->nInstructionAmount == SCRIPT_MAXIMUM_INSTRUCTION_AMOUNT) return 0;
+
+  ScriptInstruction *pInstruction = &pScript->aInstructions[pScript->nInstructionAmount];
+  const char *strCommand = aacTokens[0];
+
+  memset(pInstruction, 0, sizeof(*pInstruction));
+
+  if ((strcmp(strCommand, "buy") == 0 || strcmp(strCommand, "sell") == 0) && nTokenAmount == 3) {
+    pInstruction->cInstructionId = strCommand[0] == 'b' ? BUY_INSTRUCTION_ID : SELL_INSTRUCTION_ID;
+    pInstruction->cTargetId = getScriptCargoId(aacTokens[1]);
+
+    if (pInstruction->cTargetId == 0) return 0;
+
+    if (strcmp(aacTokens[2], "max") == 0) {
+      pInstruction->nOperand = SCRIPT_MAXIMUM_AMOUNT;
+    } else if (!readScriptInteger(aacTokens[2], &pInstruction->nOperand)) {
+      return 0;
+    }
+  } else if (strcmp(strCommand, "sell-all") == 0 && nTokenAmount == 1) {
+    pInstruction->cInstructionId = SELL_ALL_INSTRUCTION_ID;
+  } else if (strcmp(strCommand, "sail-to") == 0 && nTokenAmount == 2) {
+    pInstruction->cInstructionId = SAIL_INSTRUCTION_ID;
+    pInstruction->cTargetId = getScriptPortId(aacTokens[1]);
+
+    if (pInstruction->cTargetId == 0) return 0;
+  } else if (strcmp(strCommand, "upgrade-if-affordable") == 0 && nTokenAmount == 1) {
+    pInstruction->cInstructionId = UPGRADE_INSTRUCTION_ID;
+  } else if (strcmp(strCommand, "repeat-until-turn") == 0 && nTokenAmount == 2) {
+    if (*pnLoopDepth == SCRIPT_MAXIMUM_LOOP_DEPTH || !readScriptInteger(aacTokens[1], &pInstruction->nOperand)) {
+      return 0;
+    }
+
+    // The loop's exit is only known once its end is compiled.
+    pInstruction->cInstructionId = LOOP_INSTRUCTION_ID;
+    anLoopIndices[(*pnLoopDepth)++] = pScript->nInstructionAmount;
+  } else if (strcmp(strCommand, "end") == 0 && nTokenAmount == 1) {
+    if (*pnLoopDepth == 0) return 0;
+
+    int nLoopIndex = anLoopIndices[--(*pnLoopDepth)];
+
+    pInstruction->cInstructionId = JUMP_INSTRUCTION_ID;
+    pInstruction->nJumpIndex = nLoopIndex;
+    pScript->aInstructions[nLoopIndex].nJumpIndex = pScript->nInstructionAmount + 1;
+  } else if (strcmp(strCommand, "quit") == 0 && nTokenAmount == 1) {
+    pInstruction->cInstructionId = QUIT_INSTRUCTION_ID;
+  } else {
+    return 0;
+  }
+
+  pScript->nInstructionAmount++;
+
+  return 1;
+}
+
+/**
+ * Compiles the source of a script, which has one command on every line:
+ * - `buy <cargo> <amount | max>` and `sell <cargo> <amount | max>` trade a cargo, where the cargo is `coconut`, `rice`,
+ *   `silk`, or `gun`;
+ * - `sell-all` sells every cargo on the ship;
+ * - `sail-to <port>` ends the turn in `tondo`, `manila`, `pandakan`, `sapa`, or the `recommended` port;
+ * - `upgrade-if-affordable` upgrades the ship if the player can afford it;
+ * - `repeat-until-turn <turn>` repeats the commands up to its `end` until the given turn is reached; and
+ * - `quit` ends the game.
+ * Blank lines and everything after a `#` are ignored. The game is quit once the script runs out of commands.
+ * @param strSource The source of the script.
+ * @param[out] pScript The compiled script.
+ * @param[out] pnErrorLineNumber The number of the first line that could not be compiled, counting from `1`.
+ * @returns `1` if the script was compiled or `0` if it has an error.
+ */
+int compileScript(const char *strSource, Script *pScript, int *pnErrorLineNumber) {
+  int anLoopIndices[SCRIPT_MAXIMUM_LOOP_DEPTH];
+  int nLoopDepth = 0;
+  int nLineNumber = 1;
+
+  pScript->nInstructionAmount = 0;
+  *pnErrorLineNumber = 0;
+
+  for (const char *pcLine = strSource; *pcLine != '\0'; nLineNumber++) {
+    if (!compileScriptLine(pcLine, pScript, anLoopIndices, &nLoopDepth)) {
+      *pnErrorLineNumber = nLineNumber;
+
+      return 0;
+    }
+
+    while (*pcLine != '\0' && *pcLine++ != '\n') continue;
+  }
+
+  // A loop that is never ended is reported at the end of the script.
+  if (nLoopDepth > 0) {
+    *pnErrorLineNumber = nLineNumber;
+
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Reads a script file and compiles its source.
+ * @param strFilePath The path of the file to read.
+ * @param[out] pScript The compiled script.
+ * @param[out] pnErrorLineNumber The number of the first line that could not be compiled, or `0` if the file could not
+ * be read or is larger than `SCRIPT_MAXIMUM_SOURCE_SIZE`.
+ * @returns `1` if the script was compiled or `0` if it could not be read or has an error.
+ */
+int compileScriptFile(const char *strFilePath, Script *pScript, int *pnErrorLineNumber) {
+  static char acSource[SCRIPT_MAXIMUM_SOURCE_SIZE + 1];
+  FILE *pFile = fopen(strFilePath, "rb");
+
+  *pnErrorLineNumber = 0;
+
+  if (pFile == NULL) return 0;
+
+  size_t ulSourceSize = fread(acSource, 1, sizeof(acSource), pFile);
+  int bIsRead = !ferror(pFile) && ulSourceSize <= SCRIPT_MAXIMUM_SOURCE_SIZE;
+
+  fclose(pFile);
+
+  if (!bIsRead) return 0;
+
+  acSource[ulSourceSize] = '\0';
+
+  return compileScript(acSource, pScript, pnErrorLineNumber);
+}
+
+/**
+ * Sets up a script runner before its first game.
+ * @param[out] pRunner The script runner.
+ * @param pScript The compiled script to run.
+ */
+void initializeScriptRunner(ScriptRunner *pRunner, const Script *pScript) {
+  pRunner->pScript = pScript;
+  pRunner->llActionAmount = 0;
+  pRunner->llRejectedActionAmount = 0;
+
+  restartScriptRunner(pRunner);
+}
+
+/**
+ * Starts a script from its first instruction for a new game, keeping the runner's totals.
+ * @param[out] pRunner The script runner.
+ */
+void restartScriptRunner(ScriptRunner *pRunner) {
+  pRunner->nInstructionIndex = 0;
+  pRunner->nSellAllCargoIndex = 0;
+}
+
+/**
+ * Executes the next instruction of a script.
+ * @param pGameState The current state of the game.
+ * @param[out] pRunner The script runner.
+ * @param[out] pGameAction The action that the instruction does.
+ * @returns `1` if the instruction does an action or `0` if it does not.
+ */
+static int executeScriptInstruction(const GameState *pGameState, ScriptRunner *pRunner, GameAction *pGameAction) {
+  const ScriptInstruction *pInstruction = &pRunner->pScript->aInstructions[pRunner->nInstructionIndex];
+
+  memset(pGameAction, 0, sizeof(*pGameAction));
+
+  switch (pInstruction->cInstructionId) {
+    case BUY_INSTRUCTION_ID:
+    case SELL_INSTRUCTION_ID: {
+      int nCargoIndex = getCargoIndex(pInstruction->cTargetId);
+
+      pGameAction->cActionId = pInstruction->cInstructionId == BUY_INSTRUCTION_ID ? BUY_ACTION_ID : SELL_ACTION_ID;
+      pGameAction->cCargoId = pInstruction->cTargetId;
+      pGameAction->nCargoAmount = pInstruction->nOperand;
+
+      if (pInstruction->nOperand == SCRIPT_MAXIMUM_AMOUNT) {
+        pGameAction->nCargoAmount = pGameAction->cActionId == BUY_ACTION_ID
+                                      ? getMaximumBuyAmount(pGameState, pInstruction->cTargetId)
+                                      : pGameState->anShipCargoAmounts[nCargoIndex];
+      }
+
+      pRunner->nInstructionIndex++;
+
+      return pGameAction->nCargoAmount > 0;
+    }
+    case SELL_ALL_INSTRUCTION_ID: {
+      // Stay on the instruction until every cargo has been sold, one action at a time.
+      while (pRunner->nSellAllCargoIndex < CARGO_AMOUNT) {
+        int nCargoIndex = pRunner->nSellAllCargoIndex++;
+
+        if (pGameState->anShipCargoAmounts[nCargoIndex] > 0) {
+          pGameAction->cActionId = SELL_ACTION_ID;
+          pGameAction->cCargoId = getCargoId(nCargoIndex);
+          pGameAction->nCargoAmount = pGameState->anShipCargoAmounts[nCargoIndex];
+
+          return 1;
+        }
+      }
+
+      pRunner->nSellAllCargoIndex = 0;
+      pRunner->nInstructionIndex++;
+
+      return 0;
+    }
+    case SAIL_INSTRUCTION_ID: {
+      pGameAction->cActionId = NAVIGATE_ACTION_ID;
+      pGameAction->cPortId = pInstruction->cTargetId == RECOMMENDED_PORT_ID
+                               ? getRecommendedPortId(pGameState->cPortId, pGameState->nPlayerTurns)
+                               : pInstruction->cTargetId;
+
+      pRunner->nInstructionIndex++;
+
+      return 1;
+    }
+    case UPGRADE_INSTRUCTION_ID: {
+      pGameAction->cActionId = UPGRADE_ACTION_ID;
+
+      pRunner->nInstructionIndex++;
+
+      return isGameActionValid(pGameState, pGameAction);
+    }
+    case LOOP_INSTRUCTION_ID: {
+      if (pGameState->nPlayerTurns >= pInstruction->nOperand) {
+        pRunner->nInstructionIndex = pInstruction->nJumpIndex;
+      } else {
+        pRunner->nInstructionIndex++;
+      }
+
+      return 0;
+    }
+    case JUMP_INSTRUCTION_ID: {
+      pRunner->nInstructionIndex = pInstruction->nJumpIndex;
+
+      return 0;
+    }
+    // Set to default instead of 'Q' to satisfy the compiler
+    default: {
+      pGameAction->cActionId = QUIT_ACTION_ID;
+
+      return 1;
+    }
+  }
+}
+
+/**
+ * Decides the next action of a script by executing its instructions until one of them does an action. Trades of `max`
+ * cargo that amount to nothing and unaffordable upgrades are skipped, while every other action is done and checked
+ * against the same rules that the game's prompts enforce, counting the rejected ones.
+ * @param pGameState The current state of the game.
+ * @param pContext The script runner, which must be a `ScriptRunner`.
+ * @param[out] pGameAction The action that the script wants to do.
+ */
+void chooseScriptAction(const GameState *pGameState, void *pContext, GameAction *pGameAction) {
+  ScriptRunner *pRunner = pContext;
+  // Every instruction can be passed twice without an action before the script is stuck in a loop that does nothing.
+  int nRemainingStepAmount = pRunner->pScript->nInstructionAmount * 2 + CARGO_AMOUNT;
+
+  while (pRunner->nInstructionIndex < pRunner->pScript->nInstructionAmount && nRemainingStepAmount-- > 0) {
+    if (executeScriptInstruction(pGameState, pRunner, pGameAction)) {
+      pRunner->llActionAmount++;
+
+      if (pGameAction->cActionId != QUIT_ACTION_ID && !isGameActionValid(pGameState, pGameAction)) {
+        pRunner->llRejectedActionAmount++;
+      }
+
+      return;
+    }
+  }
+
+  memset(pGameAction, 0, sizeof(*pGameAction));
+  pGameAction->cActionId = QUIT_ACTION_ID;
+}
@@ -0,0 +1,267 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose shm_open(), mmap(), fstat(), ftruncate(), sched_yield(), and kill() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "shared-market.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "prompts.h"
+#include "trading.h"
+
+/**
+ * Checks whether the merchant that holds a port's lock was killed while holding it.
+ * @param nOwnerId The process ID of the lock's holder.
+ * @returns `1` if the process no longer exists or `0` if it still does.
+ */
+static int hasSharedPortMarketOwnerDied(int nOwnerId) { return kill(nOwnerId, 0) != 0 && errno == ESRCH; }
+
+/**
+ * Starts changing a port's market, waiting for any other merchant that is changing it to finish first. The lock of a
+ * merchant that was killed while holding it is taken over.
+ * @param[out] pPort The port's market.
+ * @returns The port's sequence from before the change, which must be handed to `unlockSharedPortMarket()`.
+ */
+static unsigned long long lockSharedPortMarket(SharedPortMarket *pPort) {
+  int nProcessId = (int)getpid();
+  int nOwnerId = 0;
+
+  // Only merchants that are trading in the same port at the same moment ever wait, and only for a few stores.
+  while (!__atomic_compare_exchange_n(&pPort->nOwnerId, &nOwnerId, nProcessId, 0, __ATOMIC_ACQUIRE,
+                                      __ATOMIC_RELAXED)) {
+    // Retry at once to take over from a dead holder, or else wait for the holder to finish.
+    if (nOwnerId != 0 && !hasSharedPortMarketOwnerDied(nOwnerId)) {
+      sched_yield();
+
+      nOwnerId = 0;
+    }
+  }
+
+  // A dead holder may have left the sequence odd, but every field it stored is still a whole value, so it is kept.
+  unsigned long long ullSequence = __atomic_load_n(&pPort->ullSequence, __ATOMIC_RELAXED);
+
+  ullSequence += ullSequence & 1;
+
+  // Mark the market as being changed before any of its fields change.
+  __atomic_store_n(&pPort->ullSequence, ullSequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  return ullSequence;
+}
+
+/**
+ * Finishes changing a port's market, which publishes the change to every reader and lets the next merchant change it.
+ * @param[out] pPort The port's market.
+ * @param ullSequence The port's sequence from before the change.
+ */
+static void unlockSharedPortMarket(SharedPortMarket *pPort, unsigned long long ullSequence) {
+  __atomic_store_n(&pPort->ullSequence, ullSequence + 2, __ATOMIC_RELEASE);
+  __atomic_store_n(&pPort->nOwnerId, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * Attaches to a shared market, creating it if no game has created it yet.
+ * @param strName The name of the market.
+ * @pre @p strName must be at most 64 characters long and must not contain `'/'`.
+ * @returns The market, or `NULL` if its shared memory could not be created or is not a shared market.
+ */
+SharedMarket *attachSharedMarket(const char *strName) {
+  static const char acEmptyMagic[sizeof(SHARED_MARKET_MAGIC) - 1] = {0};
+  char strSharedMemoryName[sizeof(SHARED_MARKET_NAME_PREFIX) + SHARED_MARKET_MAXIMUM_NAME_SIZE];
+
+  if (strlen(strName) > SHARED_MARKET_MAXIMUM_NAME_SIZE || strchr(strName, '/') != NULL) return NULL;
+
+  sprintf(strSharedMemoryName, "%s%s", SHARED_MARKET_NAME_PREFIX, strName);
+
+  int nFileDescriptor = shm_open(strSharedMemoryName, O_RDWR | O_CREAT, 0644);
+  struct stat sFileStatus;
+  void *pMemory = MAP_FAILED;
+
+  if (nFileDescriptor < 0) return NULL;
+
+  // New shared memory is zeroed when it is first extended, even if several games extend it at once.
+  if (fstat(nFileDescriptor, &sFileStatus) == 0 &&
+      (sFileStatus.st_size == sizeof(SharedMarket) ||
+       (sFileStatus.st_size == 0 && ftruncate(nFileDescriptor, sizeof(SharedMarket)) == 0))) {
+    pMemory = mmap(NULL, sizeof(SharedMarket), PROT_READ | PROT_WRITE, MAP_SHARED, nFileDescriptor, 0);
+  }
+
+  close(nFileDescriptor);
+
+  if (pMemory == MAP_FAILED) return NULL;
+
+  SharedMarket *pMarket = pMemory;
+
+  // Every game that finds the header empty writes the same one, so they never have to agree on who writes it.
+  if (memcmp(pMarket->acMagic, acEmptyMagic, sizeof(pMarket->acMagic)) == 0) {
+    pMarket->nVersion = SHARED_MARKET_VERSION;
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(pMarket->acMagic, SHARED_MARKET_MAGIC, sizeof(pMarket->acMagic));
+  }
+
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+  if (memcmp(pMarket->acMagic, SHARED_MARKET_MAGIC, sizeof(pMarket->acMagic)) != 0 ||
+      pMarket->nVersion != SHARED_MARKET_VERSION) {
+    munmap(pMemory, sizeof(SharedMarket));
+
+    return NULL;
+  }
+
+  return pMarket;
+}
+
+/**
+ * Opens a port's market with the prices that a merchant generated when they sailed into it, unless another merchant
+ * already opened it.
+ * @param[out] pMarket The market.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param[in,out] anMarketPrices The generated prices in cargo order, which are replaced by the port's prices.
+ * @returns `1` if the port's prices were read or `0` if the generated prices were kept because the port's market could
+ * not be read.
+ */
+int openSharedMarketPort(SharedMarket *pMarket, char cPortId, int anMarketPrices[CARGO_AMOUNT]) {
+  SharedPortMarket *pPort = &pMarket->asPorts[getPortIndex(cPortId)];
+  int anStockAmounts[CARGO_AMOUNT];
+
+  if (!__atomic_load_n(&pPort->bIsOpened, __ATOMIC_ACQUIRE)) {
+    unsigned long long ullSequence = lockSharedPortMarket(pPort);
+
+    // Another merchant may have opened the port while this one waited for it.
+    if (!pPort->bIsOpened) {
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+        __atomic_store_n(&pPort->anMarketPrices[nCargoIndex], anMarketPrices[nCargoIndex], __ATOMIC_RELAXED);
+        __atomic_store_n(&pPort->anStockAmounts[nCargoIndex], SHARED_MARKET_INITIAL_STOCK, __ATOMIC_RELAXED);
+      }
+
+      __atomic_store_n(&pPort->bIsOpened, 1, __ATOMIC_RELAXED);
+    }
+
+    unlockSharedPortMarket(pPort, ullSequence);
+  }
+
+  return readSharedMarketPort(pMarket, cPortId, anMarketPrices, anStockAmounts);
+}
+
+/**
+ * Reads a port's prices and stock without taking any lock. They are always from the same moment, even while another
+ * merchant is trading in the port.
+ * @param pMarket The market.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param[out] anMarketPrices The prices in cargo order, which are left as they were if the port could not be read.
+ * @param[out] anStockAmounts The amounts in stock in cargo order, which are left as they were if the port could not
+ * be read.
+ * @returns `1` if the port was read or `0` if it was being changed on every attempt.
+ */
+int readSharedMarketPort(const SharedMarket *pMarket, char cPortId, int anMarketPrices[CARGO_AMOUNT],
+                         int anStockAmounts[CARGO_AMOUNT]) {
+  const SharedPortMarket *pPort = &pMarket->asPorts[getPortIndex(cPortId)];
+  int anReadMarketPrices[CARGO_AMOUNT];
+  int anReadStockAmounts[CARGO_AMOUNT];
+
+  // Give up after a bounded number of attempts, since a merchant killed while trading leaves the port changing until
+  // another merchant trades in it.
+  for (int nAttemptIndex = 0; nAttemptIndex < SHARED_MARKET_MAXIMUM_READ_ATTEMPTS; nAttemptIndex++) {
+    unsigned long long ullSequence = __atomic_load_n(&pPort->ullSequence, __ATOMIC_ACQUIRE);
+
+    if (ullSequence & 1) {
+      sched_yield();
+
+      continue;
+    }
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      anReadMarketPrices[nCargoIndex] = __atomic_load_n(&pPort->anMarketPrices[nCargoIndex], __ATOMIC_RELAXED);
+      anReadStockAmounts[nCargoIndex] = __atomic_load_n(&pPort->anStockAmounts[nCargoIndex], __ATOMIC_RELAXED);
+    }
+
+    // Check the sequence again only after every field has been read, and retry if a change overlapped them.
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    if (__atomic_load_n(&pPort->ullSequence, __ATOMIC_RELAXED) == ullSequence) {
+      memcpy(anMarketPrices, anReadMarketPrices, sizeof(anReadMarketPrices));
+      memcpy(anStockAmounts, anReadStockAmounts, sizeof(anReadStockAmounts));
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Trades cargo with a port's stock as a single change, which buying moves the price up and selling moves down.
+ * @param[out] pMarket The market.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param cTransactionType The type of transaction made.
+ * @pre @p cTransactionType must have a character value of either `'B'` or `'S'`.
+ * @param cCargoId The ID of the cargo to trade.
+ * @pre @p cCargoId must have a character value of `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @param nCargoAmount The amount of cargo to trade.
+ * @param nCargoPrice The price that the merchant agreed to.
+ * @returns `1` if the trade was made or `0` if the price is no longer the agreed one or there is not enough stock.
+ */
+int tradeSharedMarketCargo(SharedMarket *pMarket, char cPortId, char cTransactionType, char cCargoId, int nCargoAmount,
+                           int nCargoPrice) {
+  SharedPortMarket *pPort = &pMarket->asPorts[getPortIndex(cPortId)];
+  int nCargoIndex = getCargoIndex(cCargoId);
+  int nMinimumPrice;
+  int nMaximumPrice;
+
+  getCargoPriceRange(cPortId, cCargoId, &nMinimumPrice, &nMaximumPrice);
+
+  unsigned long long ullSequence = lockSharedPortMarket(pPort);
+  // Only the lock's holder changes the market, so it can read the fields directly.
+  int nPrice = pPort->anMarketPrices[nCargoIndex];
+  int nStockAmount = pPort->anStockAmounts[nCargoIndex];
+  int bIsTraded = nPrice == nCargoPrice && (cTransactionType != BUY_ACTION_ID || nStockAmount >= nCargoAmount);
+
+  if (bIsTraded) {
+    int nStep = (int)((long long)(nMaximumPrice - nMinimumPrice) * nCargoAmount / SHARED_MARKET_DEPTH);
+
+    if (nStep < 1) nStep = 1;
+
+    if (cTransactionType == BUY_ACTION_ID) {
+      nStockAmount -= nCargoAmount;
+      nPrice += nStep;
+    } else {
+      nStockAmount += nCargoAmount;
+      nPrice -= nStep;
+    }
+
+    if (nPrice < nMinimumPrice) nPrice = nMinimumPrice;
+
+    if (nPrice > nMaximumPrice) nPrice = nMaximumPrice;
+
+    __atomic_store_n(&pPort->anMarketPrices[nCargoIndex], nPrice, __ATOMIC_RELAXED);
+    __atomic_store_n(&pPort->anStockAmounts[nCargoIndex], nStockAmount, __ATOMIC_RELAXED);
+  }
+
+  unlockSharedPortMarket(pPort, ullSequence);
+
+  return bIsTraded;
+}
+
+/**
+ * Detaches from a shared market, which stays in memory for the other games.
+ * @param[out] pMarket The market.
+ */
+void detachSharedMarket(SharedMarket *pMarket) { munmap(pMarket, sizeof(SharedMarket)); }
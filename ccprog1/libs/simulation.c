@@ -0,0 +1,376 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose mmap() and the file descriptor functions from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "simulation.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "engine.h"
+#include "events.h"
+#include "ledger.h"
+#include "prompts.h"
+#include "sketches.h"
+#include "trading.h"
+
+/**
+ * Gets the index of a port's market price of a cargo during a turn within a game's prices.
+ * @param nPlayerTurns The number of turns the player has exhausted.
+ * @param nPortIndex The index of the port.
+ * @param nCargoIndex The index of the cargo.
+ * @returns An integer value within the range of `0` and `PRICE_TAPE_GAME_PRICE_AMOUNT - 1`.
+ */
+static int getPriceTapeIndex(int nPlayerTurns, int nPortIndex, int nCargoIndex) {
+  return (nPlayerTurns * PORT_AMOUNT + nPortIndex) * CARGO_AMOUNT + nCargoIndex;
+}
+
+/** The market prices of a simulated game without a price tape, which are generated one turn at a time. */
+typedef struct SeededPrices {
+  unsigned long long ullRandomState;
+  int nGeneratedTurnAmount;
+  /** The prices of the last generated turn, ordered by port, then cargo. */
+  int aanTurnPrices[PORT_AMOUNT][CARGO_AMOUNT];
+} SeededPrices;
+
+/**
+ * Generates the market prices of every port for the next turn of a game.
+ * @param[out] pullRandomState The game's random state.
+ * @param[out] aanTurnPrices The prices, ordered by port, then cargo.
+ */
+static void generateSeededTurnPrices(unsigned long long *pullRandomState,
+                                     int aanTurnPrices[PORT_AMOUNT][CARGO_AMOUNT]) {
+  GameState sGameState;
+
+  initializeGameState(&sGameState, 0);
+
+  for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+    sGameState.cPortId = getPortId(nPortIndex);
+
+    generateSeededGameMarketPrices(&sGameState, pullRandomState);
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      aanTurnPrices[nPortIndex][nCargoIndex] = sGameState.anMarketPrices[nCargoIndex];
+    }
+  }
+}
+
+/**
+ * Generates the market prices of every port for every turn of a game from its seed, which are the same prices that a
+ * simulated game without a price tape generates.
+ * @param ullSeed The game's seed.
+ * @param[out] aunPrices The prices, ordered by turn, then port, then cargo.
+ */
+void generatePriceTapeGame(unsigned long long ullSeed, unsigned short aunPrices[PRICE_TAPE_GAME_PRICE_AMOUNT]) {
+  unsigned long long ullRandomState = seedRandomState(ullSeed);
+  int aanTurnPrices[PORT_AMOUNT][CARGO_AMOUNT];
+
+  for (int nPlayerTurns = 0; nPlayerTurns < MAXIMUM_PLAYER_TURNS; nPlayerTurns++) {
+    generateSeededTurnPrices(&ullRandomState, aanTurnPrices);
+
+    for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+      for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+        aunPrices[getPriceTapeIndex(nPlayerTurns, nPortIndex, nCargoIndex)] =
+          (unsigned short)aanTurnPrices[nPortIndex][nCargoIndex];
+      }
+    }
+  }
+}
+
+/**
+ * Reads the market prices of a port during a turn of a game without a price tape, generating the turns up to it.
+ * Every port's prices are generated for every turn, so the prices do not depend on which ports the bot visits.
+ * @param[out] pSeededPrices The game's generated prices.
+ * @param[out] pGameState The state of the game, whose port, turns, and market prices are used.
+ * @pre The game's turns must not have gone back since its prices were last read.
+ */
+static void readSeededMarketPrices(SeededPrices *pSeededPrices, GameState *pGameState) {
+  while (pSeededPrices->nGeneratedTurnAmount <= pGameState->nPlayerTurns) {
+    generateSeededTurnPrices(&pSeededPrices->ullRandomState, pSeededPrices->aanTurnPrices);
+
+    pSeededPrices->nGeneratedTurnAmount++;
+  }
+
+  int nPortIndex = getPortIndex(pGameState->cPortId);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    pGameState->anMarketPrices[nCargoIndex] = pSeededPrices->aanTurnPrices[nPortIndex][nCargoIndex];
+  }
+}
+
+/**
+ * Writes a price tape file with the prices of consecutive seeds.
+ * @param strFilePath The path of the file to write.
+ * @param nGameAmount The number of games, one for every seed.
+ * @pre @p nGameAmount must have a positive integer value.
+ * @param ullFirstSeed The seed of the first game.
+ * @returns `1` if the file was written or `0` if it could not be.
+ */
+int writePriceTape(const char *strFilePath, int nGameAmount, unsigned long long ullFirstSeed) {
+  FILE *pFile = fopen(strFilePath, "wb");
+
+  if (pFile == NULL) return 0;
+
+  PriceTapeHeader sHeader;
+
+  memcpy(sHeader.acMagic, PRICE_TAPE_MAGIC, sizeof(sHeader.acMagic));
+  sHeader.unVersion = PRICE_TAPE_VERSION;
+  sHeader.unGameAmount = nGameAmount;
+  sHeader.unPriceAmount = PRICE_TAPE_GAME_PRICE_AMOUNT;
+  sHeader.ullFirstSeed = ullFirstSeed;
+
+  int bIsWritten = fwrite(&sHeader, sizeof(sHeader), 1, pFile) == 1;
+
+  for (int nGameIndex = 0; bIsWritten && nGameIndex < nGameAmount; nGameIndex++) {
+    unsigned short aunPrices[PRICE_TAPE_GAME_PRICE_AMOUNT];
+
+    generatePriceTapeGame(ullFirstSeed + nGameIndex, aunPrices);
+
+    bIsWritten = fwrite(aunPrices, sizeof(aunPrices), 1, pFile) == 1;
+  }
+
+  return fclose(pFile) == 0 && bIsWritten;
+}
+
+/**
+ * Opens a price tape file by mapping it into memory.
+ * @param strFilePath The path of the file to open.
+ * @param[out] pPriceTape The opened price tape.
+ * @returns `1` if the file was opened or `0` if it does not exist or is not a valid price tape.
+ */
+int openPriceTape(const char *strFilePath, PriceTape *pPriceTape) {
+  int nFileDescriptor = open(strFilePath, O_RDONLY);
+
+  if (nFileDescriptor < 0) return 0;
+
+  struct stat sFileStatus;
+
+  if (fstat(nFileDescriptor, &sFileStatus) != 0 || (size_t)sFileStatus.st_size < sizeof(PriceTapeHeader)) {
+    close(nFileDescriptor);
+
+    return 0;
+  }
+
+  size_t ulMappingSize = sFileStatus.st_size;
+  void *pMapping = mmap(NULL, ulMappingSize, PROT_READ, MAP_SHARED, nFileDescriptor, 0);
+
+  // The mapping stays valid after its file descriptor is closed.
+  close(nFileDescriptor);
+
+  if (pMapping == MAP_FAILED) return 0;
+
+  const PriceTapeHeader *pHeader = pMapping;
+  size_t ulGameSize = PRICE_TAPE_GAME_PRICE_AMOUNT * sizeof(unsigned short);
+
+  if (memcmp(pHeader->acMagic, PRICE_TAPE_MAGIC, sizeof(pHeader->acMagic)) != 0 ||
+      pHeader->unVersion != PRICE_TAPE_VERSION || pHeader->unPriceAmount != PRICE_TAPE_GAME_PRICE_AMOUNT ||
+      pHeader->unGameAmount == 0 || ulMappingSize != sizeof(PriceTapeHeader) + pHeader->unGameAmount * ulGameSize) {
+    munmap(pMapping, ulMappingSize);
+
+    return 0;
+  }
+
+  pPriceTape->nGameAmount = pHeader->unGameAmount;
+  pPriceTape->ullFirstSeed = pHeader->ullFirstSeed;
+  pPriceTape->aunPrices = (const unsigned short *)(pHeader + 1);
+  pPriceTape->pMapping = pMapping;
+  pPriceTape->ulMappingSize = ulMappingSize;
+
+  return 1;
+}
+
+/**
+ * Closes a price tape by unmapping its file from memory.
+ * @param[out] pPriceTape The price tape.
+ */
+void closePriceTape(PriceTape *pPriceTape) {
+  if (pPriceTape->pMapping != NULL) munmap(pPriceTape->pMapping, pPriceTape->ulMappingSize);
+
+  pPriceTape->nGameAmount = 0;
+  pPriceTape->aunPrices = NULL;
+  pPriceTape->pMapping = NULL;
+  pPriceTape->ulMappingSize = 0;
+}
+
+/**
+ * Reads the market prices of a port during a turn of a game from a price tape.
+ * @param pPriceTape The price tape.
+ * @param nGameIndex The index of the game in the price tape.
+ * @pre @p nGameIndex must have an integer value within the range of `0` and the number of games minus `1`.
+ * @param[out] pGameState The state of the game, whose port, turns, and market prices are used.
+ */
+void readPriceTapeMarketPrices(const PriceTape *pPriceTape, int nGameIndex, GameState *pGameState) {
+  const unsigned short *aunPrices = pPriceTape->aunPrices + (size_t)nGameIndex * PRICE_TAPE_GAME_PRICE_AMOUNT;
+  int nPortIndex = getPortIndex(pGameState->cPortId);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    pGameState->anMarketPrices[nCargoIndex] =
+      aunPrices[getPriceTapeIndex(pGameState->nPlayerTurns, nPortIndex, nCargoIndex)];
+  }
+}
+
+/**
+ * Reads the market prices of the port that a simulated game is in during its current turn.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @param ullSeed The game's seed, which is the index of the game in the price tape if one is given.
+ * @param[out] pSeededPrices The game's generated prices, which are only used without a price tape.
+ * @param[out] pGameState The state of the game, whose port, turns, and market prices are used.
+ */
+static void readSimulatedMarketPrices(const PriceTape *pPriceTape, unsigned long long ullSeed,
+                                      SeededPrices *pSeededPrices, GameState *pGameState) {
+  if (pPriceTape == NULL) {
+    readSeededMarketPrices(pSeededPrices, pGameState);
+  } else {
+    readPriceTapeMarketPrices(pPriceTape, (int)ullSeed, pGameState);
+  }
+}
+
+/**
+ * Records the market prices of the port that a simulated game is in.
+ * @param[out] pLedger The ledger.
+ * @param pGameState The state of the game.
+ */
+static void recordSimulatedMarket(Ledger *pLedger, const GameState *pGameState) {
+  GameEvent sGameEvent = {0};
+
+  sGameEvent.cEventId = MARKET_EVENT_ID;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    sGameEvent.anMarketPrices[nCargoIndex] = pGameState->anMarketPrices[nCargoIndex];
+  }
+
+  pushLedgerEvent(pLedger, &sGameEvent);
+}
+
+/**
+ * Plays a whole game with a bot without printing anything to the console. The market prices are read from a price tape
+ * if one is given, or else generated from the game's seed.
+ * @param fnStrategy The bot's strategy.
+ * @param pContext The bot's own parameters and memory.
+ * @param nPlayerInitialBalance The number of gold coins the player starts with.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @param ullSeed The game's seed, which is the index of the game in the price tape if one is given.
+ * @param[out] pLedger The ledger to record the game's events in, or `NULL` to not record them.
+ * @param[out] pGameState The state of the game when it ended.
+ * @returns The number of actions that the bot did, including the invalid ones that were ignored.
+ * @post The game is ended by quitting if the bot does `SIMULATED_GAME_MAXIMUM_ACTION_AMOUNT` actions.
+ */
+int playSimulatedGame(GameStrategy fnStrategy, void *pContext, int nPlayerInitialBalance, const PriceTape *pPriceTape,
+                      unsigned long long ullSeed, Ledger *pLedger, GameState *pGameState) {
+  // Without a price tape, only the turns that the game reaches are generated.
+  SeededPrices sSeededPrices = {seedRandomState(ullSeed), 0, {{0}}};
+
+  initializeGameState(pGameState, nPlayerInitialBalance);
+  readSimulatedMarketPrices(pPriceTape, ullSeed, &sSeededPrices, pGameState);
+
+  GameEvent sGameEvent = {0};
+
+  if (pLedger != NULL) {
+    sGameEvent.cEventId = GAME_START_EVENT_ID;
+    sGameEvent.ullSeed = ullSeed;
+    sGameEvent.cPriceSourceId = pPriceTape == NULL ? SEEDED_PRICE_SOURCE_ID : TAPE_PRICE_SOURCE_ID;
+    sGameEvent.nPlayerBalance = nPlayerInitialBalance;
+
+    pushLedgerEvent(pLedger, &sGameEvent);
+    recordSimulatedMarket(pLedger, pGameState);
+  }
+
+  int nActionAmount = 0;
+
+  while (!isGameOver(pGameState)) {
+    if (nActionAmount >= SIMULATED_GAME_MAXIMUM_ACTION_AMOUNT) {
+      pGameState->bPlayerHasQuit = 1;
+
+      break;
+    }
+
+    GameAction sGameAction;
+
+    fnStrategy(pGameState, pContext, &sGameAction);
+    nActionAmount++;
+
+    if (pLedger != NULL && sGameAction.cActionId != QUIT_ACTION_ID &&
+        isGameActionValid(pGameState, &sGameAction)) {
+      setGameActionEvent(pGameState, &sGameAction, &sGameEvent);
+      pushLedgerEvent(pLedger, &sGameEvent);
+    }
+
+    if (applyGameAction(pGameState, &sGameAction) && sGameAction.cActionId == NAVIGATE_ACTION_ID &&
+        !isGameOver(pGameState)) {
+      readSimulatedMarketPrices(pPriceTape, ullSeed, &sSeededPrices, pGameState);
+
+      if (pLedger != NULL) recordSimulatedMarket(pLedger, pGameState);
+    }
+  }
+
+  if (pLedger != NULL) {
+    sGameEvent.cEventId = GAME_END_EVENT_ID;
+    sGameEvent.nPlayerBalance = pGameState->nPlayerBalance;
+    sGameEvent.unStateHash = rollGameStateHash(sGameEvent.unStateHash, pGameState);
+
+    pushLedgerEvent(pLedger, &sGameEvent);
+  }
+
+  return nActionAmount;
+}
+
+/**
+ * Sets up an empty simulation summary.
+ * @param[out] pSummary The summary.
+ * @param nPlayerProfitTarget The player's target profit percentage, which is used the same way as in the game.
+ * @param ullSeed The seed of the random choices made by the summary's quantile sketch.
+ */
+void initializeSimulationSummary(SimulationSummary *pSummary, int nPlayerProfitTarget, unsigned long long ullSeed) {
+  pSummary->nPlayerProfitTarget = nPlayerProfitTarget;
+  pSummary->llGameAmount = 0;
+  pSummary->llTargetReachedGameAmount = 0;
+  pSummary->dProfitSum = 0;
+
+  initializeQuantileSketch(&pSummary->sProfitSketch, ullSeed);
+  initializeHistogram(&pSummary->sProfitHistogram);
+}
+
+/**
+ * Adds the profit of a finished game to a simulation summary.
+ * @param[out] pSummary The summary.
+ * @param pGameState The state of the game when it ended.
+ */
+void addSimulationSummaryGame(SimulationSummary *pSummary, const GameState *pGameState) {
+  long long llProfit = (long long)pGameState->nPlayerBalance - pGameState->nPlayerInitialBalance;
+
+  // Scale the profit by the target the same way that the game does before comparing them on its end screen.
+  if (pSummary->nPlayerProfitTarget * llProfit / 100 >= pSummary->nPlayerProfitTarget) {
+    pSummary->llTargetReachedGameAmount++;
+  }
+
+  pSummary->llGameAmount++;
+  pSummary->dProfitSum += llProfit;
+
+  addQuantileSketchValue(&pSummary->sProfitSketch, llProfit);
+  addHistogramValue(&pSummary->sProfitHistogram, llProfit);
+}
+
+/**
+ * Merges a simulation summary into another, which is used to combine the summaries of different threads.
+ * @param[out] pSummary The summary to merge into.
+ * @param pOtherSummary The summary to merge from, which is left unchanged.
+ * @pre Both summaries must have the same target profit percentage.
+ */
+void mergeSimulationSummaries(SimulationSummary *pSummary, const SimulationSummary *pOtherSummary) {
+  pSummary->llGameAmount += pOtherSummary->llGameAmount;
+  pSummary->llTargetReachedGameAmount += pOtherSummary->llTargetReachedGameAmount;
+  pSummary->dProfitSum += pOtherSummary->dProfitSum;
+
+  mergeQuantileSketches(&pSummary->sProfitSketch, &pOtherSummary->sProfitSketch);
+  mergeHistograms(&pSummary->sProfitHistogram, &pOtherSummary->sProfitHistogram);
+}
@@ -0,0 +1,272 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "sketches.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "engine.h"
+
+// The index of the bin of the values between `-1` and `1`.
+#define HISTOGRAM_MIDDLE_BIN_INDEX (HISTOGRAM_OCTAVE_AMOUNT * HISTOGRAM_OCTAVE_BIN_AMOUNT)
+
+/** A value of a quantile sketch with the number of added values that it stands for. */
+typedef struct WeightedValue {
+  double dValue;
+  long long llWeight;
+} WeightedValue;
+
+/**
+ * Compares two doubles for sorting them in ascending order.
+ * @param pFirst The first double.
+ * @param pSecond The second double.
+ * @returns A negative integer if the first is smaller, a positive integer if it is larger, or `0` if they are equal.
+ */
+static int compareDoubles(const void *pFirst, const void *pSecond) {
+  double dFirst = *(const double *)pFirst;
+  double dSecond = *(const double *)pSecond;
+
+  return (dFirst > dSecond) - (dFirst < dSecond);
+}
+
+/**
+ * Compares two weighted values for sorting them in ascending order of their values.
+ * @param pFirst The first weighted value.
+ * @param pSecond The second weighted value.
+ * @returns A negative integer if the first is smaller, a positive integer if it is larger, or `0` if they are equal.
+ */
+static int compareWeightedValues(const void *pFirst, const void *pSecond) {
+  return compareDoubles(&((const WeightedValue *)pFirst)->dValue, &((const WeightedValue *)pSecond)->dValue);
+}
+
+static void addQuantileSketchLevelValue(QuantileSketch *pSketch, int nLevel, double dValue);
+
+/**
+ * Compacts a full level of a quantile sketch by promoting every other one of its sorted values to the next level.
+ * @param[out] pSketch The sketch.
+ * @param nLevel The level.
+ */
+static void compactQuantileSketchLevel(QuantileSketch *pSketch, int nLevel) {
+  double *adValues = pSketch->aadLevels[nLevel];
+  int nLevelSize = pSketch->anLevelSizes[nLevel];
+  int nOffset = (int)(generateNextRandomNumber(&pSketch->ullRandomState) >> 63);
+
+  qsort(adValues, nLevelSize, sizeof(double), compareDoubles);
+
+  // The highest level cannot promote its values, which would take more values than can ever be added to reach.
+  if (nLevel == QUANTILE_SKETCH_LEVEL_AMOUNT - 1) {
+    int nKeptAmount = 0;
+
+    for (int nValueIndex = nOffset; nValueIndex < nLevelSize; nValueIndex += 2) {
+      adValues[nKeptAmount++] = adValues[nValueIndex];
+    }
+
+    pSketch->anLevelSizes[nLevel] = nKeptAmount;
+
+    return;
+  }
+
+  // An odd value out stays in the level so that the total weight is kept.
+  int nPromotedSize = nLevelSize - nLevelSize % 2;
+
+  pSketch->anLevelSizes[nLevel] = 0;
+
+  for (int nValueIndex = nOffset; nValueIndex < nPromotedSize; nValueIndex += 2) {
+    addQuantileSketchLevelValue(pSketch, nLevel + 1, adValues[nValueIndex]);
+  }
+
+  if (nLevelSize % 2 == 1) adValues[pSketch->anLevelSizes[nLevel]++] = adValues[nLevelSize - 1];
+}
+
+/**
+ * Adds a value to a level of a quantile sketch, compacting the level first if it is full.
+ * @param[out] pSketch The sketch.
+ * @param nLevel The level, whose values each stand for `2` to the power of the level added values.
+ * @param dValue The value.
+ */
+static void addQuantileSketchLevelValue(QuantileSketch *pSketch, int nLevel, double dValue) {
+  if (pSketch->anLevelSizes[nLevel] == QUANTILE_SKETCH_LEVEL_CAPACITY) compactQuantileSketchLevel(pSketch, nLevel);
+
+  pSketch->aadLevels[nLevel][pSketch->anLevelSizes[nLevel]++] = dValue;
+}
+
+/**
+ * Sets up an empty quantile sketch.
+ * @param[out] pSketch The sketch.
+ * @param ullSeed The seed of the random choices made when levels are compacted.
+ */
+void initializeQuantileSketch(QuantileSketch *pSketch, unsigned long long ullSeed) {
+  for (int nLevel = 0; nLevel < QUANTILE_SKETCH_LEVEL_AMOUNT; nLevel++) pSketch->anLevelSizes[nLevel] = 0;
+
+  pSketch->llValueAmount = 0;
+  pSketch->dMinimumValue = 0;
+  pSketch->dMaximumValue = 0;
+  pSketch->ullRandomState = seedRandomState(ullSeed);
+}
+
+/**
+ * Adds a value to a quantile sketch.
+ * @param[out] pSketch The sketch.
+ * @param dValue The value.
+ */
+void addQuantileSketchValue(QuantileSketch *pSketch, double dValue) {
+  if (pSketch->llValueAmount == 0 || dValue < pSketch->dMinimumValue) pSketch->dMinimumValue = dValue;
+  if (pSketch->llValueAmount == 0 || dValue > pSketch->dMaximumValue) pSketch->dMaximumValue = dValue;
+
+  pSketch->llValueAmount++;
+
+  addQuantileSketchLevelValue(pSketch, 0, dValue);
+}
+
+/**
+ * Merges the values of a quantile sketch into another, which is used to combine the sketches of different threads.
+ * @param[out] pSketch The sketch to merge into.
+ * @param pOtherSketch The sketch to merge from, which is left unchanged.
+ */
+void mergeQuantileSketches(QuantileSketch *pSketch, const QuantileSketch *pOtherSketch) {
+  if (pOtherSketch->llValueAmount == 0) return;
+
+  if (pSketch->llValueAmount == 0 || pOtherSketch->dMinimumValue < pSketch->dMinimumValue) {
+    pSketch->dMinimumValue = pOtherSketch->dMinimumValue;
+  }
+
+  if (pSketch->llValueAmount == 0 || pOtherSketch->dMaximumValue > pSketch->dMaximumValue) {
+    pSketch->dMaximumValue = pOtherSketch->dMaximumValue;
+  }
+
+  pSketch->llValueAmount += pOtherSketch->llValueAmount;
+
+  for (int nLevel = 0; nLevel < QUANTILE_SKETCH_LEVEL_AMOUNT; nLevel++) {
+    for (int nValueIndex = 0; nValueIndex < pOtherSketch->anLevelSizes[nLevel]; nValueIndex++) {
+      addQuantileSketchLevelValue(pSketch, nLevel, pOtherSketch->aadLevels[nLevel][nValueIndex]);
+    }
+  }
+}
+
+/**
+ * Estimates the value at a quantile of every value added to a quantile sketch.
+ * @param pSketch The sketch.
+ * @param dQuantile The quantile, where `0.5` is the median.
+ * @pre @p dQuantile must have a value within the range of `0` and `1`.
+ * @returns The estimated value, or `0` if the sketch is empty.
+ */
+double getQuantileSketchValue(const QuantileSketch *pSketch, double dQuantile) {
+  if (pSketch->llValueAmount == 0) return 0;
+  if (dQuantile <= 0) return pSketch->dMinimumValue;
+  if (dQuantile >= 1) return pSketch->dMaximumValue;
+
+  WeightedValue *asWeightedValues =
+    malloc(sizeof(WeightedValue) * QUANTILE_SKETCH_LEVEL_AMOUNT * QUANTILE_SKETCH_LEVEL_CAPACITY);
+
+  if (asWeightedValues == NULL) return 0;
+
+  int nWeightedValueAmount = 0;
+  long long llTotalWeight = 0;
+
+  for (int nLevel = 0; nLevel < QUANTILE_SKETCH_LEVEL_AMOUNT; nLevel++) {
+    for (int nValueIndex = 0; nValueIndex < pSketch->anLevelSizes[nLevel]; nValueIndex++) {
+      asWeightedValues[nWeightedValueAmount].dValue = pSketch->aadLevels[nLevel][nValueIndex];
+      asWeightedValues[nWeightedValueAmount].llWeight = 1LL << nLevel;
+      llTotalWeight += asWeightedValues[nWeightedValueAmount].llWeight;
+      nWeightedValueAmount++;
+    }
+  }
+
+  qsort(asWeightedValues, nWeightedValueAmount, sizeof(WeightedValue), compareWeightedValues);
+
+  double dRank = dQuantile * llTotalWeight;
+  double dValue = pSketch->dMaximumValue;
+  long long llCumulativeWeight = 0;
+
+  for (int nValueIndex = 0; nValueIndex < nWeightedValueAmount; nValueIndex++) {
+    llCumulativeWeight += asWeightedValues[nValueIndex].llWeight;
+
+    if (llCumulativeWeight >= dRank) {
+      dValue = asWeightedValues[nValueIndex].dValue;
+
+      break;
+    }
+  }
+
+  free(asWeightedValues);
+
+  return dValue;
+}
+
+/**
+ * Sets up an empty histogram.
+ * @param[out] pHistogram The histogram.
+ */
+void initializeHistogram(Histogram *pHistogram) {
+  for (int nBinIndex = 0; nBinIndex < HISTOGRAM_BIN_AMOUNT; nBinIndex++) pHistogram->allBinCounts[nBinIndex] = 0;
+
+  pHistogram->llValueAmount = 0;
+}
+
+/**
+ * Gets the index of the bin that a value falls into.
+ * @param dValue The value.
+ * @returns An integer value within the range of `0` and `HISTOGRAM_BIN_AMOUNT - 1`, which increases with the value.
+ */
+int getHistogramBinIndex(double dValue) {
+  double dMagnitude = fabs(dValue);
+
+  if (!(dMagnitude >= 1)) return HISTOGRAM_MIDDLE_BIN_INDEX;
+
+  int nExponent;
+  // The magnitude is split into a mantissa within the range of `0.5` and `1` and an exponent.
+  double dMantissa = frexp(dMagnitude, &nExponent);
+  int nDistance =
+    1 + (nExponent - 1) * HISTOGRAM_OCTAVE_BIN_AMOUNT + (int)((2 * dMantissa - 1) * HISTOGRAM_OCTAVE_BIN_AMOUNT);
+
+  if (nDistance > HISTOGRAM_MIDDLE_BIN_INDEX) nDistance = HISTOGRAM_MIDDLE_BIN_INDEX;
+
+  return dValue > 0 ? HISTOGRAM_MIDDLE_BIN_INDEX + nDistance : HISTOGRAM_MIDDLE_BIN_INDEX - nDistance;
+}
+
+/**
+ * Gets the bound of a bin that is nearest to zero.
+ * @param nBinIndex The index of the bin.
+ * @pre @p nBinIndex must have an integer value within the range of `0` and `HISTOGRAM_BIN_AMOUNT - 1`.
+ * @returns The bound, which has the same sign as the bin's values, or `0` for the bin of the values between `-1` and
+ * `1`.
+ */
+double getHistogramBinBound(int nBinIndex) {
+  int nDistance = abs(nBinIndex - HISTOGRAM_MIDDLE_BIN_INDEX);
+
+  if (nDistance == 0) return 0;
+
+  int nOctave = (nDistance - 1) / HISTOGRAM_OCTAVE_BIN_AMOUNT;
+  int nOctaveBinIndex = (nDistance - 1) % HISTOGRAM_OCTAVE_BIN_AMOUNT;
+  double dBound = ldexp(1 + (double)nOctaveBinIndex / HISTOGRAM_OCTAVE_BIN_AMOUNT, nOctave);
+
+  return nBinIndex > HISTOGRAM_MIDDLE_BIN_INDEX ? dBound : -dBound;
+}
+
+/**
+ * Adds a value to a histogram.
+ * @param[out] pHistogram The histogram.
+ * @param dValue The value.
+ */
+void addHistogramValue(Histogram *pHistogram, double dValue) {
+  pHistogram->allBinCounts[getHistogramBinIndex(dValue)]++;
+  pHistogram->llValueAmount++;
+}
+
+/**
+ * Merges the counts of a histogram into another, which is used to combine the histograms of different threads.
+ * @param[out] pHistogram The histogram to merge into.
+ * @param pOtherHistogram The histogram to merge from, which is left unchanged.
+ */
+void mergeHistograms(Histogram *pHistogram, const Histogram *pOtherHistogram) {
+  for (int nBinIndex = 0; nBinIndex < HISTOGRAM_BIN_AMOUNT; nBinIndex++) {
+    pHistogram->allBinCounts[nBinIndex] += pOtherHistogram->allBinCounts[nBinIndex];
+  }
+
+  pHistogram->llValueAmount += pOtherHistogram->llValueAmount;
+}
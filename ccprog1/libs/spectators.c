@@ -0,0 +1,255 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose shm_open(), mmap(), ftruncate(), and kill() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "spectators.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "console.h"
+#include "rendering.h"
+
+/**
+ * Gets the shared memory name of a broadcast.
+ * @param strName The name of the broadcast.
+ * @param[out] strSharedMemoryName The shared memory name.
+ * @returns `1` if the name is valid or `0` if it is too long or contains `'/'`.
+ */
+static int getSpectatorSharedMemoryName(const char *strName,
+                                        char strSharedMemoryName[sizeof(SPECTATOR_NAME_PREFIX) +
+                                                                 SPECTATOR_MAXIMUM_NAME_SIZE]) {
+  if (strlen(strName) > SPECTATOR_MAXIMUM_NAME_SIZE || strchr(strName, '/') != NULL) return 0;
+
+  sprintf(strSharedMemoryName, "%s%s", SPECTATOR_NAME_PREFIX, strName);
+
+  return 1;
+}
+
+/**
+ * Checks whether a broadcast's game has ended, either normally or because its process was killed.
+ * @param pRing The broadcast's ring.
+ * @returns `1` if the game has ended or `0` if it is still being played.
+ */
+static int isSpectatorGameOver(const SpectatorRing *pRing) {
+  return __atomic_load_n(&pRing->bIsOver, __ATOMIC_ACQUIRE) || (kill(pRing->nPlayerId, 0) != 0 && errno == ESRCH);
+}
+
+/**
+ * Attaches to a broadcast as a spectator, without the player's process ever knowing about it. The view starts at the
+ * oldest frame that is still in the ring, so that the current screen can be drawn right away.
+ * @param[out] pView The view.
+ * @param strName The name of the broadcast.
+ * @returns `1` if the broadcast was found or `0` if it was not.
+ */
+int attachSpectatorView(SpectatorView *pView, const char *strName) {
+  char strSharedMemoryName[sizeof(SPECTATOR_NAME_PREFIX) + SPECTATOR_MAXIMUM_NAME_SIZE];
+
+  if (!getSpectatorSharedMemoryName(strName, strSharedMemoryName)) return 0;
+
+  int nFileDescriptor = shm_open(strSharedMemoryName, O_RDONLY, 0);
+
+  if (nFileDescriptor < 0) return 0;
+
+  void *pMemory = mmap(NULL, sizeof(SpectatorRing), PROT_READ, MAP_SHARED, nFileDescriptor, 0);
+
+  close(nFileDescriptor);
+
+  if (pMemory == MAP_FAILED) return 0;
+
+  const SpectatorRing *pRing = pMemory;
+
+  if (memcmp(pRing->acMagic, SPECTATOR_RING_MAGIC, sizeof(pRing->acMagic)) != 0 ||
+      pRing->nVersion != SPECTATOR_RING_VERSION) {
+    munmap(pMemory, sizeof(SpectatorRing));
+
+    return 0;
+  }
+
+  unsigned long long ullFrameAmount = __atomic_load_n(&pRing->ullFrameAmount, __ATOMIC_ACQUIRE);
+
+  pView->pRing = pRing;
+  pView->ullNextFrame = ullFrameAmount > SPECTATOR_FRAME_AMOUNT ? ullFrameAmount - SPECTATOR_FRAME_AMOUNT : 0;
+  pView->llSkippedAmount = 0;
+
+  return 1;
+}
+
+/**
+ * Reads the next frame of a broadcast, skipping ahead to the oldest frame still in the ring if the view fell behind.
+ * @param[out] pView The view.
+ * @param[out] acText The frame's text, which is not null-terminated.
+ * @param[out] nTextSize The number of characters in the frame's text.
+ * @returns `1` if a frame was read, `0` if there is no new frame yet, or `-1` if the game has ended, or its process was
+ * killed, and every frame has been read.
+ */
+int readSpectatorFrame(SpectatorView *pView, char acText[SPECTATOR_FRAME_SIZE], int *nTextSize) {
+  const SpectatorRing *pRing = pView->pRing;
+
+  for (;;) {
+    // Check whether the game has ended before the frame amount, since the last frame is written before it ends.
+    int bIsOver = isSpectatorGameOver(pRing);
+    unsigned long long ullFrameAmount = __atomic_load_n(&pRing->ullFrameAmount, __ATOMIC_ACQUIRE);
+
+    if (pView->ullNextFrame == ullFrameAmount) return bIsOver ? -1 : 0;
+
+    if (ullFrameAmount - pView->ullNextFrame > SPECTATOR_FRAME_AMOUNT) {
+      pView->llSkippedAmount += ullFrameAmount - SPECTATOR_FRAME_AMOUNT - pView->ullNextFrame;
+      pView->ullNextFrame = ullFrameAmount - SPECTATOR_FRAME_AMOUNT;
+    }
+
+    const SpectatorFrame *pFrame = &pRing->asFrames[pView->ullNextFrame % SPECTATOR_FRAME_AMOUNT];
+    unsigned long long ullWrittenSequence = 2 * pView->ullNextFrame + 2;
+
+    if (__atomic_load_n(&pFrame->ullSequence, __ATOMIC_ACQUIRE) == ullWrittenSequence) {
+      int nFrameTextSize = __atomic_load_n(&pFrame->nTextSize, __ATOMIC_RELAXED);
+
+      if (nFrameTextSize > SPECTATOR_FRAME_SIZE) nFrameTextSize = SPECTATOR_FRAME_SIZE;
+
+      memcpy(acText, pFrame->acText, nFrameTextSize);
+
+      // Keep the copy only if the frame was not rewritten while it was being copied.
+      __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+      if (__atomic_load_n(&pFrame->ullSequence, __ATOMIC_RELAXED) == ullWrittenSequence) {
+        *nTextSize = nFrameTextSize;
+        pView->ullNextFrame++;
+
+        return 1;
+      }
+    }
+
+    // The frame was rewritten by a newer one, so skip ahead and try again.
+    pView->llSkippedAmount++;
+    pView->ullNextFrame++;
+  }
+}
+
+/**
+ * Detaches from a broadcast.
+ * @param[out] pView The view.
+ */
+void detachSpectatorView(SpectatorView *pView) {
+  munmap((void *)pView->pRing, sizeof(SpectatorRing));
+
+  pView->pRing = NULL;
+}
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+// The broadcast's shared memory and name, if one has been started.
+static SpectatorRing *pBroadcastRing = NULL;
+static char strBroadcastSharedMemoryName[sizeof(SPECTATOR_NAME_PREFIX) + SPECTATOR_MAXIMUM_NAME_SIZE];
+
+/**
+ * Writes a chunk of the console's output into the broadcast's ring as its next frame.
+ * @param pText The text, which is not null-terminated.
+ * @param nTextSize The number of characters in the text.
+ */
+static void writeSpectatorFrame(const char *pText, int nTextSize) {
+  unsigned long long ullFrame = pBroadcastRing->ullFrameAmount;
+  SpectatorFrame *pFrame = &pBroadcastRing->asFrames[ullFrame % SPECTATOR_FRAME_AMOUNT];
+
+  if (nTextSize > SPECTATOR_FRAME_SIZE) nTextSize = SPECTATOR_FRAME_SIZE;
+
+  // Mark the frame as being rewritten before any of its text changes.
+  __atomic_store_n(&pFrame->ullSequence, 2 * ullFrame + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  __atomic_store_n(&pFrame->nTextSize, nTextSize, __ATOMIC_RELAXED);
+  memcpy(pFrame->acText, pText, nTextSize);
+
+  __atomic_store_n(&pFrame->ullSequence, 2 * ullFrame + 2, __ATOMIC_RELEASE);
+  __atomic_store_n(&pBroadcastRing->ullFrameAmount, ullFrame + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * Starts broadcasting everything printed to the console to spectators, one frame before every input wait. Writing a
+ * frame is the broadcast's only cost to the game, no matter how many spectators attach.
+ * @param strName The name of the broadcast, which spectators attach with.
+ * @pre @p strName must be at most 64 characters long and must not contain `'/'`.
+ * @returns `1` if the broadcast was started or `0` if another game is broadcasting with the same name, its shared
+ * memory could not be created, or the console already has too many output chunk handlers.
+ */
+int startSpectatorBroadcast(const char *strName) {
+  char strSharedMemoryName[sizeof(SPECTATOR_NAME_PREFIX) + SPECTATOR_MAXIMUM_NAME_SIZE];
+
+  if (!getSpectatorSharedMemoryName(strName, strSharedMemoryName)) return 0;
+
+  int nFileDescriptor = shm_open(strSharedMemoryName, O_RDWR | O_CREAT | O_EXCL, 0644);
+  SpectatorView sView;
+
+  // Only replace the memory of an earlier game with the same name once that game is over, whose spectators keep their
+  // own mapping of it.
+  if (nFileDescriptor < 0 && errno == EEXIST && attachSpectatorView(&sView, strName)) {
+    int bIsOver = isSpectatorGameOver(sView.pRing);
+
+    detachSpectatorView(&sView);
+
+    if (bIsOver && shm_unlink(strSharedMemoryName) == 0) {
+      nFileDescriptor = shm_open(strSharedMemoryName, O_RDWR | O_CREAT | O_EXCL, 0644);
+    }
+  }
+
+  if (nFileDescriptor < 0) return 0;
+
+  void *pMemory = MAP_FAILED;
+
+  if (ftruncate(nFileDescriptor, sizeof(SpectatorRing)) == 0) {
+    pMemory = mmap(NULL, sizeof(SpectatorRing), PROT_READ | PROT_WRITE, MAP_SHARED, nFileDescriptor, 0);
+  }
+
+  close(nFileDescriptor);
+
+  if (pMemory == MAP_FAILED) {
+    shm_unlink(strSharedMemoryName);
+
+    return 0;
+  }
+
+  // The new memory is zeroed, so only the header has to be written.
+  pBroadcastRing = pMemory;
+  pBroadcastRing->nVersion = SPECTATOR_RING_VERSION;
+  pBroadcastRing->nPlayerId = (int)getpid();
+
+  memcpy(pBroadcastRing->acMagic, SPECTATOR_RING_MAGIC, sizeof(pBroadcastRing->acMagic));
+
+  if (!addOutputChunkHandler(writeSpectatorFrame)) {
+    munmap(pMemory, sizeof(SpectatorRing));
+    shm_unlink(strSharedMemoryName);
+
+    pBroadcastRing = NULL;
+
+    return 0;
+  }
+
+  strcpy(strBroadcastSharedMemoryName, strSharedMemoryName);
+
+  return 1;
+}
+
+/** Writes the last frame, tells the spectators that the game has ended, and removes the broadcast's name. */
+void stopSpectatorBroadcast(void) {
+  if (pBroadcastRing == NULL) return;
+
+  fflush(stdout);
+  removeOutputChunkHandler(writeSpectatorFrame);
+
+  __atomic_store_n(&pBroadcastRing->bIsOver, 1, __ATOMIC_RELEASE);
+
+  munmap(pBroadcastRing, sizeof(SpectatorRing));
+  shm_unlink(strBroadcastSharedMemoryName);
+
+  pBroadcastRing = NULL;
+}
+#endif
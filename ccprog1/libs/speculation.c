@@ -0,0 +1,362 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose pthread_sigmask() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "speculation.h"
+
+#if RENDER_BACKEND == ANSI_RENDER_BACKEND
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "console.h"
+#include "layout.h"
+#include "text-graphics.h"
+
+#define EMPTY_FRAME_STATE_ID 'E'
+#define PENDING_FRAME_STATE_ID 'P'
+#define RENDERED_FRAME_STATE_ID 'R'
+
+/** A screen that has been asked to be rendered ahead of time, and the frame that it is rendered into. */
+typedef struct SpeculativeFrame {
+  char cScreenId;
+  int anArguments[SPECULATIVE_SCREEN_MAXIMUM_ARGUMENT_AMOUNT];
+  int nArgumentAmount;
+  /** `'E'` if the frame is unused, `'P'` if its screen is waiting to be rendered, or `'R'` if it has been rendered. */
+  char cStateId;
+  /** The console width that the screen was rendered for. */
+  int nLayoutWidth;
+  /** When the screen was last requested, which picks the frame to reuse. */
+  long long llRequestOrder;
+  ConsoleFrame sConsoleFrame;
+} SpeculativeFrame;
+
+/*
+ * The helper thread only renders while the game thread is blocked on the player's input, and the game thread waits
+ * for the frame being rendered once the input arrives. The console, the layout, and the frames are therefore never
+ * used by both threads at once, and the mutex only hands them over.
+ */
+static SpeculativeFrame asSpeculativeFrames[SPECULATIVE_FRAME_AMOUNT];
+static pthread_mutex_t sSpeculationMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sSpeculationCondition = PTHREAD_COND_INITIALIZER;
+static pthread_t sSpeculationThread;
+static int bSpeculationIsStarted = 0;
+static int bSpeculationIsStopping = 0;
+static int bInputIsAwaited = 0;
+static int bFrameIsRendering = 0;
+// Set on the helper thread while it renders, so that the screens' print functions do not look for their own frames.
+static int bScreenIsSpeculative = 0;
+static long long llRequestAmount = 0;
+static long long llRenderedScreenAmount = 0;
+static long long llPrintedScreenAmount = 0;
+
+/**
+ * Finds the frame of a requested screen.
+ * @param cScreenId The screen's ID.
+ * @param nArgumentAmount The number of arguments that the screen's print function takes.
+ * @param anArguments The arguments of the screen's print function.
+ * @returns The frame, or `NULL` if the screen has not been requested.
+ */
+static SpeculativeFrame *findSpeculativeFrame(char cScreenId, int nArgumentAmount, const int anArguments[]) {
+  for (int nFrameIndex = 0; nFrameIndex < SPECULATIVE_FRAME_AMOUNT; nFrameIndex++) {
+    SpeculativeFrame *pFrame = &asSpeculativeFrames[nFrameIndex];
+
+    if (pFrame->cStateId != EMPTY_FRAME_STATE_ID && pFrame->cScreenId == cScreenId &&
+        pFrame->nArgumentAmount == nArgumentAmount &&
+        memcmp(pFrame->anArguments, anArguments, nArgumentAmount * sizeof(int)) == 0) {
+      return pFrame;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * Finds the frame whose screen has waited the longest to be rendered.
+ * @returns The frame, or `NULL` if every requested screen has been rendered.
+ */
+static SpeculativeFrame *findPendingSpeculativeFrame(void) {
+  SpeculativeFrame *pPendingFrame = NULL;
+
+  for (int nFrameIndex = 0; nFrameIndex < SPECULATIVE_FRAME_AMOUNT; nFrameIndex++) {
+    SpeculativeFrame *pFrame = &asSpeculativeFrames[nFrameIndex];
+
+    if (pFrame->cStateId == PENDING_FRAME_STATE_ID &&
+        (pPendingFrame == NULL || pFrame->llRequestOrder < pPendingFrame->llRequestOrder)) {
+      pPendingFrame = pFrame;
+    }
+  }
+
+  return pPendingFrame;
+}
+
+/**
+ * Renders a frame's screen by calling the screen's print function.
+ * @param pFrame The frame.
+ */
+static void renderSpeculativeScreen(const SpeculativeFrame *pFrame) {
+  const int *anArguments = pFrame->anArguments;
+
+  switch (pFrame->cScreenId) {
+    case MAIN_SCREEN_ID: {
+      printMainScreen(anArguments[0], (char)anArguments[1], anArguments[2], anArguments[3], anArguments[4],
+                      anArguments[5], anArguments[6], anArguments[7], anArguments[8], anArguments[9], anArguments[10],
+                      anArguments[11], anArguments[12], anArguments[13], anArguments[14], anArguments[15]);
+
+      break;
+    }
+    case TRANSACTION_SCREEN_ID: {
+      printTransactionScreen((char)anArguments[0], (char)anArguments[1], anArguments[2], anArguments[3]);
+
+      break;
+    }
+    case UPGRADE_SCREEN_ID: {
+      printShipUpgradeScreen(anArguments[0], anArguments[1]);
+
+      break;
+    }
+    // Set to default instead of 'N' to satisfy the compiler
+    default: {
+      printNavigationScreen((char)anArguments[0], anArguments[1]);
+
+      break;
+    }
+  }
+}
+
+/**
+ * Renders the requested screens one at a time while the game waits for the player's input.
+ * @param pArgument Nothing.
+ * @returns Nothing.
+ */
+static void *runSpeculativeRenderer(void *pArgument) {
+  (void)pArgument;
+
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  while (!bSpeculationIsStopping) {
+    SpeculativeFrame *pFrame = bInputIsAwaited ? findPendingSpeculativeFrame() : NULL;
+
+    if (pFrame == NULL) {
+      pthread_cond_wait(&sSpeculationCondition, &sSpeculationMutex);
+
+      continue;
+    }
+
+    bFrameIsRendering = 1;
+
+    pthread_mutex_unlock(&sSpeculationMutex);
+
+    bScreenIsSpeculative = 1;
+    pFrame->nLayoutWidth = getLayoutWidth();
+
+    beginConsoleFrame(&pFrame->sConsoleFrame);
+    renderSpeculativeScreen(pFrame);
+    endConsoleFrame();
+
+    bScreenIsSpeculative = 0;
+
+    pthread_mutex_lock(&sSpeculationMutex);
+
+    pFrame->cStateId = pFrame->sConsoleFrame.bIsTruncated ? EMPTY_FRAME_STATE_ID : RENDERED_FRAME_STATE_ID;
+    llRenderedScreenAmount++;
+    bFrameIsRendering = 0;
+
+    pthread_cond_broadcast(&sSpeculationCondition);
+  }
+
+  pthread_mutex_unlock(&sSpeculationMutex);
+
+  return NULL;
+}
+
+/**
+ * Lets the helper thread render while the game waits for the player's input, and takes the console back from it once
+ * the input arrives.
+ * @param bIsWaiting `1` right before the game starts waiting or `0` right after the input has arrived.
+ */
+static void handleSpeculativeInputWait(int bIsWaiting) {
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  bInputIsAwaited = bIsWaiting;
+
+  if (bIsWaiting) {
+    pthread_cond_broadcast(&sSpeculationCondition);
+  } else {
+    // Rendering a single screen takes far less time than the player's input, so this rarely waits at all.
+    while (bFrameIsRendering) pthread_cond_wait(&sSpeculationCondition, &sSpeculationMutex);
+  }
+
+  pthread_mutex_unlock(&sSpeculationMutex);
+}
+
+/**
+ * Starts a helper thread that renders the requested screens into frames while the game waits for the player's input,
+ * so that the screen that the input leads to can be printed out in a single write instead of being rendered after it.
+ * @returns `1` if the helper thread was started or `0` if the screens are always rendered when printed.
+ */
+int startSpeculativeRendering(void) {
+  static int bStopIsRegistered = 0;
+  sigset_t sAllSignals;
+  sigset_t sGameSignals;
+
+  if (bSpeculationIsStarted) return 1;
+
+  for (int nFrameIndex = 0; nFrameIndex < SPECULATIVE_FRAME_AMOUNT; nFrameIndex++) {
+    asSpeculativeFrames[nFrameIndex].cStateId = EMPTY_FRAME_STATE_ID;
+  }
+
+  // Leave every signal, like the terminal being resized or interrupted, to the game thread.
+  sigfillset(&sAllSignals);
+  pthread_sigmask(SIG_SETMASK, &sAllSignals, &sGameSignals);
+
+  bSpeculationIsStopping = 0;
+  bSpeculationIsStarted = pthread_create(&sSpeculationThread, NULL, runSpeculativeRenderer, NULL) == 0;
+
+  pthread_sigmask(SIG_SETMASK, &sGameSignals, NULL);
+
+  if (!bSpeculationIsStarted) return 0;
+
+  if (!bStopIsRegistered) bStopIsRegistered = atexit(stopSpeculativeRendering) == 0;
+
+  setInputWaitHandler(handleSpeculativeInputWait);
+
+  return 1;
+}
+
+/** Stops the helper thread, which forgets every rendered frame when started again. */
+void stopSpeculativeRendering(void) {
+  if (!bSpeculationIsStarted) return;
+
+  setInputWaitHandler(NULL);
+
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  bSpeculationIsStopping = 1;
+
+  pthread_cond_broadcast(&sSpeculationCondition);
+  pthread_mutex_unlock(&sSpeculationMutex);
+  pthread_join(sSpeculationThread, NULL);
+
+  bSpeculationIsStarted = 0;
+}
+
+/**
+ * Asks for a screen to be rendered during the next input wait, because it is likely to be printed after the input.
+ * The frames of the least recently requested screens are reused once every frame is taken. Each screen's own request
+ * function below passes the arguments, so that their number always matches the screen.
+ * @param cScreenId `'M'` for the main screen, `'T'` for the transaction screen, `'U'` for the ship upgrade screen, or
+ * `'N'` for the navigation screen.
+ * @param nArgumentAmount The number of arguments that the screen's print function takes.
+ * @pre @p nArgumentAmount must have an integer value within the range of `1` and `16`.
+ * @param anArguments The arguments of the screen's print function, in the same order.
+ */
+void requestSpeculativeScreen(char cScreenId, int nArgumentAmount, const int anArguments[]) {
+  if (!bSpeculationIsStarted) return;
+
+  int nLayoutWidth = getLayoutWidth();
+
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  SpeculativeFrame *pFrame = findSpeculativeFrame(cScreenId, nArgumentAmount, anArguments);
+
+  if (pFrame == NULL) {
+    pFrame = &asSpeculativeFrames[0];
+
+    for (int nFrameIndex = 1; nFrameIndex < SPECULATIVE_FRAME_AMOUNT && pFrame->cStateId != EMPTY_FRAME_STATE_ID;
+         nFrameIndex++) {
+      SpeculativeFrame *pOtherFrame = &asSpeculativeFrames[nFrameIndex];
+
+      if (pOtherFrame->cStateId == EMPTY_FRAME_STATE_ID || pOtherFrame->llRequestOrder < pFrame->llRequestOrder) {
+        pFrame = pOtherFrame;
+      }
+    }
+
+    pFrame->cScreenId = cScreenId;
+    pFrame->nArgumentAmount = nArgumentAmount;
+    pFrame->cStateId = PENDING_FRAME_STATE_ID;
+
+    memcpy(pFrame->anArguments, anArguments, nArgumentAmount * sizeof(int));
+  } else if (pFrame->cStateId == RENDERED_FRAME_STATE_ID && pFrame->nLayoutWidth != nLayoutWidth) {
+    // Render the screen again for the terminal's new width.
+    pFrame->cStateId = PENDING_FRAME_STATE_ID;
+  }
+
+  pFrame->llRequestOrder = ++llRequestAmount;
+
+  pthread_mutex_unlock(&sSpeculationMutex);
+}
+
+/**
+ * Prints out a screen from its frame if it was requested and has already been rendered for the console's current
+ * width and colors, which is checked by every screen's print function before rendering it. Each screen's own print
+ * function below passes the arguments, so that their number always matches the screen.
+ * @param cScreenId `'M'` for the main screen, `'T'` for the transaction screen, `'U'` for the ship upgrade screen, or
+ * `'N'` for the navigation screen.
+ * @param nArgumentAmount The number of arguments that the screen's print function takes.
+ * @pre @p nArgumentAmount must have an integer value within the range of `1` and `16`.
+ * @param anArguments The arguments of the screen's print function, in the same order.
+ * @returns `1` if the screen was printed out or `0` if it still has to be rendered.
+ */
+int printSpeculativeScreen(char cScreenId, int nArgumentAmount, const int anArguments[]) {
+  if (!bSpeculationIsStarted || bScreenIsSpeculative) return 0;
+
+  int nLayoutWidth = getLayoutWidth();
+  int bIsPrinted = 0;
+
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  SpeculativeFrame *pFrame = findSpeculativeFrame(cScreenId, nArgumentAmount, anArguments);
+
+  if (pFrame != NULL && pFrame->cStateId == RENDERED_FRAME_STATE_ID && pFrame->nLayoutWidth == nLayoutWidth) {
+    bIsPrinted = printConsoleFrame(&pFrame->sConsoleFrame);
+  }
+
+  if (bIsPrinted) llPrintedScreenAmount++;
+
+  pthread_mutex_unlock(&sSpeculationMutex);
+
+  return bIsPrinted;
+}
+
+/**
+ * Blocks until every requested screen has been rendered, as if the player took their time to input.
+ * @pre The helper thread must have been started.
+ */
+void waitForSpeculativeScreens(void) {
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  bInputIsAwaited = 1;
+
+  pthread_cond_broadcast(&sSpeculationCondition);
+
+  while (bFrameIsRendering || findPendingSpeculativeFrame() != NULL) {
+    pthread_cond_wait(&sSpeculationCondition, &sSpeculationMutex);
+  }
+
+  bInputIsAwaited = 0;
+
+  pthread_mutex_unlock(&sSpeculationMutex);
+}
+
+/**
+ * Gets the number of screens that were rendered ahead of time and the number of them that were printed out.
+ * @param[out] llRenderedAmount The number of screens rendered by the helper thread.
+ * @param[out] llPrintedAmount The number of screens printed out from their frames.
+ */
+void getSpeculativeScreenAmounts(long long *llRenderedAmount, long long *llPrintedAmount) {
+  pthread_mutex_lock(&sSpeculationMutex);
+
+  *llRenderedAmount = llRenderedScreenAmount;
+  *llPrintedAmount = llPrintedScreenAmount;
+
+  pthread_mutex_unlock(&sSpeculationMutex);
+}
+#endif
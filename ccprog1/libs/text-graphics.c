@@ -10,23 +10,61 @@
 #include <stdio.h>
 
 #include "console.h"
+#include "json-lines.h"
+#include "layout.h"
 #include "prompts.h"
+#include "rendering.h"
+#include "speculation.h"
 #include "trading.h"
 
+// The screens are printed as art unless the game is started with the JSON lines format.
+static char cScreenFormatId = ART_SCREEN_FORMAT_ID;
+static FILE *pScreenStream = NULL;
+
+/**
+ * Sets how the game's screens are printed out. The art screens are printed to the console, while the JSON lines screens
+ * are each printed as a single compact JSON object of the screen's state, so that tools do not have to scrape the art.
+ * @param cFormatId `'A'` for the art screens or `'J'` for the JSON lines screens.
+ * @param pStream The stream to print the JSON lines screens to.
+ */
+void setScreenFormat(char cFormatId, FILE *pStream) {
+  cScreenFormatId = cFormatId;
+  pScreenStream = pStream;
+}
+
+/**
+ * Starts the JSON object of a JSON lines screen.
+ * @param[out] pJsonLine The JSON object.
+ * @param strScreenName The name of the screen, which every object starts with.
+ */
+static void beginScreenJsonLine(JsonLine *pJsonLine, const char *strScreenName) {
+  beginJsonLine(pJsonLine);
+  addJsonStringField(pJsonLine, "screen", strScreenName);
+}
+
 /** Prints out a pre-formatted separator line to the console. */
 void printSeparator(void) {
-  printf("\n\n\n");
+  printRenderedText("\n\n\n");
 
-  for (int nPrintedDashAmount = 0; nPrintedDashAmount < MAX_PRINT_WIDTH; nPrintedDashAmount++) printf("━");
+  printRenderedText("%s", getLayoutSeparator());
 
-  printf("\n\n\n\n");
+  printRenderedText("\n\n\n\n");
 }
 
 /** Prints out the game's start screen, which contains the game's title, to the console. */
 void printGameStartScreen(void) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+
+    beginScreenJsonLine(&sJsonLine, "start");
+    writeJsonLine(&sJsonLine, pScreenStream);
+
+    return;
+  }
+
   printSeparator();
 
-  printf(
+  printRenderedText(getLayoutTemplate(
     "     ███      ▄█  ████████▄     ▄████████    ▄████████       ▄██████▄     ▄████████        ▄▄▄▄███▄▄▄▄      ▄████████ ███▄▄▄▄    ▄█   ▄█          ▄████████\n"
     " ▀█████████▄ ███  ███   ▀███   ███    ███   ███    ███      ███    ███   ███    ███      ▄██▀▀▀███▀▀▀██▄   ███    ███ ███▀▀▀██▄ ███  ███         ███    ███\n"
     "    ▀███▀▀██ ███▌ ███    ███   ███    █▀    ███    █▀       ███    ███   ███    █▀       ███   ███   ███   ███    ███ ███   ███ ███▌ ███         ███    ███\n"
@@ -35,17 +73,17 @@ void printGameStartScreen(void) {
     "     ███     ███  ███    ███   ███    █▄           ███      ███    ███   ███             ███   ███   ███   ███    ███ ███   ███ ███  ███         ███    ███\n"
     "     ███     ███  ███   ▄███   ███    ███    ▄█    ███      ███    ███   ███             ███   ███   ███   ███    ███ ███   ███ ███  ███▌    ▄   ███    ███\n"
     "    ▄████▀   █▀   ████████▀    ██████████  ▄████████▀        ▀██████▀    ███              ▀█   ███   █▀    ███    █▀   ▀█   █▀  █▀   █████▄▄██   ███    █▀\n"
-    "                                                                                                                                     ▀\n");
+    "                                                                                                                                     ▀\n"));
 
-  printf("\n");
+  printRenderedText("\n");
 
-  printf(
+  printRenderedText(getLayoutTemplate(
     "                                    ▗▄▖     ▗▖  ▗▖▗▄▄▄▖▗▄▄▖  ▗▄▄▖▗▖ ▗▖ ▗▄▖ ▗▖  ▗▖▗▄▄▄▖▗▄▄▖    ▗▄▄▄▖ ▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖\n"
     "                                   ▐▌ ▐▌    ▐▛▚▞▜▌▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▛▚▖▐▌  █ ▐▌       ▐▌ ▐▌ ▐▌ ▐▌▐▌   ▐▌     █\n"
     "                                   ▐▛▀▜▌    ▐▌  ▐▌▐▛▀▀▘▐▛▀▚▖▐▌   ▐▛▀▜▌▐▛▀▜▌▐▌ ▝▜▌  █  ▝▀▚▖    ▐▌ ▐▌ ▐▌ ▐▌▐▛▀▀▘ ▝▀▚▖  █\n"
-    "                                   ▐▌ ▐▌    ▐▌  ▐▌▐▙▄▄▖▐▌ ▐▌▝▚▄▄▖▐▌ ▐▌▐▌ ▐▌▐▌  ▐▌  █ ▗▄▄▞▘    ▐▙▄▟▙▖▝▚▄▞▘▐▙▄▄▖▗▄▄▞▘  █\n");
+    "                                   ▐▌ ▐▌    ▐▌  ▐▌▐▙▄▄▖▐▌ ▐▌▝▚▄▄▖▐▌ ▐▌▐▌ ▐▌▐▌  ▐▌  █ ▗▄▄▞▘    ▐▙▄▟▙▖▝▚▄▞▘▐▙▄▄▖▗▄▄▞▘  █\n"));
 
-  printf("\n\n\n\n\n");
+  printRenderedText("\n\n\n\n\n");
 }
 
 /**
@@ -75,56 +113,85 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
                      int nShipCoconutCargoAmount, int nShipRiceCargoAmount, int nShipSilkCargoAmount,
                      int nShipGunCargoAmount, int nCoconutMarketPrice, int nRiceMarketPrice, int nSilkMarketPrice,
                      int nGunMarketPrice) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+    int anShipCargoAmounts[CARGO_AMOUNT] = {nShipCoconutCargoAmount, nShipRiceCargoAmount, nShipSilkCargoAmount,
+                                            nShipGunCargoAmount};
+    int anMarketPrices[CARGO_AMOUNT] = {nCoconutMarketPrice, nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice};
+
+    beginScreenJsonLine(&sJsonLine, "main");
+    addJsonIntegerField(&sJsonLine, "turns", nPlayerTurns);
+    addJsonCharacterField(&sJsonLine, "port", cPortId);
+    addJsonIntegerField(&sJsonLine, "player", nPlayerId);
+    addJsonIntegerField(&sJsonLine, "balance", nPlayerBalance);
+    addJsonIntegerField(&sJsonLine, "profit", nPlayerProfit);
+    addJsonIntegerField(&sJsonLine, "target", nPlayerProfitTarget);
+    addJsonIntegerField(&sJsonLine, "cargo", nShipTotalCargoAmount);
+    addJsonIntegerField(&sJsonLine, "cargo_limit", nShipCargoLimit);
+    addJsonIntegerArrayField(&sJsonLine, "ship_cargo", anShipCargoAmounts, CARGO_AMOUNT);
+    addJsonIntegerArrayField(&sJsonLine, "prices", anMarketPrices, CARGO_AMOUNT);
+    writeJsonLine(&sJsonLine, pScreenStream);
+
+    return;
+  }
+
+  if (printSpeculativeMainScreen(nPlayerTurns, cPortId, nPlayerId, nPlayerBalance, nPlayerProfit, nPlayerProfitTarget,
+                                 nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount, nShipRiceCargoAmount,
+                                 nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice,
+                                 nSilkMarketPrice, nGunMarketPrice)) {
+    return;
+  }
+
   printSeparator();
 
   switch (cPortId) {
     case 'T': {
-      printf(
+      printRenderedText(getLayoutTemplate(
         "                                                        ████████  ██████  ███    ██ ██████   ██████\n"
         "                                                           ██    ██    ██ ████   ██ ██   ██ ██    ██\n"
         "                                                           ██    ██    ██ ██ ██  ██ ██   ██ ██    ██\n"
         "                                                           ██    ██    ██ ██  ██ ██ ██   ██ ██    ██\n"
-        "                                                           ██     ██████  ██   ████ ██████   ██████\n");
+        "                                                           ██     ██████  ██   ████ ██████   ██████\n"));
 
       break;
     }
     case 'M': {
-      printf(
+      printRenderedText(getLayoutTemplate(
         "                                                      ███    ███  █████  ███    ██ ██ ██       █████\n"
         "                                                      ████  ████ ██   ██ ████   ██ ██ ██      ██   ██\n"
         "                                                      ██ ████ ██ ███████ ██ ██  ██ ██ ██      ███████\n"
         "                                                      ██  ██  ██ ██   ██ ██  ██ ██ ██ ██      ██   ██\n"
-        "                                                      ██      ██ ██   ██ ██   ████ ██ ███████ ██   ██\n");
+        "                                                      ██      ██ ██   ██ ██   ████ ██ ███████ ██   ██\n"));
 
       break;
     }
     case 'P': {
-      printf(
+      printRenderedText(getLayoutTemplate(
         "                                            ██████   █████  ███    ██ ██████   █████  ██   ██  █████  ███    ██\n"
         "                                            ██   ██ ██   ██ ████   ██ ██   ██ ██   ██ ██  ██  ██   ██ ████   ██\n"
         "                                            ██████  ███████ ██ ██  ██ ██   ██ ███████ █████   ███████ ██ ██  ██\n"
         "                                            ██      ██   ██ ██  ██ ██ ██   ██ ██   ██ ██  ██  ██   ██ ██  ██ ██\n"
-        "                                            ██      ██   ██ ██   ████ ██████  ██   ██ ██   ██ ██   ██ ██   ████\n");
+        "                                            ██      ██   ██ ██   ████ ██████  ██   ██ ██   ██ ██   ██ ██   ████\n"));
 
       break;
     }
     case 'S': {
-      printf(
+      printRenderedText(getLayoutTemplate(
         "                                                                   ███████  █████  ██████   █████\n"
         "                                                                   ██      ██   ██ ██   ██ ██   ██\n"
         "                                                                   ███████ ███████ ██████  ███████\n"
         "                                                                        ██ ██   ██ ██      ██   ██\n"
-        "                                                                   ███████ ██   ██ ██      ██   ██\n");
+        "                                                                   ███████ ██   ██ ██      ██   ██\n"));
 
       break;
     }
   }
 
-  printf("\n\n");
+  printRenderedText("\n\n");
 
-  printf(
+  printRenderedText(getLayoutTemplate(
     "   • Merchant ID: %3d                                                                                              • Balance: %d Gold Coins\n"
-    "   • Profit:",
+    "   • Profit:"),
     nPlayerId, nPlayerBalance);
 
   if (nPlayerProfit >= nPlayerProfitTarget) {
@@ -133,15 +200,15 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
     setConsoleColorToRed();
   }
 
-  printf(" %d%%\n", nPlayerProfit);
+  printRenderedText(" %d%%\n", nPlayerProfit);
   resetConsoleColor();
 
-  printf("   • Target Profit %d%%\n", nPlayerProfitTarget);
+  printRenderedText(getLayoutTemplate("   • Target Profit %d%%\n"), nPlayerProfitTarget);
 
-  printf("\n\n");
+  printRenderedText("\n\n");
 
   if (nShipCargoLimit <= TIER_ONE_SHIP_CARGO_LIMIT) {
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                                               ~~~\n"
       "                                                          ~~~~     ~~~~        |\n"
       "                                                               ~~~            /|\n"
@@ -152,9 +219,9 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
       "                                                                         /     |____\\\n"
       "                                                                   _____/______|_________\n"
       "                                                                    \\__________________/\n"
-      "                                                            ~~..             ...~~~.           ....~~~...\n");
+      "                                                            ~~..             ...~~~.           ....~~~...\n"));
   } else if (nShipCargoLimit <= TIER_TWO_SHIP_CARGO_LIMIT) {
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                                          ~~~\n"
       "                                                     ~~~~     ~~~~       |\n"
       "                                                          ~~~          -----        |\n"
@@ -165,9 +232,9 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
       "                                                                    /_________\\     |____\\\n"
       "                                                              ___________|__________|_________\n"
       "                                                               \\____________________________/\n"
-      "                                                       ~~..             ...~~~.           ....~~~...     ..~\n");
+      "                                                       ~~..             ...~~~.           ....~~~...     ..~\n"));
   } else if (nShipCargoLimit <= TIER_THREE_SHIP_CARGO_LIMIT) {
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                                      ~~~             |\n"
       "                                                 ~~~~     ~~~~      -----              |\n"
       "                                                      ~~~           )___(            -----\n"
@@ -179,9 +246,9 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
       "                                                          ____________|________________|__________\n"
       "                                                           \\_                                  _/\n"
       "                                                             \\________________________________/\n"
-      "                                                   ~~..             ...~~~.           ....~~~...     ..~\n");
+      "                                                   ~~..             ...~~~.           ....~~~...     ..~\n"));
   } else {
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                                   ~~~             |\n"
       "                                              ~~~~     ~~~~      -----                    |\n"
       "                                                   ~~~           )___(                  -----\n"
@@ -197,12 +264,12 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
       "                                                       ____________|______________________|__________\n"
       "                                                        \\_                                        _/\n"
       "                                                          \\______________________________________/\n"
-      "                                                   ~~..             ...~~~.           ....~~~...     ..~\n");
+      "                                                   ~~..             ...~~~.           ....~~~...     ..~\n"));
   }
 
-  printf("\n\n");
+  printRenderedText("\n\n");
 
-  printf(
+  printRenderedText(getLayoutTemplate(
     "   ║                                    ║                                                                          ║                                    ║\n"
     " ==X====================================X==                                                                      ==X====================================X==\n"
     "   ║    Total Cargo    |   %3d of %3d   ║                                                                          ║   Market Prices   |  Day %2d of 29  ║\n"
@@ -210,12 +277,12 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
     "   ║  Coconut  |  %3d  |  Silk  |  %3d  ║                                                                          ║  Coconut  |  %3d  |  Silk  |  %3d  ║\n"
     "   ║  Rice     |  %3d  |  Gun   |  %3d  ║                                                                          ║  Rice     |  %3d  |  Gun   |  %3d  ║\n"
     " ==X====================================X==                                                                      ==X====================================X==\n"
-    "   ║                                    ║                                                                          ║                                    ║\n",
+    "   ║                                    ║                                                                          ║                                    ║\n"),
     nShipTotalCargoAmount, nShipCargoLimit, nPlayerTurns, nShipCoconutCargoAmount, nShipSilkCargoAmount,
     nCoconutMarketPrice, nSilkMarketPrice, nShipRiceCargoAmount, nShipGunCargoAmount, nRiceMarketPrice,
     nGunMarketPrice);
 
-  printf("\n\n\n");
+  printRenderedText("\n\n\n");
 }
 
 /**
@@ -229,6 +296,22 @@ void printMainScreen(int nPlayerTurns, char cPortId, int nPlayerId, int nPlayerB
  * @param nCargoPrice The price of the cargo.
  */
 void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmount, int nCargoPrice) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+
+    beginScreenJsonLine(&sJsonLine, "transaction");
+    addJsonCharacterField(&sJsonLine, "action", cTransactionType);
+    addJsonCharacterField(&sJsonLine, "cargo", cCargoId);
+    addJsonIntegerField(&sJsonLine, "amount", nCargoAmount);
+    addJsonIntegerField(&sJsonLine, "price", nCargoPrice);
+    addJsonIntegerField(&sJsonLine, "total", (long long)nCargoAmount * nCargoPrice);
+    writeJsonLine(&sJsonLine, pScreenStream);
+
+    return;
+  }
+
+  if (printSpeculativeTransactionScreen(cTransactionType, cCargoId, nCargoAmount, nCargoPrice)) return;
+
   printSeparator();
 
   int nLeftPaddingSize;
@@ -238,105 +321,99 @@ void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmou
   switch (cCargoId) {
     case 'C': {
       if (cTransactionType == BUY_ACTION_ID) {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                         ▗▄▄▖ ▗▄▖  ▗▄▄▖ ▗▄▖ ▗▖  ▗▖▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
           "                                        ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌ ▐▌  █  ▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
           "                                        ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▝▜▌▐▌ ▐▌  █   ▝▀▚▖    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-          "                                        ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+          "                                        ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 40;
+        nLeftPaddingSize = getLayoutPaddingSize(40);
 
-        setConsoleColorToGreen();
-        printf("%*c• You added %d coconuts to the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(GREEN_COLOR_ID, "%*c• You added %d coconuts to the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       } else {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                              ▗▄▄▖ ▗▄▖  ▗▄▄▖ ▗▄▖ ▗▖  ▗▖▗▖ ▗▖▗▄▄▄▖ ▗▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
           "                                             ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌ ▐▌  █  ▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
           "                                             ▐▌   ▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▝▜▌▐▌ ▐▌  █   ▝▀▚▖     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-          "                                             ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+          "                                             ▝▚▄▄▖▝▚▄▞▘▝▚▄▄▖▝▚▄▞▘▐▌  ▐▌▝▚▄▞▘  █  ▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 45;
+        nLeftPaddingSize = getLayoutPaddingSize(45);
 
-        setConsoleColorToRed();
-        printf("%*c• You removed %d coconuts from the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(RED_COLOR_ID, "%*c• You removed %d coconuts from the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       }
 
       break;
     }
     case 'R': {
       if (cTransactionType == BUY_ACTION_ID) {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                                   ▗▄▄▖ ▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
           "                                                   ▐▌ ▐▌  █  ▐▌   ▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
           "                                                   ▐▛▀▚▖  █  ▐▌   ▐▛▀▀▘    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-          "                                                   ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+          "                                                   ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 51;
+        nLeftPaddingSize = getLayoutPaddingSize(51);
 
-        setConsoleColorToGreen();
-        printf("%*c• You added %d rice to the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(GREEN_COLOR_ID, "%*c• You added %d rice to the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       } else {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                                        ▗▄▄▖ ▗▄▄▄▖ ▗▄▄▖▗▄▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
           "                                                        ▐▌ ▐▌  █  ▐▌   ▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
           "                                                        ▐▛▀▚▖  █  ▐▌   ▐▛▀▀▘     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-          "                                                        ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+          "                                                        ▐▌ ▐▌▗▄█▄▖▝▚▄▄▖▐▙▄▄▖    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 56;
+        nLeftPaddingSize = getLayoutPaddingSize(56);
 
-        setConsoleColorToRed();
-        printf("%*c• You removed %d rice from the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(RED_COLOR_ID, "%*c• You removed %d rice from the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       }
 
       break;
     }
     case 'S': {
       if (cTransactionType == BUY_ACTION_ID) {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                                    ▗▄▄▖▗▄▄▄▖▗▖   ▗▖ ▗▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
           "                                                   ▐▌     █  ▐▌   ▐▌▗▞▘    ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
           "                                                    ▝▀▚▖  █  ▐▌   ▐▛▚▖     ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-          "                                                   ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+          "                                                   ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 51;
+        nLeftPaddingSize = getLayoutPaddingSize(51);
 
-        setConsoleColorToGreen();
-        printf("%*c• You added %d silk to the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(GREEN_COLOR_ID, "%*c• You added %d silk to the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       } else {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                                         ▗▄▄▖▗▄▄▄▖▗▖   ▗▖ ▗▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
           "                                                        ▐▌     █  ▐▌   ▐▌▗▞▘    ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
           "                                                         ▝▀▚▖  █  ▐▌   ▐▛▚▖      ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-          "                                                        ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+          "                                                        ▗▄▄▞▘▗▄█▄▖▐▙▄▄▖▐▌ ▐▌    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 56;
+        nLeftPaddingSize = getLayoutPaddingSize(56);
 
-        setConsoleColorToRed();
-        printf("%*c• You removed %d silk from the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(RED_COLOR_ID, "%*c• You removed %d silk from the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       }
 
       break;
@@ -344,35 +421,33 @@ void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmou
     // Set to default instead of 'G' to satisfy the compiler
     default: {
       if (cTransactionType == BUY_ACTION_ID) {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                                   ▗▄▄▖▗▖ ▗▖▗▖  ▗▖ ▗▄▄▖    ▗▄▄▖  ▗▄▖ ▗▖ ▗▖ ▗▄▄▖▗▖ ▗▖▗▄▄▄▖\n"
           "                                                  ▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌       ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌  █\n"
           "                                                  ▐▌▝▜▌▐▌ ▐▌▐▌ ▝▜▌ ▝▀▚▖    ▐▛▀▚▖▐▌ ▐▌▐▌ ▐▌▐▌▝▜▌▐▛▀▜▌  █\n"
-          "                                                  ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n");
+          "                                                  ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▐▙▄▞▘▝▚▄▞▘▝▚▄▞▘▝▚▄▞▘▐▌ ▐▌  █\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 50;
+        nLeftPaddingSize = getLayoutPaddingSize(50);
 
-        setConsoleColorToGreen();
-        printf("%*c• You added %d guns to the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(GREEN_COLOR_ID, "%*c• You added %d guns to the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       } else {
-        printf(
+        printRenderedText(getLayoutTemplate(
           "                                                        ▗▄▄▖▗▖ ▗▖▗▖  ▗▖ ▗▄▄▖     ▗▄▄▖ ▗▄▖ ▗▖   ▗▄▄▄ \n"
           "                                                       ▐▌   ▐▌ ▐▌▐▛▚▖▐▌▐▌       ▐▌   ▐▌ ▐▌▐▌   ▐▌  █\n"
           "                                                       ▐▌▝▜▌▐▌ ▐▌▐▌ ▝▜▌ ▝▀▚▖     ▝▀▚▖▐▌ ▐▌▐▌   ▐▌  █\n"
-          "                                                       ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n");
+          "                                                       ▝▚▄▞▘▝▚▄▞▘▐▌  ▐▌▗▄▄▞▘    ▗▄▄▞▘▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀\n"));
         resetConsoleColor();
 
-        printf("\n\n");
+        printRenderedText("\n\n");
 
-        nLeftPaddingSize = 55;
+        nLeftPaddingSize = getLayoutPaddingSize(55);
 
-        setConsoleColorToRed();
-        printf("%*c• You removed %d guns from the ship's storage!\n", nLeftPaddingSize, ' ', nCargoAmount);
-        resetConsoleColor();
+        printStyledText(RED_COLOR_ID, "%*c• You removed %d guns from the ship's storage!\n", nLeftPaddingSize, ' ',
+                        nCargoAmount);
       }
 
       break;
@@ -380,16 +455,13 @@ void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmou
   }
 
   if (cTransactionType == BUY_ACTION_ID) {
-    setConsoleColorToRed();
-    printf("%*c• You spent %d gold coins!\n", nLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
-    resetConsoleColor();
+    printStyledText(RED_COLOR_ID, "%*c• You spent %d gold coins!\n", nLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
   } else {
-    setConsoleColorToGreen();
-    printf("%*c• You earned %d gold coins!\n", nLeftPaddingSize, ' ', nCargoPrice * nCargoAmount);
-    resetConsoleColor();
+    printStyledText(GREEN_COLOR_ID, "%*c• You earned %d gold coins!\n", nLeftPaddingSize, ' ',
+                    nCargoPrice * nCargoAmount);
   }
 
-  printf("\n\n\n\n\n");
+  printRenderedText("\n\n\n\n\n");
 }
 
 /**
@@ -399,29 +471,100 @@ void printTransactionScreen(char cTransactionType, char cCargoId, int nCargoAmou
  * @param nShipUpgradeCost The price of the ship upgrade.
  */
 void printShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+
+    beginScreenJsonLine(&sJsonLine, "upgrade");
+    addJsonIntegerField(&sJsonLine, "cargo_limit_increase", nShipCargoLimitIncrease);
+    addJsonIntegerField(&sJsonLine, "cost", nShipUpgradeCost);
+    writeJsonLine(&sJsonLine, pScreenStream);
+
+    return;
+  }
+
+  if (printSpeculativeShipUpgradeScreen(nShipCargoLimitIncrease, nShipUpgradeCost)) return;
+
   printSeparator();
 
   setConsoleColorToGreen();
-  printf(
+  printRenderedText(getLayoutTemplate(
     "                                               ▗▄▄▖▗▖ ▗▖▗▄▄▄▖▗▄▄▖     ▗▖ ▗▖▗▄▄▖  ▗▄▄▖▗▄▄▖  ▗▄▖ ▗▄▄▄ ▗▄▄▄▖▗▄▄▄\n"
     "                                              ▐▌   ▐▌ ▐▌  █  ▐▌ ▐▌    ▐▌ ▐▌▐▌ ▐▌▐▌   ▐▌ ▐▌▐▌ ▐▌▐▌  █▐▌   ▐▌  █\n"
     "                                               ▝▀▚▖▐▛▀▜▌  █  ▐▛▀▘     ▐▌ ▐▌▐▛▀▘ ▐▌▝▜▌▐▛▀▚▖▐▛▀▜▌▐▌  █▐▛▀▀▘▐▌  █\n"
-    "                                              ▗▄▄▞▘▐▌ ▐▌▗▄█▄▖▐▌       ▝▚▄▞▘▐▌   ▝▚▄▞▘▐▌ ▐▌▐▌ ▐▌▐▙▄▄▀▐▙▄▄▖▐▙▄▄▀\n");
+    "                                              ▗▄▄▞▘▐▌ ▐▌▗▄█▄▖▐▌       ▝▚▄▞▘▐▌   ▝▚▄▞▘▐▌ ▐▌▐▌ ▐▌▐▙▄▄▀▐▙▄▄▖▐▙▄▄▀\n"));
   resetConsoleColor();
 
-  printf("\n\n");
+  printRenderedText("\n\n");
 
-  int nLeftPaddingSize = 46;
+  int nLeftPaddingSize = getLayoutPaddingSize(46);
 
-  setConsoleColorToGreen();
-  printf("%*c• You gained %d additional cargo spaces!\n", nLeftPaddingSize, ' ', nShipCargoLimitIncrease);
-  resetConsoleColor();
+  printStyledText(GREEN_COLOR_ID, "%*c• You gained %d additional cargo spaces!\n", nLeftPaddingSize, ' ',
+                  nShipCargoLimitIncrease);
 
-  setConsoleColorToRed();
-  printf("%*c• You spent %d gold coins!\n", nLeftPaddingSize, ' ', nShipUpgradeCost);
-  resetConsoleColor();
+  printStyledText(RED_COLOR_ID, "%*c• You spent %d gold coins!\n", nLeftPaddingSize, ' ', nShipUpgradeCost);
+
+  printRenderedText("\n\n\n\n\n");
+}
+
+/**
+ * Prints out the game's market change screen, which tells the player that the port could not fill their order at the
+ * price they agreed to and shows what it has now, to the console.
+ * @param cCargoId The ID of the cargo that the player tried to trade.
+ * @pre @p cCargoId must have a character value of either `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @param nCargoPrice The cargo's price now.
+ * @param nStockAmount The amount of the cargo that the port has in stock now.
+ */
+void printMarketChangeScreen(char cCargoId, int nCargoPrice, int nStockAmount) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+
+    beginScreenJsonLine(&sJsonLine, "market_change");
+    addJsonCharacterField(&sJsonLine, "cargo", cCargoId);
+    addJsonIntegerField(&sJsonLine, "price", nCargoPrice);
+    addJsonIntegerField(&sJsonLine, "stock", nStockAmount);
+    writeJsonLine(&sJsonLine, pScreenStream);
 
-  printf("\n\n\n\n\n");
+    return;
+  }
+
+  const char *strCargoName;
+
+  switch (cCargoId) {
+    case 'C': {
+      strCargoName = "coconuts";
+
+      break;
+    }
+    case 'R': {
+      strCargoName = "rice";
+
+      break;
+    }
+    case 'S': {
+      strCargoName = "silk";
+
+      break;
+    }
+    default: {
+      strCargoName = "guns";
+
+      break;
+    }
+  }
+
+  printSeparator();
+
+  printRenderedText("\n\n");
+
+  int nLeftPaddingSize = getLayoutPaddingSize(48);
+
+  printStyledText(RED_COLOR_ID, "%*c• The market changed, so the port could not fill your order!\n", nLeftPaddingSize,
+                  ' ');
+
+  printStyledText(YELLOW_COLOR_ID, "%*c• The port now has %d %s at %d gold coins each.\n", nLeftPaddingSize, ' ',
+                  nStockAmount, strCargoName, nCargoPrice);
+
+  printRenderedText("\n\n\n\n\n");
 }
 
 /**
@@ -433,33 +576,46 @@ void printShipUpgradeScreen(int nShipCargoLimitIncrease, int nShipUpgradeCost) {
  * @pre @p nPlayerTurns must have a a 2-digit positive integer value.
  */
 void printNavigationScreen(char cPortID, int nPlayerTurns) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+
+    beginScreenJsonLine(&sJsonLine, "navigation");
+    addJsonCharacterField(&sJsonLine, "port", cPortID);
+    addJsonIntegerField(&sJsonLine, "turns", nPlayerTurns);
+    writeJsonLine(&sJsonLine, pScreenStream);
+
+    return;
+  }
+
+  if (printSpeculativeNavigationScreen(cPortID, nPlayerTurns)) return;
+
   printSeparator();
 
   setConsoleColorToGreen();
-  printf(
+  printRenderedText(getLayoutTemplate(
     "                                               ▗▄▄▖▗▖ ▗▖ ▗▄▖ ▗▖  ▗▖ ▗▄▄▖▗▄▄▄▖▗▄▄▄     ▗▄▄▖  ▗▄▖ ▗▄▄▖▗▄▄▄▖▗▄▄▖\n"
     "                                              ▐▌   ▐▌ ▐▌▐▌ ▐▌▐▛▚▖▐▌▐▌   ▐▌   ▐▌  █    ▐▌ ▐▌▐▌ ▐▌▐▌ ▐▌ █ ▐▌\n"
     "                                              ▐▌   ▐▛▀▜▌▐▛▀▜▌▐▌ ▝▜▌▐▌▝▜▌▐▛▀▀▘▐▌  █    ▐▛▀▘ ▐▌ ▐▌▐▛▀▚▖ █  ▝▀▚▖\n"
-    "                                              ▝▚▄▄▖▐▌ ▐▌▐▌ ▐▌▐▌  ▐▌▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀    ▐▌   ▝▚▄▞▘▐▌ ▐▌ █ ▗▄▄▞▘\n");
+    "                                              ▝▚▄▄▖▐▌ ▐▌▐▌ ▐▌▐▌  ▐▌▝▚▄▞▘▐▙▄▄▖▐▙▄▄▀    ▐▌   ▝▚▄▞▘▐▌ ▐▌ █ ▗▄▄▞▘\n"));
   resetConsoleColor();
 
-  printf("\n\n");
+  printRenderedText("\n\n");
 
   if (cPortID == 'T') {
-    printf("%*cYou have navigated to the port of Tondo!\n", 58, ' ');
+    printRenderedText("%*cYou have navigated to the port of Tondo!\n", getLayoutPaddingSize(58), ' ');
   } else if (cPortID == 'M') {
-    printf("%*cYou have navigated to the port of Manila!\n", 57, ' ');
+    printRenderedText("%*cYou have navigated to the port of Manila!\n", getLayoutPaddingSize(57), ' ');
   } else if (cPortID == 'P') {
-    printf("%*cYou have navigated to the port of Pandakan!\n", 56, ' ');
+    printRenderedText("%*cYou have navigated to the port of Pandakan!\n", getLayoutPaddingSize(56), ' ');
   } else {
-    printf("%*cYou have navigated to the port of Sapa!\n", 58, ' ');
+    printRenderedText("%*cYou have navigated to the port of Sapa!\n", getLayoutPaddingSize(58), ' ');
   }
 
-  printf("\n");
+  printRenderedText("\n");
 
-  printf("%*cDay %2d → Day %2d", 70, ' ', nPlayerTurns, nPlayerTurns + 1);
+  printRenderedText("%*cDay %2d → Day %2d", getLayoutPaddingSize(70), ' ', nPlayerTurns, nPlayerTurns + 1);
 
-  printf("\n\n\n\n\n");
+  printRenderedText("\n\n\n\n\n");
 }
 
 /**
@@ -472,23 +628,39 @@ void printNavigationScreen(char cPortID, int nPlayerTurns) {
  */
 void printGameEndScreen(int nPlayerFinalProfit, int nPlayerProfitTarget, int nPlayerFinalBalance,
                         int nPlayerInitialBalance, int nPlayerFinalTurns) {
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    JsonLine sJsonLine;
+
+    beginScreenJsonLine(&sJsonLine, "end");
+    addJsonIntegerField(&sJsonLine, "profit", nPlayerFinalProfit);
+    addJsonIntegerField(&sJsonLine, "target", nPlayerProfitTarget);
+    addJsonIntegerField(&sJsonLine, "balance", nPlayerFinalBalance);
+    addJsonIntegerField(&sJsonLine, "initial_balance", nPlayerInitialBalance);
+    addJsonIntegerField(&sJsonLine, "turns", nPlayerFinalTurns);
+    addJsonBooleanField(&sJsonLine, "won", nPlayerFinalProfit >= nPlayerProfitTarget);
+    writeJsonLine(&sJsonLine, pScreenStream);
+    fflush(pScreenStream);
+
+    return;
+  }
+
   printSeparator();
 
   int nLeftPaddingSize;
 
   if (nPlayerFinalProfit >= nPlayerProfitTarget) {
     setConsoleColorToYellow();
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                              ██╗   ██╗ ██████╗ ██╗   ██╗    ██╗    ██╗ ██████╗ ███╗   ██╗██╗\n"
       "                                              ╚██╗ ██╔╝██╔═══██╗██║   ██║    ██║    ██║██╔═══██╗████╗  ██║██║\n"
       "                                               ╚████╔╝ ██║   ██║██║   ██║    ██║ █╗ ██║██║   ██║██╔██╗ ██║██║\n"
       "                                                ╚██╔╝  ██║   ██║██║   ██║    ██║███╗██║██║   ██║██║╚██╗██║╚═╝\n"
       "                                                 ██║   ╚██████╔╝╚██████╔╝    ╚███╔███╔╝╚██████╔╝██║ ╚████║██╗\n"
-      "                                                 ╚═╝    ╚═════╝  ╚═════╝      ╚══╝╚══╝  ╚═════╝ ╚═╝  ╚═══╝╚═╝\n");
+      "                                                 ╚═╝    ╚═════╝  ╚═════╝      ╚══╝╚══╝  ╚═════╝ ╚═╝  ╚═══╝╚═╝\n"));
 
-    printf("\n");
+    printRenderedText("\n");
 
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                                                       ___________\n"
       "                                                                      '._==_==_=_.'\n"
       "                                                                      .-\\:      /-.\n"
@@ -498,29 +670,29 @@ void printGameEndScreen(int nPlayerFinalProfit, int nPlayerProfitTarget, int nPl
       "                                                                         '::. .'\n"
       "                                                                           ) (\n"
       "                                                                         _.' '._\n"
-      "                                                                        `\"\"\"\"\"\"\"`\n");
+      "                                                                        `\"\"\"\"\"\"\"`\n"));
     resetConsoleColor();
 
-    printf("\n\n");
+    printRenderedText("\n\n");
 
-    nLeftPaddingSize = 46;
+    nLeftPaddingSize = getLayoutPaddingSize(46);
   } else {
     setConsoleColorToRed();
-    printf(
+    printRenderedText(getLayoutTemplate(
       "                                            ██╗   ██╗ ██████╗ ██╗   ██╗    ██╗      ██████╗ ███████╗████████╗██╗\n"
       "                                            ╚██╗ ██╔╝██╔═══██╗██║   ██║    ██║     ██╔═══██╗██╔════╝╚══██╔══╝██║\n"
       "                                             ╚████╔╝ ██║   ██║██║   ██║    ██║     ██║   ██║███████╗   ██║   ██║\n"
       "                                              ╚██╔╝  ██║   ██║██║   ██║    ██║     ██║   ██║╚════██║   ██║   ╚═╝\n"
       "                                               ██║   ╚██████╔╝╚██████╔╝    ███████╗╚██████╔╝███████║   ██║   ██╗\n"
-      "                                               ╚═╝    ╚═════╝  ╚═════╝     ╚══════╝ ╚═════╝ ╚══════╝   ╚═╝   ╚═╝\n");
+      "                                               ╚═╝    ╚═════╝  ╚═════╝     ╚══════╝ ╚═════╝ ╚══════╝   ╚═╝   ╚═╝\n"));
     resetConsoleColor();
 
-    printf("\n\n");
+    printRenderedText("\n\n");
 
-    nLeftPaddingSize = 44;
+    nLeftPaddingSize = getLayoutPaddingSize(44);
   }
 
-  printf("%*c• Final profit made:", nLeftPaddingSize, ' ');
+  printRenderedText("%*c• Final profit made:", nLeftPaddingSize, ' ');
 
   if (nPlayerFinalProfit >= nPlayerProfitTarget) {
     setConsoleColorToGreen();
@@ -528,10 +700,10 @@ void printGameEndScreen(int nPlayerFinalProfit, int nPlayerProfitTarget, int nPl
     setConsoleColorToRed();
   }
 
-  printf(" %d%% (%d gold coins)\n", nPlayerFinalProfit, nPlayerFinalBalance - nPlayerInitialBalance);
+  printRenderedText(" %d%% (%d gold coins)\n", nPlayerFinalProfit, nPlayerFinalBalance - nPlayerInitialBalance);
   resetConsoleColor();
 
-  printf("%*c• Number of turns (days) exhausted: %d\n", nLeftPaddingSize, ' ', nPlayerFinalTurns);
+  printRenderedText("%*c• Number of turns (days) exhausted: %d\n", nLeftPaddingSize, ' ', nPlayerFinalTurns);
 
-  printf("\n\n\n");
+  printRenderedText("\n\n\n");
 }
@@ -0,0 +1,223 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Expose clock_gettime() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include "ticker.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "engine.h"
+#include "trading.h"
+
+/**
+ * Publishes a snapshot as a market ticker's newest one.
+ * @param[out] pTicker The market ticker, whose mutex must be held.
+ * @param pSnapshot The snapshot.
+ */
+static void publishMarketSnapshot(MarketTicker *pTicker, const MarketSnapshot *pSnapshot) {
+  unsigned long long ullSequence = pTicker->ullSequence;
+
+  // Mark the snapshot as being published before any of its fields change.
+  __atomic_store_n(&pTicker->ullSequence, ullSequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  __atomic_store_n(&pTicker->sSnapshot.cPortId, pSnapshot->cPortId, __ATOMIC_RELAXED);
+  __atomic_store_n(&pTicker->sSnapshot.llTick, pSnapshot->llTick, __ATOMIC_RELAXED);
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    __atomic_store_n(&pTicker->sSnapshot.anMarketPrices[nCargoIndex], pSnapshot->anMarketPrices[nCargoIndex],
+                     __ATOMIC_RELAXED);
+  }
+
+  __atomic_store_n(&pTicker->ullSequence, ullSequence + 2, __ATOMIC_RELEASE);
+}
+
+/**
+ * Moves every market price of the opened port by one tick and publishes them.
+ * @param[out] pTicker The market ticker, whose mutex must be held.
+ */
+static void tickMarketPrices(MarketTicker *pTicker) {
+  // Only the writers change the snapshot, so the mutex's holder can read it directly.
+  MarketSnapshot sSnapshot = pTicker->sSnapshot;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    int nMinimumPrice;
+    int nMaximumPrice;
+
+    getCargoPriceRange(sSnapshot.cPortId, getCargoId(nCargoIndex), &nMinimumPrice, &nMaximumPrice);
+
+    int nStep = (nMaximumPrice - nMinimumPrice) / MARKET_TICKER_STEP_DIVISOR;
+
+    if (nStep < 1) nStep = 1;
+
+    int nPrice =
+      sSnapshot.anMarketPrices[nCargoIndex] + generateSeededRandomPrice(&pTicker->ullRandomState, -nStep, nStep);
+
+    if (nPrice < nMinimumPrice) nPrice = nMinimumPrice;
+
+    if (nPrice > nMaximumPrice) nPrice = nMaximumPrice;
+
+    sSnapshot.anMarketPrices[nCargoIndex] = nPrice;
+  }
+
+  sSnapshot.llTick++;
+
+  publishMarketSnapshot(pTicker, &sSnapshot);
+}
+
+/**
+ * Ticks a market ticker's prices every interval until it is stopped. Opening a port restarts the interval.
+ * @param pArgument The market ticker.
+ * @returns Nothing.
+ */
+static void *runMarketTicker(void *pArgument) {
+  MarketTicker *pTicker = pArgument;
+
+  pthread_mutex_lock(&pTicker->sMutex);
+
+  while (!pTicker->bIsStopping) {
+    struct timespec sDeadline;
+    int nResult = 0;
+
+    clock_gettime(CLOCK_REALTIME, &sDeadline);
+
+    sDeadline.tv_sec += pTicker->nInterval / 1000;
+    sDeadline.tv_nsec += pTicker->nInterval % 1000 * 1000000L;
+
+    if (sDeadline.tv_nsec >= 1000000000L) {
+      sDeadline.tv_sec++;
+      sDeadline.tv_nsec -= 1000000000L;
+    }
+
+    int nOpenedPortAmount = pTicker->nOpenedPortAmount;
+
+    // Wake up early when stopping or when a port is opened, which restarts the interval.
+    while (!pTicker->bIsStopping && nResult != ETIMEDOUT && pTicker->nOpenedPortAmount == nOpenedPortAmount) {
+      nResult = pthread_cond_timedwait(&pTicker->sCondition, &pTicker->sMutex, &sDeadline);
+    }
+
+    if (nResult == ETIMEDOUT && !pTicker->bIsStopping && pTicker->nOpenedPortAmount == nOpenedPortAmount &&
+        nOpenedPortAmount > 0) {
+      tickMarketPrices(pTicker);
+    }
+  }
+
+  pthread_mutex_unlock(&pTicker->sMutex);
+
+  return NULL;
+}
+
+/**
+ * Starts a market ticker's thread, which only ticks after a port has been opened.
+ * @param[out] pTicker The market ticker.
+ * @param nInterval The number of milliseconds between ticks.
+ * @pre @p nInterval must have an integer value within the range of `0` and `60000`.
+ * @param ullSeed The seed of the price movements.
+ * @returns `1` if the thread was started or `0` if it could not be, in which case the prices only tick when
+ * `advanceMarketTicker()` is called.
+ */
+int startMarketTicker(MarketTicker *pTicker, int nInterval, unsigned long long ullSeed) {
+  MarketSnapshot sSnapshot = {0};
+
+  pTicker->ullSequence = 0;
+  pTicker->ullRandomState = seedRandomState(ullSeed);
+  pTicker->nOpenedPortAmount = 0;
+  pTicker->bIsStopping = 0;
+  pTicker->nInterval = nInterval;
+
+  pthread_mutex_init(&pTicker->sMutex, NULL);
+  pthread_cond_init(&pTicker->sCondition, NULL);
+  publishMarketSnapshot(pTicker, &sSnapshot);
+
+  pTicker->bThreadIsStarted = pthread_create(&pTicker->sThread, NULL, runMarketTicker, pTicker) == 0;
+
+  return pTicker->bThreadIsStarted;
+}
+
+/**
+ * Publishes a port's opening market prices, which the ticks then move from. The next tick is a whole interval away.
+ * @param[out] pTicker The market ticker.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param anMarketPrices The port's opening market prices in cargo order.
+ */
+void openMarketTickerPort(MarketTicker *pTicker, char cPortId, const int anMarketPrices[CARGO_AMOUNT]) {
+  MarketSnapshot sSnapshot;
+
+  sSnapshot.cPortId = cPortId;
+  sSnapshot.llTick = 0;
+
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    sSnapshot.anMarketPrices[nCargoIndex] = anMarketPrices[nCargoIndex];
+  }
+
+  pthread_mutex_lock(&pTicker->sMutex);
+  publishMarketSnapshot(pTicker, &sSnapshot);
+
+  pTicker->nOpenedPortAmount++;
+
+  pthread_cond_signal(&pTicker->sCondition);
+  pthread_mutex_unlock(&pTicker->sMutex);
+}
+
+/**
+ * Moves every market price of the opened port by one tick and publishes them.
+ * @param[out] pTicker The market ticker.
+ * @pre A port must have been opened.
+ */
+void advanceMarketTicker(MarketTicker *pTicker) {
+  pthread_mutex_lock(&pTicker->sMutex);
+  tickMarketPrices(pTicker);
+  pthread_mutex_unlock(&pTicker->sMutex);
+}
+
+/**
+ * Reads the newest snapshot of a market ticker without taking any lock. The snapshot is always one that was published
+ * as a whole, even while the ticker's thread is publishing another one.
+ * @param pTicker The market ticker.
+ * @param[out] pSnapshot The snapshot.
+ */
+void readMarketTicker(const MarketTicker *pTicker, MarketSnapshot *pSnapshot) {
+  unsigned long long ullSequence;
+
+  do {
+    ullSequence = __atomic_load_n(&pTicker->ullSequence, __ATOMIC_ACQUIRE);
+
+    pSnapshot->cPortId = __atomic_load_n(&pTicker->sSnapshot.cPortId, __ATOMIC_RELAXED);
+    pSnapshot->llTick = __atomic_load_n(&pTicker->sSnapshot.llTick, __ATOMIC_RELAXED);
+
+    for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+      pSnapshot->anMarketPrices[nCargoIndex] =
+        __atomic_load_n(&pTicker->sSnapshot.anMarketPrices[nCargoIndex], __ATOMIC_RELAXED);
+    }
+
+    // Check the sequence again only after every field has been read, and retry if a publication overlapped them.
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while ((ullSequence & 1) || __atomic_load_n(&pTicker->ullSequence, __ATOMIC_RELAXED) != ullSequence);
+}
+
+/**
+ * Stops a market ticker's thread and waits for it to finish.
+ * @param[out] pTicker The market ticker.
+ */
+void stopMarketTicker(MarketTicker *pTicker) {
+  pthread_mutex_lock(&pTicker->sMutex);
+
+  pTicker->bIsStopping = 1;
+
+  pthread_cond_signal(&pTicker->sCondition);
+  pthread_mutex_unlock(&pTicker->sMutex);
+
+  if (pTicker->bThreadIsStarted) pthread_join(pTicker->sThread, NULL);
+
+  pthread_cond_destroy(&pTicker->sCondition);
+  pthread_mutex_destroy(&pTicker->sMutex);
+}
@@ -12,6 +12,9 @@
 #include "prompts.h"
 #include "text-graphics.h"
 
+static const char acPortIds[PORT_AMOUNT] = {TONDO_PORT_ID, MANILA_PORT_ID, PANDAKAN_PORT_ID, SAPA_PORT_ID};
+static const char acCargoIds[CARGO_AMOUNT] = {COCONUT_CARGO_ID, RICE_CARGO_ID, SILK_CARGO_ID, GUN_CARGO_ID};
+
 /**
  * Generates a random price within the provided maximum and minimum prices.
  * @param nMinimumPrice The minimum allowed price.
@@ -22,6 +25,166 @@ int generateRandomPrice(int nMinimumPrice, int nMaximumPrice) {
   return (rand() % (nMaximumPrice - nMinimumPrice + 1)) + nMinimumPrice;
 }
 
+/**
+ * Gets the minimum and maximum market prices of a cargo in a port.
+ * @param cPortId The port's ID.
+ * @pre @p cPortId must have a character value of `'T'`, `'M'`, `'P'`, or `'S'`.
+ * @param cCargoId The ID of the cargo.
+ * @pre @p cCargoId must have a character value of `'C'`, `'R'`, `'S'`, or `'G'`.
+ * @param[out] nMinimumPrice The minimum market price of the cargo.
+ * @param[out] nMaximumPrice The maximum market price of the cargo.
+ */
+void getCargoPriceRange(char cPortId, char cCargoId, int *nMinimumPrice, int *nMaximumPrice) {
+  switch (cPortId) {
+    case TONDO_PORT_ID: {
+      if (cCargoId == COCONUT_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_TONDO_COCONUT_PRICE;
+        *nMaximumPrice = MAXIMUM_TONDO_COCONUT_PRICE;
+      } else if (cCargoId == RICE_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_TONDO_RICE_PRICE;
+        *nMaximumPrice = MAXIMUM_TONDO_RICE_PRICE;
+      } else if (cCargoId == SILK_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_TONDO_SILK_PRICE;
+        *nMaximumPrice = MAXIMUM_TONDO_SILK_PRICE;
+      } else {
+        *nMinimumPrice = MINIMUM_TONDO_GUN_PRICE;
+        *nMaximumPrice = MAXIMUM_TONDO_GUN_PRICE;
+      }
+
+      break;
+    }
+    case MANILA_PORT_ID: {
+      if (cCargoId == COCONUT_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_MANILA_COCONUT_PRICE;
+        *nMaximumPrice = MAXIMUM_MANILA_COCONUT_PRICE;
+      } else if (cCargoId == RICE_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_MANILA_RICE_PRICE;
+        *nMaximumPrice = MAXIMUM_MANILA_RICE_PRICE;
+      } else if (cCargoId == SILK_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_MANILA_SILK_PRICE;
+        *nMaximumPrice = MAXIMUM_MANILA_SILK_PRICE;
+      } else {
+        *nMinimumPrice = MINIMUM_MANILA_GUN_PRICE;
+        *nMaximumPrice = MAXIMUM_MANILA_GUN_PRICE;
+      }
+
+      break;
+    }
+    case PANDAKAN_PORT_ID: {
+      if (cCargoId == COCONUT_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_PANDAKAN_COCONUT_PRICE;
+        *nMaximumPrice = MAXIMUM_PANDAKAN_COCONUT_PRICE;
+      } else if (cCargoId == RICE_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_PANDAKAN_RICE_PRICE;
+        *nMaximumPrice = MAXIMUM_PANDAKAN_RICE_PRICE;
+      } else if (cCargoId == SILK_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_PANDAKAN_SILK_PRICE;
+        *nMaximumPrice = MAXIMUM_PANDAKAN_SILK_PRICE;
+      } else {
+        *nMinimumPrice = MINIMUM_PANDAKAN_GUN_PRICE;
+        *nMaximumPrice = MAXIMUM_PANDAKAN_GUN_PRICE;
+      }
+
+      break;
+    }
+    // Set to default instead of 'S' to satisfy the compiler
+    default: {
+      if (cCargoId == COCONUT_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_SAPA_COCONUT_PRICE;
+        *nMaximumPrice = MAXIMUM_SAPA_COCONUT_PRICE;
+      } else if (cCargoId == RICE_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_SAPA_RICE_PRICE;
+        *nMaximumPrice = MAXIMUM_SAPA_RICE_PRICE;
+      } else if (cCargoId == SILK_CARGO_ID) {
+        *nMinimumPrice = MINIMUM_SAPA_SILK_PRICE;
+        *nMaximumPrice = MAXIMUM_SAPA_SILK_PRICE;
+      } else {
+        *nMinimumPrice = MINIMUM_SAPA_GUN_PRICE;
+        *nMaximumPrice = MAXIMUM_SAPA_GUN_PRICE;
+      }
+
+      break;
+    }
+  }
+}
+
+/**
+ * Gets the ID of a port from its index, which follows the order of Tondo, Manila, Pandakan, and Sapa.
+ * @param nPortIndex The index of the port.
+ * @pre @p nPortIndex must have an integer value within the range of `0` and `3`.
+ * @returns A character value of `'T'` for Tondo, `'M'` for Manila, `'P'` for Pandakan, or `'S'` for Sapa.
+ */
+char getPortId(int nPortIndex) { return acPortIds[nPortIndex]; }
+
+/**
+ * Gets the index of a port from its ID, which follows the order of Tondo, Manila, Pandakan, and Sapa.
+ * @param cPortId The port's ID.
+ * @returns An integer value within the range of `0` and `3`, or `-1` if the port does not exist.
+ */
+int getPortIndex(char cPortId) {
+  for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+    if (acPortIds[nPortIndex] == cPortId) return nPortIndex;
+  }
+
+  return -1;
+}
+
+/**
+ * Gets the ID of a cargo from its index, which follows the order of coconut, rice, silk, and gun.
+ * @param nCargoIndex The index of the cargo.
+ * @pre @p nCargoIndex must have an integer value within the range of `0` and `3`.
+ * @returns A character value of `'C'` for coconut, `'R'` for rice, `'S'` for silk, or `'G'` for gun.
+ */
+char getCargoId(int nCargoIndex) { return acCargoIds[nCargoIndex]; }
+
+/**
+ * Gets the index of a cargo from its ID, which follows the order of coconut, rice, silk, and gun.
+ * @param cCargoId The ID of the cargo.
+ * @returns An integer value within the range of `0` and `3`, or `-1` if the cargo does not exist.
+ */
+int getCargoIndex(char cCargoId) {
+  for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+    if (acCargoIds[nCargoIndex] == cCargoId) return nCargoIndex;
+  }
+
+  return -1;
+}
+
+/**
+ * Gets the price of upgrading the ship to its next tier.
+ * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @returns The price of the ship upgrade, or `0` if the ship is already in the highest tier.
+ */
+int getShipUpgradeCost(int nShipCurrentCargoLimit) {
+  if (nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
+    return TIER_TWO_SHIP_UPGRADE_COST;
+  } else if (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
+    return TIER_THREE_SHIP_UPGRADE_COST;
+  } else if (nShipCurrentCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT) {
+    return TIER_FOUR_SHIP_UPGRADE_COST;
+  } else {
+    return 0;
+  }
+}
+
+/**
+ * Gets the maximum amount of cargo that the ship can carry after upgrading it to its next tier.
+ * @param nShipCurrentCargoLimit The current maximum amount of cargo that the ship can carry.
+ * @returns The upgraded maximum amount of cargo, or @p nShipCurrentCargoLimit if the ship is already in the highest
+ * tier.
+ */
+int getShipUpgradedCargoLimit(int nShipCurrentCargoLimit) {
+  if (nShipCurrentCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
+    return TIER_TWO_SHIP_CARGO_LIMIT;
+  } else if (nShipCurrentCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT) {
+    return TIER_THREE_SHIP_CARGO_LIMIT;
+  } else if (nShipCurrentCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT) {
+    return TIER_FOUR_SHIP_CARGO_LIMIT;
+  } else {
+    return nShipCurrentCargoLimit;
+  }
+}
+
 /**
  * Subtracts or adds the cargo's cost to the player's balance and cargo to the ship's storage based on the transaction
  * type and prints out the game's transaction screen.
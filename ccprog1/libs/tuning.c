@@ -0,0 +1,240 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "tuning.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bots.h"
+#include "engine.h"
+#include "simulation.h"
+
+/** The games of a tuning round, which threads take from in chunks. */
+typedef struct TuningPool {
+  const TuningCandidate *asCandidates;
+  const PriceTape *pPriceTape;
+  int nFirstGameIndex;
+  int nGameAmount;
+  int nChunkAmount;
+  int nWorkAmount;
+  int nNextWorkIndex;
+  /** The profit sum of every chunk of every candidate, indexed by candidate, then chunk. */
+  double *adWorkProfitSums;
+  pthread_mutex_t sMutex;
+} TuningPool;
+
+/**
+ * Picks a random integer within a range.
+ * @param[out] pullRandomState The generator's state.
+ * @param nRangeStart The smallest allowed integer.
+ * @param nRangeEnd The largest allowed integer.
+ * @returns An integer value within the range of `nRangeStart` and `nRangeEnd`.
+ */
+static int pickRandomInteger(unsigned long long *pullRandomState, int nRangeStart, int nRangeEnd) {
+  return nRangeStart + (int)((generateNextRandomNumber(pullRandomState) >> 32) % (nRangeEnd - nRangeStart + 1));
+}
+
+/**
+ * Compares two candidates for sorting them in descending order of their mean profits.
+ * @param pFirst The first candidate.
+ * @param pSecond The second candidate.
+ * @returns A negative integer if the first is better, a positive integer if it is worse, or `0` if they are equal.
+ */
+static int compareTuningCandidates(const void *pFirst, const void *pSecond) {
+  const TuningCandidate *pFirstCandidate = pFirst;
+  const TuningCandidate *pSecondCandidate = pSecond;
+  double dFirstMeanProfit = pFirstCandidate->dProfitSum / pFirstCandidate->nGameAmount;
+  double dSecondMeanProfit = pSecondCandidate->dProfitSum / pSecondCandidate->nGameAmount;
+
+  return (dFirstMeanProfit < dSecondMeanProfit) - (dFirstMeanProfit > dSecondMeanProfit);
+}
+
+/**
+ * Plays chunks of games from a tuning pool until none are left.
+ * @param pArgument The pool, which must be a `TuningPool`.
+ * @returns `NULL`.
+ */
+static void *runTuningThread(void *pArgument) {
+  TuningPool *pPool = pArgument;
+
+  while (1) {
+    pthread_mutex_lock(&pPool->sMutex);
+
+    int nWorkIndex = pPool->nNextWorkIndex++;
+
+    pthread_mutex_unlock(&pPool->sMutex);
+
+    if (nWorkIndex >= pPool->nWorkAmount) break;
+
+    const TuningCandidate *pCandidate = &pPool->asCandidates[nWorkIndex / pPool->nChunkAmount];
+    int nFirstGameIndex = pPool->nFirstGameIndex + nWorkIndex % pPool->nChunkAmount * TUNING_GAME_CHUNK_SIZE;
+    int nLastGameIndex = nFirstGameIndex + TUNING_GAME_CHUNK_SIZE;
+    GreedyBot sBot;
+    double dProfitSum = 0;
+
+    if (nLastGameIndex > pPool->nFirstGameIndex + pPool->nGameAmount) {
+      nLastGameIndex = pPool->nFirstGameIndex + pPool->nGameAmount;
+    }
+
+    initializeGreedyBot(&sBot, pCandidate->nMinimumMargin, pCandidate->nMinimumUpgradeValue,
+                        pCandidate->nRouteValueWeight);
+
+    for (int nGameIndex = nFirstGameIndex; nGameIndex < nLastGameIndex; nGameIndex++) {
+      GameState sGameState;
+
+      playSimulatedGame(chooseGreedyAction, &sBot, SIMULATED_INITIAL_BALANCE, pPool->pPriceTape, nGameIndex,
+                        NULL, &sGameState);
+
+      dProfitSum += sGameState.nPlayerBalance - sGameState.nPlayerInitialBalance;
+    }
+
+    pPool->adWorkProfitSums[nWorkIndex] = dProfitSum;
+  }
+
+  return NULL;
+}
+
+/**
+ * Makes every candidate play the games from the number it has played up to a new number, splitting the games across
+ * threads.
+ * @param[out] asCandidates The candidates, which must have all played the same number of games.
+ * @param nCandidateAmount The number of candidates.
+ * @param nGameAmount The number of games that every candidate must have played afterward.
+ * @param nThreadAmount The number of threads to play with.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `1` if the round was played or `0` if its work could not be allocated.
+ */
+static int playTuningRound(TuningCandidate asCandidates[], int nCandidateAmount, int nGameAmount, int nThreadAmount,
+                           const PriceTape *pPriceTape) {
+  TuningPool sPool;
+
+  sPool.asCandidates = asCandidates;
+  sPool.pPriceTape = pPriceTape;
+  sPool.nFirstGameIndex = asCandidates[0].nGameAmount;
+  sPool.nGameAmount = nGameAmount - sPool.nFirstGameIndex;
+
+  if (sPool.nGameAmount <= 0) return 1;
+
+  sPool.nChunkAmount = (sPool.nGameAmount + TUNING_GAME_CHUNK_SIZE - 1) / TUNING_GAME_CHUNK_SIZE;
+  sPool.nWorkAmount = nCandidateAmount * sPool.nChunkAmount;
+  sPool.nNextWorkIndex = 0;
+  sPool.adWorkProfitSums = calloc(sPool.nWorkAmount, sizeof(double));
+
+  if (sPool.adWorkProfitSums == NULL) return 0;
+
+  pthread_mutex_init(&sPool.sMutex, NULL);
+
+  pthread_t aThreads[TUNING_MAXIMUM_THREAD_AMOUNT];
+  int abThreadIsStarted[TUNING_MAXIMUM_THREAD_AMOUNT];
+
+  for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    abThreadIsStarted[nThreadIndex] = pthread_create(&aThreads[nThreadIndex], NULL, runTuningThread, &sPool) == 0;
+  }
+
+  // The calling thread works too, and finishes the work of any thread that could not be started.
+  runTuningThread(&sPool);
+
+  for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    if (abThreadIsStarted[nThreadIndex]) pthread_join(aThreads[nThreadIndex], NULL);
+  }
+
+  pthread_mutex_destroy(&sPool.sMutex);
+
+  // Add the chunks in a fixed order so that the sums do not depend on the thread count.
+  for (int nWorkIndex = 0; nWorkIndex < sPool.nWorkAmount; nWorkIndex++) {
+    asCandidates[nWorkIndex / sPool.nChunkAmount].dProfitSum += sPool.adWorkProfitSums[nWorkIndex];
+  }
+
+  for (int nCandidateIndex = 0; nCandidateIndex < nCandidateAmount; nCandidateIndex++) {
+    asCandidates[nCandidateIndex].nGameAmount = nGameAmount;
+  }
+
+  free(sPool.adWorkProfitSums);
+
+  return 1;
+}
+
+/**
+ * Tunes the parameters of the greedy bot with successive halving. Random candidates, along with the default
+ * parameters, play the same games, the better half by mean profit is kept, and the kept candidates play twice as many
+ * games until one is left. The games already played by a candidate are reused in later rounds, and every round's
+ * games are split across a pool of threads in chunks.
+ * @param nCandidateAmount The number of candidates to start with.
+ * @pre @p nCandidateAmount must have an integer value within the range of `1` and `1024`.
+ * @param nInitialGameAmount The number of games that every candidate plays in the first round.
+ * @pre @p nInitialGameAmount must have a positive integer value.
+ * @param nThreadAmount The number of threads to play with.
+ * @pre @p nThreadAmount must have an integer value within the range of `1` and `64`.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @param ullSeed The seed of the random candidates.
+ * @param[out] pHistoryFile The file to write every round's candidates to, or `NULL` to not write them.
+ * @param[out] pBestCandidate The last candidate left.
+ * @returns The number of rounds, or `0` if a round could not be played because memory ran out.
+ */
+int tuneGreedyBot(int nCandidateAmount, int nInitialGameAmount, int nThreadAmount, const PriceTape *pPriceTape,
+                  unsigned long long ullSeed, FILE *pHistoryFile, TuningCandidate *pBestCandidate) {
+  TuningCandidate asCandidates[TUNING_MAXIMUM_CANDIDATE_AMOUNT];
+  unsigned long long ullRandomState = seedRandomState(ullSeed);
+
+  for (int nCandidateIndex = 0; nCandidateIndex < nCandidateAmount; nCandidateIndex++) {
+    TuningCandidate *pCandidate = &asCandidates[nCandidateIndex];
+
+    // Start from the default parameters so that tuning can only keep or beat them.
+    if (nCandidateIndex == 0) {
+      pCandidate->nMinimumMargin = GREEDY_DEFAULT_MINIMUM_MARGIN;
+      pCandidate->nMinimumUpgradeValue = GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE;
+      pCandidate->nRouteValueWeight = GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT;
+    } else {
+      pCandidate->nMinimumMargin =
+        pickRandomInteger(&ullRandomState, TUNING_MINIMUM_MARGIN_RANGE_START, TUNING_MINIMUM_MARGIN_RANGE_END);
+      pCandidate->nMinimumUpgradeValue = pickRandomInteger(&ullRandomState, TUNING_MINIMUM_UPGRADE_VALUE_RANGE_START,
+                                                           TUNING_MINIMUM_UPGRADE_VALUE_RANGE_END);
+      pCandidate->nRouteValueWeight = pickRandomInteger(&ullRandomState, TUNING_ROUTE_VALUE_WEIGHT_RANGE_START,
+                                                        TUNING_ROUTE_VALUE_WEIGHT_RANGE_END);
+    }
+
+    pCandidate->nGameAmount = 0;
+    pCandidate->dProfitSum = 0;
+  }
+
+  if (pHistoryFile != NULL) {
+    fprintf(pHistoryFile, "round,games,minimum margin,minimum upgrade value,route value weight,mean profit\n");
+  }
+
+  int nRoundAmount = 0;
+  int nGameAmount = nInitialGameAmount;
+
+  while (1) {
+    // A price tape cannot give more games than it has, so later rounds only rank the same games again.
+    if (pPriceTape != NULL && nGameAmount > pPriceTape->nGameAmount) nGameAmount = pPriceTape->nGameAmount;
+
+    if (!playTuningRound(asCandidates, nCandidateAmount, nGameAmount, nThreadAmount, pPriceTape)) return 0;
+
+    qsort(asCandidates, nCandidateAmount, sizeof(TuningCandidate), compareTuningCandidates);
+
+    nRoundAmount++;
+
+    for (int nCandidateIndex = 0; pHistoryFile != NULL && nCandidateIndex < nCandidateAmount; nCandidateIndex++) {
+      const TuningCandidate *pCandidate = &asCandidates[nCandidateIndex];
+
+      fprintf(pHistoryFile, "%d,%d,%d,%d,%d,%.1f\n", nRoundAmount, pCandidate->nGameAmount, pCandidate->nMinimumMargin,
+              pCandidate->nMinimumUpgradeValue, pCandidate->nRouteValueWeight,
+              pCandidate->dProfitSum / pCandidate->nGameAmount);
+    }
+
+    if (nCandidateAmount == 1) break;
+
+    nCandidateAmount = (nCandidateAmount + 1) / 2;
+    nGameAmount *= 2;
+  }
+
+  *pBestCandidate = asCandidates[0];
+
+  return nRoundAmount;
+}
@@ -0,0 +1,269 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Description: Measures how fast the game's bots and subsystems run without any player input.
+ * Programmed by: Louis Raphael V. Panaligan
+ */
+
+// Expose clock_gettime() and dup() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bots.h"
+#include "console.h"
+#include "engine.h"
+#include "prompts.h"
+#include "speculation.h"
+#include "text-graphics.h"
+#include "ticker.h"
+
+#define BENCHMARK_GAME_STATE_AMOUNT 8
+#define BENCHMARK_SNAPSHOT_READ_AMOUNT 1000000
+
+/**
+ * Gets the number of seconds elapsed since an arbitrary point in time.
+ * @returns The number of seconds from a monotonic clock.
+ */
+static double getSeconds(void) {
+  struct timespec sTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+  return sTime.tv_sec + sTime.tv_nsec / 1e9;
+}
+
+/**
+ * Measures the expectimax search in nodes per second for every thread count up to a maximum.
+ * @param nDepth The number of voyages to look ahead.
+ * @param nSampleAmount The number of random market prices to sample at every port arrival.
+ * @param nMaximumThreadAmount The largest number of threads to measure.
+ */
+static void benchmarkExpectimax(int nDepth, int nSampleAmount, int nMaximumThreadAmount) {
+  GameState asGameStates[BENCHMARK_GAME_STATE_AMOUNT];
+
+  // Spread the measured states across the game so that the search is not only timed from empty ships.
+  srand(0);
+
+  for (int nStateIndex = 0; nStateIndex < BENCHMARK_GAME_STATE_AMOUNT; nStateIndex++) {
+    initializeGameState(&asGameStates[nStateIndex], 1000 + nStateIndex * 500);
+
+    asGameStates[nStateIndex].cPortId = getPortId(nStateIndex % PORT_AMOUNT);
+    asGameStates[nStateIndex].nPlayerTurns = nStateIndex * 3;
+    asGameStates[nStateIndex].anShipCargoAmounts[nStateIndex % CARGO_AMOUNT] = 10 * nStateIndex;
+
+    generateGameMarketPrices(&asGameStates[nStateIndex]);
+  }
+
+  printf("expectimax: depth %d, %d samples per chance node\n", nDepth, nSampleAmount);
+
+  for (int nThreadAmount = 1; nThreadAmount <= nMaximumThreadAmount; nThreadAmount *= 2) {
+    GameAction aTurnActions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+    int nTurnActionAmount;
+    long long llNodeAmount = 0;
+    double dStartSeconds = getSeconds();
+
+    for (int nStateIndex = 0; nStateIndex < BENCHMARK_GAME_STATE_AMOUNT; nStateIndex++) {
+      llNodeAmount += searchExpectimax(&asGameStates[nStateIndex], nDepth, nSampleAmount, nThreadAmount, aTurnActions,
+                                       &nTurnActionAmount);
+    }
+
+    double dElapsedSeconds = getSeconds() - dStartSeconds;
+
+    printf("  %2d thread(s): %10lld nodes in %8.3f s = %12.0f nodes/s\n", nThreadAmount, llNodeAmount, dElapsedSeconds,
+           llNodeAmount / dElapsedSeconds);
+  }
+}
+
+/**
+ * Prints out the screens of a scripted game, where the player buys and sells a cargo, mistypes a choice once, and
+ * navigates to the next port on every turn.
+ */
+static void printBenchmarkSession(void) {
+  printGameStartScreen();
+
+  for (int nPlayerTurns = 0; nPlayerTurns < MAXIMUM_PLAYER_TURNS; nPlayerTurns++) {
+    char cPortId = getPortId(nPlayerTurns % PORT_AMOUNT);
+    int nPlayerBalance = 1000 + nPlayerTurns * 40;
+    int nPlayerProfit = nPlayerTurns * 4;
+
+    printMainScreen(nPlayerTurns, cPortId, 123, nPlayerBalance, nPlayerProfit, 50, 0, TIER_ONE_SHIP_CARGO_LIMIT, 0, 0,
+                    0, 0, 5, 10, 31, 78);
+    printStyledText(RED_COLOR_ID, "%*cPlease only enter one of the provided character options!\n", 60, ' ');
+    printTransactionScreen(BUY_ACTION_ID, 'C', 10, 5);
+    printMainScreen(nPlayerTurns, cPortId, 123, nPlayerBalance - 50, nPlayerProfit, 50, 10,
+                    TIER_ONE_SHIP_CARGO_LIMIT, 10, 0, 0, 0, 5, 10, 31, 78);
+    printTransactionScreen(SELL_ACTION_ID, 'C', 10, 9);
+    printNavigationScreen(getPortId((nPlayerTurns + 1) % PORT_AMOUNT), nPlayerTurns);
+  }
+
+  printGameEndScreen(120, 50, 2200, 1000, MAXIMUM_PLAYER_TURNS);
+}
+
+/**
+ * Measures the number of bytes and color escape sequences that a scripted game prints, with and without colors.
+ */
+static void benchmarkConsole(void) {
+  printf("console: screens of a %d-turn scripted game\n", MAXIMUM_PLAYER_TURNS);
+
+  for (int bColorsAreEnabled = 1; bColorsAreEnabled >= 0; bColorsAreEnabled--) {
+    FILE *pFile = tmpfile();
+    int nStandardOutput = dup(STDOUT_FILENO);
+
+    if (pFile == NULL || nStandardOutput < 0) {
+      fprintf(stderr, "Could not capture the console's output\n");
+
+      return;
+    }
+
+    long long llStartRequestedAmount;
+    long long llStartPrintedAmount;
+    long long llRequestedAmount;
+    long long llPrintedAmount;
+
+    // Capture everything printed to the standard output in a temporary file to count its bytes.
+    fflush(stdout);
+    dup2(fileno(pFile), STDOUT_FILENO);
+    setConsoleColorsEnabled(bColorsAreEnabled);
+    getConsoleColorChangeAmounts(&llStartRequestedAmount, &llStartPrintedAmount);
+
+    double dStartSeconds = getSeconds();
+
+    printBenchmarkSession();
+    fflush(stdout);
+
+    double dElapsedSeconds = getSeconds() - dStartSeconds;
+
+    getConsoleColorChangeAmounts(&llRequestedAmount, &llPrintedAmount);
+    dup2(nStandardOutput, STDOUT_FILENO);
+    close(nStandardOutput);
+    fseek(pFile, 0, SEEK_END);
+
+    printf("  colors %-3s: %8ld bytes, %4lld of %4lld color changes printed, in %8.3f ms\n",
+           bColorsAreEnabled ? "on" : "off", ftell(pFile), llPrintedAmount - llStartPrintedAmount,
+           llRequestedAmount - llStartRequestedAmount, dElapsedSeconds * 1000);
+
+    fclose(pFile);
+  }
+}
+
+/**
+ * Measures how long the main screen takes to be printed out once the player's input arrives, when it is rendered then
+ * and when it was rendered by the helper thread during the input wait.
+ */
+static void benchmarkSpeculation(void) {
+  FILE *pFile = tmpfile();
+  int nStandardOutput = dup(STDOUT_FILENO);
+
+  if (pFile == NULL || nStandardOutput < 0 || !startSpeculativeRendering()) {
+    fprintf(stderr, "Could not measure the speculative rendering\n");
+
+    return;
+  }
+
+  printf("speculation: main screens of a %d-turn scripted game, printed after the input\n", MAXIMUM_PLAYER_TURNS);
+  fflush(stdout);
+  dup2(fileno(pFile), STDOUT_FILENO);
+  setConsoleColorsEnabled(1);
+
+  double adElapsedSeconds[2] = {0, 0};
+
+  for (int bScreenIsSpeculative = 0; bScreenIsSpeculative <= 1; bScreenIsSpeculative++) {
+    for (int nPlayerTurns = 0; nPlayerTurns < MAXIMUM_PLAYER_TURNS; nPlayerTurns++) {
+      char cPortId = getPortId(nPlayerTurns % PORT_AMOUNT);
+      int nPlayerBalance = 1000 + nPlayerTurns * 40;
+
+      // The player's input is only awaited if the screen is rendered ahead of time, which is not measured.
+      if (bScreenIsSpeculative) {
+        requestSpeculativeMainScreen(nPlayerTurns, cPortId, 123, nPlayerBalance, nPlayerTurns * 4, 50, 0,
+                                     TIER_ONE_SHIP_CARGO_LIMIT, 0, 0, 0, 0, 5, 10, 31, 78);
+        waitForSpeculativeScreens();
+      }
+
+      double dStartSeconds = getSeconds();
+
+      printMainScreen(nPlayerTurns, cPortId, 123, nPlayerBalance, nPlayerTurns * 4, 50, 0, TIER_ONE_SHIP_CARGO_LIMIT,
+                      0, 0, 0, 0, 5, 10, 31, 78);
+      fflush(stdout);
+
+      adElapsedSeconds[bScreenIsSpeculative] += getSeconds() - dStartSeconds;
+    }
+  }
+
+  long long llRenderedAmount;
+  long long llPrintedAmount;
+
+  stopSpeculativeRendering();
+  getSpeculativeScreenAmounts(&llRenderedAmount, &llPrintedAmount);
+  dup2(nStandardOutput, STDOUT_FILENO);
+  close(nStandardOutput);
+  fclose(pFile);
+
+  printf("  rendered after input: %8.1f us per screen\n", adElapsedSeconds[0] * 1e6 / MAXIMUM_PLAYER_TURNS);
+  printf("  rendered during wait: %8.1f us per screen (%lld of %lld frames printed)\n",
+         adElapsedSeconds[1] * 1e6 / MAXIMUM_PLAYER_TURNS, llPrintedAmount, llRenderedAmount);
+}
+
+/**
+ * Measures how long reading a snapshot of the live market takes while the ticker's thread publishes new ones nonstop,
+ * which is far more often than a real game ever ticks.
+ */
+static void benchmarkTicker(void) {
+  static MarketTicker sTicker;
+  const int anOpeningPrices[CARGO_AMOUNT] = {MINIMUM_SAPA_COCONUT_PRICE, MINIMUM_SAPA_RICE_PRICE,
+                                             MINIMUM_SAPA_SILK_PRICE, MINIMUM_SAPA_GUN_PRICE};
+
+  if (!startMarketTicker(&sTicker, 0, 1)) {
+    fprintf(stderr, "Could not measure the market ticker\n");
+
+    return;
+  }
+
+  openMarketTickerPort(&sTicker, 'S', anOpeningPrices);
+
+  MarketSnapshot sSnapshot;
+  long long llPriceSum = 0;
+  double dStartSeconds = getSeconds();
+
+  for (int nReadIndex = 0; nReadIndex < BENCHMARK_SNAPSHOT_READ_AMOUNT; nReadIndex++) {
+    readMarketTicker(&sTicker, &sSnapshot);
+
+    llPriceSum += sSnapshot.anMarketPrices[nReadIndex % CARGO_AMOUNT];
+  }
+
+  double dElapsedSeconds = getSeconds() - dStartSeconds;
+
+  stopMarketTicker(&sTicker);
+
+  printf("ticker: %d snapshot reads while the prices tick nonstop\n", BENCHMARK_SNAPSHOT_READ_AMOUNT);
+  printf("  %8.1f ns per read, %lld ticks published (average price %.1f)\n",
+         dElapsedSeconds * 1e9 / BENCHMARK_SNAPSHOT_READ_AMOUNT, sSnapshot.llTick,
+         (double)llPriceSum / BENCHMARK_SNAPSHOT_READ_AMOUNT);
+}
+
+int main(int argc, char *argv[]) {
+  int nDepth = argc > 1 ? atoi(argv[1]) : EXPECTIMAX_DEFAULT_DEPTH;
+  int nSampleAmount = argc > 2 ? atoi(argv[2]) : EXPECTIMAX_DEFAULT_SAMPLE_AMOUNT;
+  int nMaximumThreadAmount = argc > 3 ? atoi(argv[3]) : 8;
+
+  if (nDepth < 1 || nSampleAmount < 1 || nMaximumThreadAmount < 1) {
+    fprintf(stderr, "Usage: %s [depth] [samples] [maximum threads]\n", argv[0]);
+
+    return 1;
+  }
+
+  benchmarkConsole();
+  benchmarkSpeculation();
+  benchmarkTicker();
+  benchmarkExpectimax(nDepth, nSampleAmount, nMaximumThreadAmount);
+
+  return 0;
+}
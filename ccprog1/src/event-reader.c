@@ -0,0 +1,135 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Description: Streams the events of an event log back out, one line per event, or summarizes them.
+ * Programmed by: Louis Raphael V. Panaligan
+ */
+
+// Expose clock_gettime() from the POSIX standard.
+#define _POSIX_C_SOURCE 199309L
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "events.h"
+
+#define OUTPUT_BUFFER_SIZE (1 << 16)
+
+/**
+ * Gets the number of seconds elapsed since an arbitrary point in time.
+ * @returns The number of seconds from a monotonic clock.
+ */
+static double getSeconds(void) {
+  struct timespec sTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+  return sTime.tv_sec + sTime.tv_nsec / 1e9;
+}
+
+/**
+ * Prints out an event as a single line.
+ * @param pGameEvent The event.
+ */
+static void printGameEvent(const GameEvent *pGameEvent) {
+  printf("%2d %c %c", pGameEvent->nPlayerTurns, pGameEvent->cPortId, pGameEvent->cEventId);
+
+  switch (pGameEvent->cEventId) {
+    case GAME_START_EVENT_ID: {
+      printf(" seed %llu (%c), player %d, balance %d, target %d%%\n", pGameEvent->ullSeed, pGameEvent->cPriceSourceId,
+             pGameEvent->nPlayerId, pGameEvent->nPlayerBalance, pGameEvent->nPlayerProfitTarget);
+
+      break;
+    }
+    case MARKET_EVENT_ID: {
+      printf(" prices %d %d %d %d\n", pGameEvent->anMarketPrices[0], pGameEvent->anMarketPrices[1],
+             pGameEvent->anMarketPrices[2], pGameEvent->anMarketPrices[3]);
+
+      break;
+    }
+    case TRADE_EVENT_ID: {
+      printf(" %c %d %c at %d\n", pGameEvent->cActionId, pGameEvent->nCargoAmount, pGameEvent->cCargoId,
+             pGameEvent->nCargoPrice);
+
+      break;
+    }
+    case UPGRADE_EVENT_ID: {
+      printf(" cargo limit %d for %d\n", pGameEvent->nShipCargoLimit, pGameEvent->nShipUpgradeCost);
+
+      break;
+    }
+    case GAME_END_EVENT_ID: {
+      printf(" balance %d, state %08X\n", pGameEvent->nPlayerBalance, pGameEvent->unStateHash);
+
+      break;
+    }
+    // Set to default instead of 'V' to satisfy the compiler
+    default: {
+      printf(" state %08X\n", pGameEvent->unStateHash);
+
+      break;
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  int bIsSummarizing = argc == 3 && strcmp(argv[2], "--summary") == 0;
+
+  if (argc != 2 && !bIsSummarizing) {
+    fprintf(stderr, "Usage: %s <event log file> [--summary]\n", argv[0]);
+
+    return 1;
+  }
+
+  static char acOutputBuffer[OUTPUT_BUFFER_SIZE];
+  EventLogReader sReader;
+
+  if (!openEventLogReader(&sReader, argv[1])) {
+    fprintf(stderr, "Could not open the event log %s\n", argv[1]);
+
+    return 1;
+  }
+
+  setvbuf(stdout, acOutputBuffer, _IOFBF, sizeof(acOutputBuffer));
+
+  GameEvent sGameEvent;
+  long long allEventAmounts[UCHAR_MAX + 1] = {0};
+  double dStartSeconds = getSeconds();
+  int nReadStatus;
+
+  while ((nReadStatus = readGameEvent(&sReader, &sGameEvent)) == 1) {
+    allEventAmounts[(unsigned char)sGameEvent.cEventId]++;
+
+    if (!bIsSummarizing) printGameEvent(&sGameEvent);
+  }
+
+  double dElapsedSeconds = getSeconds() - dStartSeconds;
+  long long llEventAmount = sReader.llEventAmount;
+
+  closeEventLogReader(&sReader);
+
+  if (bIsSummarizing) {
+    printf("%lld games, %lld markets, %lld trades, %lld upgrades, %lld voyages\n",
+           allEventAmounts[GAME_START_EVENT_ID], allEventAmounts[MARKET_EVENT_ID], allEventAmounts[TRADE_EVENT_ID],
+           allEventAmounts[UPGRADE_EVENT_ID], allEventAmounts[VOYAGE_EVENT_ID]);
+    printf("read %lld events in %.3f s = %.0f events/s\n", llEventAmount, dElapsedSeconds,
+           llEventAmount / dElapsedSeconds);
+  }
+
+  fflush(stdout);
+
+  if (nReadStatus < 0) {
+    fprintf(stderr, "The event log is corrupted after %lld events\n", llEventAmount);
+
+    return 1;
+  }
+
+  return 0;
+}
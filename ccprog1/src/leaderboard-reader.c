@@ -0,0 +1,50 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Description: Prints the merchants with the best profits on a leaderboard as comma-separated values.
+ * Programmed by: Louis Raphael V. Panaligan
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "leaderboard.h"
+
+#define DEFAULT_TOP_AMOUNT 10
+
+int main(int argc, char *argv[]) {
+  int nTopAmount = argc == 3 ? atoi(argv[2]) : DEFAULT_TOP_AMOUNT;
+
+  if (argc < 2 || argc > 3 || nTopAmount < 1 || nTopAmount > LEADERBOARD_MAXIMUM_TOP_AMOUNT) {
+    fprintf(stderr, "Usage: %s <leaderboard file> [amount (1 - %d)]\n", argv[0], LEADERBOARD_MAXIMUM_TOP_AMOUNT);
+
+    return 1;
+  }
+
+  static Leaderboard sLeaderboard;
+
+  if (!openLeaderboard(&sLeaderboard, argv[1], nTopAmount)) {
+    fprintf(stderr, "Could not open the leaderboard %s\n", argv[1]);
+
+    return 1;
+  }
+
+  LeaderboardEntry asEntries[LEADERBOARD_MAXIMUM_TOP_AMOUNT];
+  int nEntryAmount = getLeaderboardTop(&sLeaderboard, asEntries);
+
+  printf("rank,merchant,best_profit,games,turns\n");
+
+  for (int nEntryIndex = 0; nEntryIndex < nEntryAmount; nEntryIndex++) {
+    printf("%d,%d,%d,%d,%lld\n", nEntryIndex + 1, asEntries[nEntryIndex].nPlayerId, asEntries[nEntryIndex].nBestProfit,
+           asEntries[nEntryIndex].nGameAmount, asEntries[nEntryIndex].llTotalTurns);
+  }
+
+  closeLeaderboard(&sLeaderboard);
+
+  return 0;
+}
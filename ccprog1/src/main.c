@@ -37,19 +37,34 @@
  *  - https://www.theurbanpenguin.com/4184-2/
  */
 
+// Expose dup() and fdopen() from the POSIX standard.
+#define _POSIX_C_SOURCE 200112L
+
 #include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "console.h"
+#include "events.h"
+#include "leaderboard.h"
+#include "ledger.h"
 #include "prompts.h"
+#include "rendering.h"
+#include "recording.h"
+#include "replay.h"
+#include "scripts.h"
+#include "shared-market.h"
+#include "simulation.h"
+#include "spectators.h"
+#include "speculation.h"
 #include "text-graphics.h"
+#include "ticker.h"
 #include "trading.h"
 
-#define MAXIMUM_PLAYER_TURNS 30
-
-int main(void) {
+int main(int argc, char *argv[]) {
   // Declare all player and ship properties and set their default and initial values.
   int nPlayerId;
   int nPlayerInitialBalance;
@@ -64,32 +79,330 @@ int main(void) {
   int nShipSilkCargoAmount = 0;
   int nShipGunCargoAmount = 0;
 
-  // Seed the pseudorandom number generation.
-  srand(time(NULL));
+  // Record every trade, upgrade, and voyage if an event log file is given, or replay one instead of playing.
+  const char *strEventLogFilePath = NULL;
+  const char *strReplayFilePath = NULL;
+  const char *strPriceTapeFilePath = NULL;
+  // Or run a script against the engine for a number of games instead of prompting the player.
+  const char *strScriptFilePath = NULL;
+  int nScriptGameAmount = 1;
+  char cScreenFormatId = ART_SCREEN_FORMAT_ID;
+  int bRawInputIsRequested = 0;
+  // Or let the market prices move while the player is in a port.
+  int bMarketIsLive = 0;
+  // Let spectators watch the game from other processes.
+  const char *strBroadcastName = NULL;
+  // Record the game for anyone to play back later.
+  const char *strRecordingFilePath = NULL;
+  // Keep every merchant's results in a file that other games update too.
+  const char *strLeaderboardFilePath = NULL;
+  // Or trade in a market that the other games on this machine trade in too.
+  const char *strSharedMarketName = NULL;
+
+  for (int nArgumentIndex = 1; nArgumentIndex < argc; nArgumentIndex++) {
+    if (strcmp(argv[nArgumentIndex], "--event-log") == 0 && nArgumentIndex + 1 < argc) {
+      strEventLogFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--replay") == 0 && nArgumentIndex + 1 < argc) {
+      strReplayFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--price-tape") == 0 && nArgumentIndex + 1 < argc) {
+      strPriceTapeFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--script") == 0 && nArgumentIndex + 1 < argc) {
+      strScriptFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--games") == 0 && nArgumentIndex + 1 < argc &&
+               atoi(argv[nArgumentIndex + 1]) > 0) {
+      nScriptGameAmount = atoi(argv[++nArgumentIndex]);
+    } else if (strcmp(argv[nArgumentIndex], "--format=jsonl") == 0) {
+      cScreenFormatId = JSONL_SCREEN_FORMAT_ID;
+    } else if (strcmp(argv[nArgumentIndex], "--format=art") == 0) {
+      cScreenFormatId = ART_SCREEN_FORMAT_ID;
+    } else if (strcmp(argv[nArgumentIndex], "--raw-input") == 0) {
+      bRawInputIsRequested = 1;
+    } else if (strcmp(argv[nArgumentIndex], "--live-market") == 0 && strSharedMarketName == NULL) {
+      bMarketIsLive = 1;
+    } else if (strcmp(argv[nArgumentIndex], "--broadcast") == 0 && nArgumentIndex + 1 < argc) {
+      strBroadcastName = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--record") == 0 && nArgumentIndex + 1 < argc) {
+      strRecordingFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--leaderboard") == 0 && nArgumentIndex + 1 < argc) {
+      strLeaderboardFilePath = argv[++nArgumentIndex];
+    } else if (strcmp(argv[nArgumentIndex], "--shared-market") == 0 && nArgumentIndex + 1 < argc && !bMarketIsLive) {
+      strSharedMarketName = argv[++nArgumentIndex];
+    } else {
+      fprintf(stderr, "Usage: %s [--format=art | --format=jsonl] [--raw-input] "
+                      "[--live-market | --shared-market <name>] [--broadcast <name>] [--record <file>] "
+                      "[--leaderboard <file>] [--event-log <file>] [--replay <file> [--price-tape <file>] | "
+                      "--script <file> [--games <amount>] [--price-tape <file>]]\n",
+              argv[0]);
+
+      return 1;
+    }
+  }
+
+  if (strReplayFilePath != NULL) {
+    EventLogReader sEventLogReader;
+    PriceTape sPriceTape;
+
+    if (!openEventLogReader(&sEventLogReader, strReplayFilePath)) {
+      fprintf(stderr, "Could not open the event log %s\n", strReplayFilePath);
+
+      return 1;
+    }
+
+    if (strPriceTapeFilePath != NULL && !openPriceTape(strPriceTapeFilePath, &sPriceTape)) {
+      fprintf(stderr, "Could not open the price tape %s\n", strPriceTapeFilePath);
+      closeEventLogReader(&sEventLogReader);
+
+      return 1;
+    }
+
+    // Replay without rendering anything, and only print out the result.
+    ReplayResult sReplayResult;
+    clock_t sStartTime = clock();
+    int bIsReplayed =
+      replayEventLog(&sEventLogReader, strPriceTapeFilePath != NULL ? &sPriceTape : NULL, &sReplayResult);
+    double dSeconds = (double)(clock() - sStartTime) / CLOCKS_PER_SEC;
+
+    closeEventLogReader(&sEventLogReader);
+
+    if (strPriceTapeFilePath != NULL) closePriceTape(&sPriceTape);
+
+    printf("Replayed %lld games, %lld turns, and %lld events in %.3f s (%.0f events/s)\n", sReplayResult.llGameAmount,
+           sReplayResult.llTurnAmount, sReplayResult.llEventAmount, dSeconds,
+           dSeconds > 0 ? sReplayResult.llEventAmount / dSeconds : 0.0);
+
+    if (!bIsReplayed) {
+      fprintf(stderr, "The event log %s is corrupted\n", strReplayFilePath);
+
+      return 1;
+    }
+
+    if (sReplayResult.cDivergenceId == 0) {
+      printf("No divergence found\n");
+
+      return 0;
+    }
+
+    const GameEvent *pDivergentEvent = &sReplayResult.sDivergentEvent;
+    const GameState *pDivergentGameState = &sReplayResult.sDivergentGameState;
+
+    printf("Diverged in game %lld at event %lld ('%c' event on turn %d in port '%c'): ",
+           sReplayResult.llDivergentGameIndex + 1, sReplayResult.llEventAmount, pDivergentEvent->cEventId,
+           pDivergentEvent->nPlayerTurns + 1, pDivergentEvent->cPortId);
+
+    switch (sReplayResult.cDivergenceId) {
+      case MARKET_DIVERGENCE_ID: {
+        printf("the market prices differ\n");
+
+        break;
+      }
+      case ACTION_DIVERGENCE_ID: {
+        printf("the action is not allowed\n");
+
+        break;
+      }
+      case BALANCE_DIVERGENCE_ID: {
+        printf("the final balance is %d instead of %d\n", pDivergentGameState->nPlayerBalance,
+               pDivergentEvent->nPlayerBalance);
+
+        break;
+      }
+      case STATE_DIVERGENCE_ID: {
+        printf("the state hash is %08X instead of %08X\n", sReplayResult.unDivergentStateHash,
+               pDivergentEvent->unStateHash);
+
+        break;
+      }
+      // Set to default instead of 'T' to satisfy the compiler
+      default: {
+        printf("the game's price tape is missing or too short\n");
+
+        break;
+      }
+    }
+
+    return 1;
+  }
+
+  if (strScriptFilePath != NULL) {
+    static Script sScript;
+    ScriptRunner sScriptRunner;
+    PriceTape sPriceTape;
+    int nErrorLineNumber;
+
+    if (!compileScriptFile(strScriptFilePath, &sScript, &nErrorLineNumber)) {
+      if (nErrorLineNumber == 0) {
+        fprintf(stderr, "Could not read the script %s\n", strScriptFilePath);
+      } else {
+        fprintf(stderr, "Could not compile the script %s at line %d\n", strScriptFilePath, nErrorLineNumber);
+      }
+
+      return 1;
+    }
+
+    if (strPriceTapeFilePath != NULL) {
+      if (!openPriceTape(strPriceTapeFilePath, &sPriceTape)) {
+        fprintf(stderr, "Could not open the price tape %s\n", strPriceTapeFilePath);
+
+        return 1;
+      }
+
+      if (nScriptGameAmount > sPriceTape.nGameAmount) nScriptGameAmount = sPriceTape.nGameAmount;
+    }
+
+    // Play every game without rendering anything, and only print out the totals.
+    long long llTurnAmount = 0;
+    double dProfitSum = 0;
+    clock_t sStartTime = clock();
+
+    initializeScriptRunner(&sScriptRunner, &sScript);
+
+    for (int nGameIndex = 0; nGameIndex < nScriptGameAmount; nGameIndex++) {
+      GameState sGameState;
+
+      restartScriptRunner(&sScriptRunner);
+      playSimulatedGame(chooseScriptAction, &sScriptRunner, SIMULATED_INITIAL_BALANCE,
+                        strPriceTapeFilePath != NULL ? &sPriceTape : NULL, nGameIndex, NULL, &sGameState);
+
+      llTurnAmount += sGameState.nPlayerTurns;
+      dProfitSum += sGameState.nPlayerBalance - sGameState.nPlayerInitialBalance;
+    }
+
+    double dSeconds = (double)(clock() - sStartTime) / CLOCKS_PER_SEC;
+
+    if (strPriceTapeFilePath != NULL) closePriceTape(&sPriceTape);
+
+    printf("Ran %d games, %lld turns, and %lld actions (%lld rejected) in %.3f s (%.0f games/s)\n", nScriptGameAmount,
+           llTurnAmount, sScriptRunner.llActionAmount, sScriptRunner.llRejectedActionAmount, dSeconds,
+           dSeconds > 0 ? nScriptGameAmount / dSeconds : 0.0);
+    printf("Average profit: %.2f gold coins\n", dProfitSum / nScriptGameAmount);
+
+    return 0;
+  }
+
+  // Print only the screens' JSON lines to the standard output, and silence the prompts and everything else printed.
+  if (cScreenFormatId == JSONL_SCREEN_FORMAT_ID) {
+    FILE *pScreenStream = fdopen(dup(STDOUT_FILENO), "w");
+
+    if (pScreenStream == NULL || freopen("/dev/null", "w", stdout) == NULL) {
+      fprintf(stderr, "Could not print the screens as JSON lines\n");
+
+      return 1;
+    }
+
+    // Every screen is followed by a prompt, so a line must be sent out before the game waits for the player's input.
+    setvbuf(pScreenStream, NULL, _IOLBF, BUFSIZ);
+    setScreenFormat(JSONL_SCREEN_FORMAT_ID, pScreenStream);
+  }
+
+  // Menus react to a single keystroke if asked to and if the player is typing into a terminal.
+  setRawInputEnabled(bRawInputIsRequested);
+
+  // Render the screens that the player is likely to see next while they choose, unless only JSON lines are printed.
+  if (cScreenFormatId == ART_SCREEN_FORMAT_ID) startSpeculativeRendering();
+
+  // Hand the spectators every screen and prompt right before the game waits for the player's input.
+  if (strBroadcastName != NULL &&
+      (cScreenFormatId != ART_SCREEN_FORMAT_ID || !startSpectatorBroadcast(strBroadcastName))) {
+    fprintf(stderr, "Could not broadcast the game as %s\n", strBroadcastName);
+
+    return 1;
+  }
+
+  // Record every screen and prompt as it is printed, with the file written by a background thread.
+  if (strRecordingFilePath != NULL &&
+      (cScreenFormatId != ART_SCREEN_FORMAT_ID || !startSessionRecording(strRecordingFilePath))) {
+    fprintf(stderr, "Could not record the game to %s\n", strRecordingFilePath);
+
+    return 1;
+  }
+
+  // Map the leaderboard before the game starts, so that a bad file is reported before anything is played.
+  static Leaderboard sLeaderboard;
+
+  if (strLeaderboardFilePath != NULL && !openLeaderboard(&sLeaderboard, strLeaderboardFilePath, 1)) {
+    fprintf(stderr, "Could not open the leaderboard %s\n", strLeaderboardFilePath);
+
+    return 1;
+  }
+
+  // Trade in the shared market instead of only seeing its prices.
+  SharedMarket *pSharedMarket = strSharedMarketName != NULL ? attachSharedMarket(strSharedMarketName) : NULL;
+
+  if (strSharedMarketName != NULL && pSharedMarket == NULL) {
+    fprintf(stderr, "Could not share the market as %s\n", strSharedMarketName);
+
+    return 1;
+  }
 
-  printf("\n");
+  // Hand the events to a ledger, whose writer thread keeps the file's I/O off the game, and sync after the game ends.
+  // Open it after everything else that can fail, so that no error leaves its writer thread running.
+  static Ledger sLedger;
+  int bIsLoggingEvents = 0;
+
+  if (strEventLogFilePath != NULL) {
+    bIsLoggingEvents =
+      openLedger(&sLedger, strEventLogFilePath, LEDGER_DEFAULT_CAPACITY, WAIT_FULL_POLICY_ID, GAME_SYNC_POLICY_ID);
+
+    if (!bIsLoggingEvents) {
+      fprintf(stderr, "Could not open the event log %s\n", strEventLogFilePath);
+
+      return 1;
+    }
+  }
+
+  // Seed the pseudorandom number generation, and keep the seed so that it can be recorded.
+  unsigned int unSeed = time(NULL);
+
+  srand(unSeed);
+
+  // Tick the market prices on a background thread, which the game reads without ever waiting for it.
+  static MarketTicker sMarketTicker;
+
+  if (bMarketIsLive) startMarketTicker(&sMarketTicker, MARKET_TICKER_DEFAULT_INTERVAL, unSeed);
+
+  printRenderedText("\n");
 
   // Print out the GPL-3 license notice for terminal interactions.
-  printf("Tides of Manila: A Merchant's Quest  Copyright (C) 2024  Louis Raphael V. Panaligan\n");
-  printf("This program comes with ABSOLUTELY NO WARRANTY.\n");
-  printf("This is free software, and you are welcome to redistribute it under certain conditions.\n");
+  printRenderedText("Tides of Manila: A Merchant's Quest  Copyright (C) 2024  Louis Raphael V. Panaligan\n");
+  printRenderedText("This program comes with ABSOLUTELY NO WARRANTY.\n");
+  printRenderedText("This is free software, and you are welcome to redistribute it under certain conditions.\n");
 
   printGameStartScreen();
 
   nPlayerId = promptForPlayerId();
 
-  printf("\n");
+  if (!hasQueuedInput()) printRenderedText("\n");
 
   nPlayerInitialBalance = promptForInitialBalance();
   nPlayerBalance = nPlayerInitialBalance;
 
-  printf("\n");
+  if (!hasQueuedInput()) printRenderedText("\n");
 
   nPlayerProfitTarget = promptForProfitTarget();
 
+  // Mirror the player's and ship's properties in a game state to hash them at the end of every turn.
+  GameEvent sGameEvent = {0};
+  GameState sGameState = {0};
+
+  if (bIsLoggingEvents) {
+    sGameState.nPlayerInitialBalance = nPlayerInitialBalance;
+
+    sGameEvent.cEventId = GAME_START_EVENT_ID;
+    sGameEvent.ullSeed = unSeed;
+    sGameEvent.cPriceSourceId = bMarketIsLive || pSharedMarket != NULL ? LIVE_PRICE_SOURCE_ID : RAND_PRICE_SOURCE_ID;
+    sGameEvent.nPlayerId = nPlayerId;
+    sGameEvent.nPlayerBalance = nPlayerInitialBalance;
+    sGameEvent.nPlayerProfitTarget = nPlayerProfitTarget;
+
+    pushLedgerEvent(&sLedger, &sGameEvent);
+  }
+
   // Allow the player to quit before exhausting all of their turns.
   int bPlayerIsQuitting = 0;
 
+  // Keep the market prices in cargo order for the recorded events.
+  int anMarketPrices[CARGO_AMOUNT] = {0};
+
   while (nPlayerTurns < MAXIMUM_PLAYER_TURNS && !bPlayerIsQuitting) {
     // Declare and set the market prices at the start of every turn.
     int nCoconutMarketPrice;
@@ -132,26 +445,112 @@ int main(void) {
       }
     }
 
+    anMarketPrices[0] = nCoconutMarketPrice;
+    anMarketPrices[1] = nRiceMarketPrice;
+    anMarketPrices[2] = nSilkMarketPrice;
+    anMarketPrices[3] = nGunMarketPrice;
+
+    // Open the live market at the generated prices, which then move from there.
+    if (bMarketIsLive) openMarketTickerPort(&sMarketTicker, cCurrentPortId, anMarketPrices);
+
+    // Or trade at the shared market's prices if another merchant already sailed into the port.
+    if (pSharedMarket != NULL) {
+      openSharedMarketPort(pSharedMarket, cCurrentPortId, anMarketPrices);
+
+      nCoconutMarketPrice = anMarketPrices[0];
+      nRiceMarketPrice = anMarketPrices[1];
+      nSilkMarketPrice = anMarketPrices[2];
+      nGunMarketPrice = anMarketPrices[3];
+    }
+
+    if (bIsLoggingEvents) {
+      sGameEvent.cEventId = MARKET_EVENT_ID;
+
+      memcpy(sGameEvent.anMarketPrices, anMarketPrices, sizeof(anMarketPrices));
+      pushLedgerEvent(&sLedger, &sGameEvent);
+    }
+
     // Loop back into the main menu screen after exiting other screens unless the player quits.
     int bPlayerIsNavigating = 0;
 
     while (!bPlayerIsNavigating && !bPlayerIsQuitting) {
+      // Show the newest live or shared market prices, which every prompt and trade uses until the main screen is
+      // printed again.
+      if ((bMarketIsLive || pSharedMarket != NULL) && !hasQueuedInput()) {
+        int anNewestMarketPrices[CARGO_AMOUNT];
+
+        if (pSharedMarket != NULL) {
+          int anStockAmounts[CARGO_AMOUNT];
+
+          // Keep the last prices while the port's market cannot be read.
+          memcpy(anNewestMarketPrices, anMarketPrices, sizeof(anNewestMarketPrices));
+          readSharedMarketPort(pSharedMarket, cCurrentPortId, anNewestMarketPrices, anStockAmounts);
+        } else {
+          MarketSnapshot sMarketSnapshot;
+
+          readMarketTicker(&sMarketTicker, &sMarketSnapshot);
+          memcpy(anNewestMarketPrices, sMarketSnapshot.anMarketPrices, sizeof(anNewestMarketPrices));
+        }
+
+        if (memcmp(anNewestMarketPrices, anMarketPrices, sizeof(anMarketPrices)) != 0) {
+          memcpy(anMarketPrices, anNewestMarketPrices, sizeof(anMarketPrices));
+
+          nCoconutMarketPrice = anMarketPrices[0];
+          nRiceMarketPrice = anMarketPrices[1];
+          nSilkMarketPrice = anMarketPrices[2];
+          nGunMarketPrice = anMarketPrices[3];
+
+          if (bIsLoggingEvents) {
+            sGameEvent.cEventId = MARKET_EVENT_ID;
+
+            memcpy(sGameEvent.anMarketPrices, anMarketPrices, sizeof(anMarketPrices));
+            pushLedgerEvent(&sLedger, &sGameEvent);
+          }
+        }
+      }
+
       nPlayerProfit = nPlayerProfitTarget * (nPlayerBalance - nPlayerInitialBalance) / 100;
 
       int nShipTotalCargoAmount =
         nShipCoconutCargoAmount + nShipRiceCargoAmount + nShipSilkCargoAmount + nShipGunCargoAmount;
 
-      printMainScreen(nPlayerTurns, cCurrentPortId, nPlayerId, nPlayerBalance, nPlayerProfit, nPlayerProfitTarget,
-                      nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount, nShipRiceCargoAmount,
-                      nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice,
-                      nSilkMarketPrice, nGunMarketPrice);
+      // Skip the screens between the prompts of a command that was typed ahead on a single line.
+      if (!hasQueuedInput()) {
+        printMainScreen(nPlayerTurns, cCurrentPortId, nPlayerId, nPlayerBalance, nPlayerProfit, nPlayerProfitTarget,
+                        nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount, nShipRiceCargoAmount,
+                        nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice,
+                        nSilkMarketPrice, nGunMarketPrice);
+      }
+
+      // Render the screens that every action leads to while the player is choosing one.
+      requestSpeculativeMainScreen(nPlayerTurns, cCurrentPortId, nPlayerId, nPlayerBalance, nPlayerProfit,
+                                   nPlayerProfitTarget, nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount,
+                                   nShipRiceCargoAmount, nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice,
+                                   nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice);
+
+      for (int nPortIndex = 0; nPortIndex < PORT_AMOUNT; nPortIndex++) {
+        if (getPortId(nPortIndex) != cCurrentPortId) {
+          requestSpeculativeNavigationScreen(getPortId(nPortIndex), nPlayerTurns);
+        }
+      }
+
+      if (nShipCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT && nPlayerBalance >= TIER_TWO_SHIP_UPGRADE_COST) {
+        requestSpeculativeShipUpgradeScreen(TIER_TWO_SHIP_CARGO_LIMIT - TIER_ONE_SHIP_CARGO_LIMIT,
+                                            TIER_TWO_SHIP_UPGRADE_COST);
+      } else if (nShipCargoLimit == TIER_TWO_SHIP_CARGO_LIMIT && nPlayerBalance >= TIER_THREE_SHIP_UPGRADE_COST) {
+        requestSpeculativeShipUpgradeScreen(TIER_THREE_SHIP_CARGO_LIMIT - TIER_TWO_SHIP_CARGO_LIMIT,
+                                            TIER_THREE_SHIP_UPGRADE_COST);
+      } else if (nShipCargoLimit == TIER_THREE_SHIP_CARGO_LIMIT && nPlayerBalance >= TIER_FOUR_SHIP_UPGRADE_COST) {
+        requestSpeculativeShipUpgradeScreen(TIER_FOUR_SHIP_CARGO_LIMIT - TIER_THREE_SHIP_CARGO_LIMIT,
+                                            TIER_FOUR_SHIP_UPGRADE_COST);
+      }
 
       char cChosenActionId =
         promptForActionId(nShipTotalCargoAmount, nShipCargoLimit, nPlayerBalance, nCoconutMarketPrice, nRiceMarketPrice,
                           nSilkMarketPrice, nGunMarketPrice);
 
       // Print out the main screen for all the other game screens.
-      if (cChosenActionId != 'Q') {
+      if (cChosenActionId != 'Q' && !hasQueuedInput()) {
         printMainScreen(nPlayerTurns, cCurrentPortId, nPlayerId, nPlayerBalance, nPlayerProfit, nPlayerProfitTarget,
                         nShipTotalCargoAmount, nShipCargoLimit, nShipCoconutCargoAmount, nShipRiceCargoAmount,
                         nShipSilkCargoAmount, nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice,
@@ -159,23 +558,86 @@ int main(void) {
       }
 
       if (cChosenActionId == 'B' || cChosenActionId == 'S') {
+        // Render the main screens that buying as much as possible or selling everything of each cargo leads to while
+        // the player is choosing the cargo, which are the trades that players make the most.
+        GameState sTradeState = {0};
+
+        sTradeState.cPortId = cCurrentPortId;
+        sTradeState.nPlayerTurns = nPlayerTurns;
+        sTradeState.nPlayerInitialBalance = nPlayerInitialBalance;
+        sTradeState.nPlayerBalance = nPlayerBalance;
+        sTradeState.nShipCargoLimit = nShipCargoLimit;
+        sTradeState.anShipCargoAmounts[0] = nShipCoconutCargoAmount;
+        sTradeState.anShipCargoAmounts[1] = nShipRiceCargoAmount;
+        sTradeState.anShipCargoAmounts[2] = nShipSilkCargoAmount;
+        sTradeState.anShipCargoAmounts[3] = nShipGunCargoAmount;
+
+        memcpy(sTradeState.anMarketPrices, anMarketPrices, sizeof(anMarketPrices));
+
+        for (int nCargoIndex = 0; nCargoIndex < CARGO_AMOUNT; nCargoIndex++) {
+          GameState sTradedState = sTradeState;
+          GameAction sTradeAction = {cChosenActionId, getCargoId(nCargoIndex), 0, 0};
+
+          sTradeAction.nCargoAmount = cChosenActionId == 'B' ? getMaximumBuyAmount(&sTradeState, sTradeAction.cCargoId)
+                                                               : sTradeState.anShipCargoAmounts[nCargoIndex];
+
+          if (sTradeAction.nCargoAmount > 0 && applyGameAction(&sTradedState, &sTradeAction)) {
+            requestSpeculativeMainScreen(
+              nPlayerTurns, cCurrentPortId, nPlayerId, sTradedState.nPlayerBalance,
+              nPlayerProfitTarget * (sTradedState.nPlayerBalance - nPlayerInitialBalance) / 100, nPlayerProfitTarget,
+              getShipTotalCargoAmount(&sTradedState), nShipCargoLimit, sTradedState.anShipCargoAmounts[0],
+              sTradedState.anShipCargoAmounts[1], sTradedState.anShipCargoAmounts[2],
+              sTradedState.anShipCargoAmounts[3], nCoconutMarketPrice, nRiceMarketPrice, nSilkMarketPrice,
+              nGunMarketPrice);
+          }
+        }
+
         char cChosenCargoId = promptForCargoId(
           cChosenActionId, nPlayerBalance, nShipCoconutCargoAmount, nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice,
           nShipCoconutCargoAmount, nShipRiceCargoAmount, nShipSilkCargoAmount, nShipGunCargoAmount);
 
         if (cChosenCargoId != 'X') {
-          printf("\n");
+          if (!hasQueuedInput()) printRenderedText("\n");
 
           int nCargoAmount =
             promptForCargoAmount(cChosenActionId, nShipCargoLimit, cChosenCargoId, nPlayerBalance, nCoconutMarketPrice,
                                  nRiceMarketPrice, nSilkMarketPrice, nGunMarketPrice, nShipCoconutCargoAmount,
                                  nShipRiceCargoAmount, nShipSilkCargoAmount, nShipGunCargoAmount);
 
-          printf("\n");
+          if (!hasQueuedInput()) printRenderedText("\n");
+
+          // Render the trade's transaction screen while the player is confirming it.
+          requestSpeculativeTransactionScreen(cChosenActionId, cChosenCargoId, nCargoAmount,
+                                              anMarketPrices[getCargoIndex(cChosenCargoId)]);
 
           int bPlayerHasConfirmed = promptForConfirmation();
+          int nChosenCargoIndex = getCargoIndex(cChosenCargoId);
 
-          if (bPlayerHasConfirmed) {
+          // Fill the order from the shared market's stock first, unless another trade moved the agreed price.
+          if (bPlayerHasConfirmed && pSharedMarket != NULL &&
+              !tradeSharedMarketCargo(pSharedMarket, cCurrentPortId, cChosenActionId, cChosenCargoId, nCargoAmount,
+                                      anMarketPrices[nChosenCargoIndex])) {
+            int anStockAmounts[CARGO_AMOUNT];
+
+            readSharedMarketPort(pSharedMarket, cCurrentPortId, anMarketPrices, anStockAmounts);
+
+            nCoconutMarketPrice = anMarketPrices[0];
+            nRiceMarketPrice = anMarketPrices[1];
+            nSilkMarketPrice = anMarketPrices[2];
+            nGunMarketPrice = anMarketPrices[3];
+
+            if (bIsLoggingEvents) {
+              sGameEvent.cEventId = MARKET_EVENT_ID;
+
+              memcpy(sGameEvent.anMarketPrices, anMarketPrices, sizeof(anMarketPrices));
+              pushLedgerEvent(&sLedger, &sGameEvent);
+            }
+
+            printMarketChangeScreen(cChosenCargoId, anMarketPrices[nChosenCargoIndex],
+                                    anStockAmounts[nChosenCargoIndex]);
+
+            promptForContinuation();
+          } else if (bPlayerHasConfirmed) {
             if (cChosenCargoId == 'C') {
               tradeCargo(cChosenActionId, cChosenCargoId, &nPlayerBalance, nCoconutMarketPrice, nCargoAmount,
                          &nShipCoconutCargoAmount);
@@ -190,11 +652,32 @@ int main(void) {
                          &nShipGunCargoAmount);
             }
 
+            if (bIsLoggingEvents) {
+              sGameEvent.cEventId = TRADE_EVENT_ID;
+              sGameEvent.cActionId = cChosenActionId;
+              sGameEvent.cCargoId = cChosenCargoId;
+              sGameEvent.nCargoAmount = nCargoAmount;
+              sGameEvent.nCargoPrice = anMarketPrices[nChosenCargoIndex];
+
+              pushLedgerEvent(&sLedger, &sGameEvent);
+            }
+
+            // Render the main screen that follows while the player reads about the trade.
+            int nShipTradedCargoAmount =
+              nShipCoconutCargoAmount + nShipRiceCargoAmount + nShipSilkCargoAmount + nShipGunCargoAmount;
+
+            requestSpeculativeMainScreen(nPlayerTurns, cCurrentPortId, nPlayerId, nPlayerBalance,
+                                         nPlayerProfitTarget * (nPlayerBalance - nPlayerInitialBalance) / 100,
+                                         nPlayerProfitTarget, nShipTradedCargoAmount, nShipCargoLimit,
+                                         nShipCoconutCargoAmount, nShipRiceCargoAmount, nShipSilkCargoAmount,
+                                         nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice, nSilkMarketPrice,
+                                         nGunMarketPrice);
+
             promptForContinuation();
           }
         }
       } else if (cChosenActionId == 'U') {
-        int bPlayerIsUpgrading = promptForShipUpgrade(nShipCargoLimit, nPlayerBalance);
+        int bPlayerIsUpgrading = promptForShipUpgrade(nShipCargoLimit, nPlayerBalance, nPlayerTurns);
 
         if (bPlayerIsUpgrading) {
           if (nShipCargoLimit == TIER_ONE_SHIP_CARGO_LIMIT) {
@@ -205,22 +688,55 @@ int main(void) {
             upgradeShip(&nPlayerBalance, TIER_FOUR_SHIP_UPGRADE_COST, &nShipCargoLimit, TIER_FOUR_SHIP_CARGO_LIMIT);
           }
 
+          if (bIsLoggingEvents) {
+            sGameEvent.cEventId = UPGRADE_EVENT_ID;
+
+            pushLedgerEvent(&sLedger, &sGameEvent);
+          }
+
+          // Render the main screen that follows while the player reads about the upgrade.
+          requestSpeculativeMainScreen(nPlayerTurns, cCurrentPortId, nPlayerId, nPlayerBalance,
+                                       nPlayerProfitTarget * (nPlayerBalance - nPlayerInitialBalance) / 100,
+                                       nPlayerProfitTarget, nShipTotalCargoAmount, nShipCargoLimit,
+                                       nShipCoconutCargoAmount, nShipRiceCargoAmount, nShipSilkCargoAmount,
+                                       nShipGunCargoAmount, nCoconutMarketPrice, nRiceMarketPrice, nSilkMarketPrice,
+                                       nGunMarketPrice);
+
           promptForContinuation();
         }
       } else if (cChosenActionId == 'N') {
-        char cChosenPortId = promptForPortId(cCurrentPortId);
+        char cChosenPortId = promptForPortId(cCurrentPortId, nPlayerTurns);
 
         if (cChosenActionId != 'X') {
-          printf("\n");
+          if (!hasQueuedInput()) printRenderedText("\n");
 
           int bPlayerHasConfirmed = promptForConfirmation();
 
           if (bPlayerHasConfirmed) {
             if (cChosenPortId != 'X') {
-              printNavigationScreen(cCurrentPortId, nPlayerTurns);
+              printNavigationScreen(cChosenPortId, nPlayerTurns);
 
               promptForContinuation();
 
+              if (bIsLoggingEvents) {
+                sGameState.cPortId = cCurrentPortId;
+                sGameState.nPlayerTurns = nPlayerTurns;
+                sGameState.nPlayerBalance = nPlayerBalance;
+                sGameState.nShipCargoLimit = nShipCargoLimit;
+                sGameState.anShipCargoAmounts[0] = nShipCoconutCargoAmount;
+                sGameState.anShipCargoAmounts[1] = nShipRiceCargoAmount;
+                sGameState.anShipCargoAmounts[2] = nShipSilkCargoAmount;
+                sGameState.anShipCargoAmounts[3] = nShipGunCargoAmount;
+
+                memcpy(sGameState.anMarketPrices, anMarketPrices, sizeof(anMarketPrices));
+
+                sGameEvent.cEventId = VOYAGE_EVENT_ID;
+                sGameEvent.cPortId = cChosenPortId;
+                sGameEvent.unStateHash = rollGameStateHash(sGameEvent.unStateHash, &sGameState);
+
+                pushLedgerEvent(&sLedger, &sGameEvent);
+              }
+
               cCurrentPortId = cChosenPortId;
               nPlayerTurns++;
               bPlayerIsNavigating = 1;
@@ -233,7 +749,48 @@ int main(void) {
     }
   }
 
+  if (bMarketIsLive) stopMarketTicker(&sMarketTicker);
+
+  if (pSharedMarket != NULL) detachSharedMarket(pSharedMarket);
+
   printGameEndScreen(nPlayerProfit, nPlayerProfitTarget, nPlayerBalance, nPlayerInitialBalance, nPlayerTurns);
 
+  if (strBroadcastName != NULL) stopSpectatorBroadcast();
+
+  if (strRecordingFilePath != NULL && !stopSessionRecording()) {
+    fprintf(stderr, "Could not finish recording the game to %s\n", strRecordingFilePath);
+  }
+
+  if (strLeaderboardFilePath != NULL) {
+    recordLeaderboardGame(&sLeaderboard, nPlayerId, nPlayerProfit, nPlayerTurns);
+    closeLeaderboard(&sLeaderboard);
+  }
+
+  if (bIsLoggingEvents) {
+    sGameState.cPortId = cCurrentPortId;
+    sGameState.nPlayerTurns = nPlayerTurns;
+    sGameState.nPlayerBalance = nPlayerBalance;
+    sGameState.nShipCargoLimit = nShipCargoLimit;
+    sGameState.anShipCargoAmounts[0] = nShipCoconutCargoAmount;
+    sGameState.anShipCargoAmounts[1] = nShipRiceCargoAmount;
+    sGameState.anShipCargoAmounts[2] = nShipSilkCargoAmount;
+    sGameState.anShipCargoAmounts[3] = nShipGunCargoAmount;
+    sGameState.bPlayerHasQuit = bPlayerIsQuitting;
+
+    memcpy(sGameState.anMarketPrices, anMarketPrices, sizeof(anMarketPrices));
+
+    sGameEvent.cEventId = GAME_END_EVENT_ID;
+    sGameEvent.nPlayerBalance = nPlayerBalance;
+    sGameEvent.unStateHash = rollGameStateHash(sGameEvent.unStateHash, &sGameState);
+
+    pushLedgerEvent(&sLedger, &sGameEvent);
+
+    if (!closeLedger(&sLedger)) {
+      fprintf(stderr, "Could not write the event log\n");
+
+      return 1;
+    }
+  }
+
   return 0;
 }
@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Description: Prints the rows of an outcome file as comma-separated values, or summarizes them by bot.
+ * Programmed by: Louis Raphael V. Panaligan
+ */
+
+// Expose clock_gettime() from the POSIX standard.
+#define _POSIX_C_SOURCE 199309L
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "outcomes.h"
+
+#define OUTPUT_BUFFER_SIZE (1 << 16)
+
+/**
+ * Gets the number of seconds elapsed since an arbitrary point in time.
+ * @returns The number of seconds from a monotonic clock.
+ */
+static double getSeconds(void) {
+  struct timespec sTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+  return sTime.tv_sec + sTime.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+  int bIsSummarizing = argc == 3 && strcmp(argv[2], "--summary") == 0;
+
+  if (argc != 2 && !bIsSummarizing) {
+    fprintf(stderr, "Usage: %s <outcome file> [--summary]\n", argv[0]);
+
+    return 1;
+  }
+
+  static char acOutputBuffer[OUTPUT_BUFFER_SIZE];
+  static OutcomeReader sReader;
+
+  if (!openOutcomeReader(&sReader, argv[1])) {
+    fprintf(stderr, "Could not open the outcome file %s\n", argv[1]);
+
+    return 1;
+  }
+
+  setvbuf(stdout, acOutputBuffer, _IOFBF, sizeof(acOutputBuffer));
+
+  if (!bIsSummarizing) printf("seed,strategy,balance,profit,turns,upgrades,coconut,rice,silk,gun\n");
+
+  GameOutcome sGameOutcome;
+  long long allOutcomeAmounts[UCHAR_MAX + 1] = {0};
+  double adProfitSums[UCHAR_MAX + 1] = {0};
+  double dStartSeconds = getSeconds();
+  int nReadStatus;
+
+  while ((nReadStatus = readGameOutcome(&sReader, &sGameOutcome)) == 1) {
+    allOutcomeAmounts[(unsigned char)sGameOutcome.cStrategyId]++;
+    adProfitSums[(unsigned char)sGameOutcome.cStrategyId] += sGameOutcome.nPlayerProfit;
+
+    if (!bIsSummarizing) {
+      printf("%llu,%c,%d,%d,%d,%d,%d,%d,%d,%d\n", sGameOutcome.ullSeed, sGameOutcome.cStrategyId,
+             sGameOutcome.nPlayerBalance, sGameOutcome.nPlayerProfit, sGameOutcome.ucPlayerTurns,
+             sGameOutcome.ucUpgradeAmount, sGameOutcome.anCargoVolumes[0], sGameOutcome.anCargoVolumes[1],
+             sGameOutcome.anCargoVolumes[2], sGameOutcome.anCargoVolumes[3]);
+    }
+  }
+
+  double dElapsedSeconds = getSeconds() - dStartSeconds;
+  long long llRowAmount = sReader.llRowAmount;
+
+  closeOutcomeReader(&sReader);
+
+  if (bIsSummarizing) {
+    for (int nStrategyId = 0; nStrategyId <= UCHAR_MAX; nStrategyId++) {
+      if (allOutcomeAmounts[nStrategyId] == 0) continue;
+
+      printf("%c: %lld games, mean profit %.2f\n", nStrategyId, allOutcomeAmounts[nStrategyId],
+             adProfitSums[nStrategyId] / allOutcomeAmounts[nStrategyId]);
+    }
+
+    printf("read %lld outcomes in %.3f s = %.0f outcomes/s\n", llRowAmount, dElapsedSeconds,
+           llRowAmount / dElapsedSeconds);
+  }
+
+  fflush(stdout);
+
+  if (nReadStatus < 0) {
+    fprintf(stderr, "The outcome file is corrupted after %lld outcomes\n", llRowAmount);
+
+    return 1;
+  }
+
+  return 0;
+}
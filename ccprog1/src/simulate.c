@@ -0,0 +1,836 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Description: Plays many games with the game's bots without any player input to compare their strategies.
+ * Programmed by: Louis Raphael V. Panaligan
+ */
+
+// Expose clock_gettime() from the POSIX standard.
+#define _POSIX_C_SOURCE 199309L
+
+#include <ctype.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bots.h"
+#include "engine.h"
+#include "evaluation.h"
+#include "events.h"
+#include "outcomes.h"
+#include "simulation.h"
+#include "tuning.h"
+
+#define SIMULATED_PROFIT_TARGET 100
+#define SIMULATED_MAXIMUM_THREAD_AMOUNT 64
+
+#define HISTOGRAM_BAR_WIDTH 50
+
+#define EVALUATION_BATCH_SIZE 256
+
+#define EXPORT_MAXIMUM_BOT_AMOUNT 8
+
+/** A bot that can be picked by name from the command line. */
+typedef struct SimulatedBot {
+  GameStrategy fnStrategy;
+  void *pContext;
+  GreedyBot sGreedyBot;
+  ExpectimaxBot sExpectimaxBot;
+} SimulatedBot;
+
+/** The games played by a single summarizing thread. */
+typedef struct SummaryThread {
+  const char *strBotName;
+  const PriceTape *pPriceTape;
+  int nFirstGameIndex;
+  int nGameIndexStep;
+  int nGameAmount;
+  SimulationSummary *pSummary;
+} SummaryThread;
+
+/** The paired games of a batch played by a single evaluating thread. */
+typedef struct EvaluationThread {
+  char **astrBotNames;
+  const PriceTape *pPriceTape;
+  int nBatchFirstGameIndex;
+  int nFirstGameIndex;
+  int nGameIndexStep;
+  int nGameAmount;
+  /** The profits of both bots in every game of the batch, indexed from the batch's first game. */
+  double (*aadProfits)[2];
+} EvaluationThread;
+
+/**
+ * Gets the number of seconds elapsed since an arbitrary point in time.
+ * @returns The number of seconds from a monotonic clock.
+ */
+static double getSeconds(void) {
+  struct timespec sTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &sTime);
+
+  return sTime.tv_sec + sTime.tv_nsec / 1e9;
+}
+
+/**
+ * Sets up a bot from its name.
+ * @param strName `"greedy"`, `"myopic"` for a greedy bot that ignores the voyages after the next one, or
+ * `"expectimax"`.
+ * @param[out] pBot The bot.
+ * @returns `1` if the bot was set up or `0` if the name is unknown.
+ */
+static int initializeSimulatedBot(const char *strName, SimulatedBot *pBot) {
+  if (strcmp(strName, "greedy") == 0 || strcmp(strName, "myopic") == 0) {
+    int nRouteValueWeight = strcmp(strName, "greedy") == 0 ? GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT : 0;
+
+    initializeGreedyBot(&pBot->sGreedyBot, GREEDY_DEFAULT_MINIMUM_MARGIN, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE,
+                        nRouteValueWeight);
+
+    pBot->fnStrategy = chooseGreedyAction;
+    pBot->pContext = &pBot->sGreedyBot;
+  } else if (strcmp(strName, "expectimax") == 0) {
+    initializeExpectimaxBot(&pBot->sExpectimaxBot, 1, EXPECTIMAX_DEFAULT_SAMPLE_AMOUNT, 1);
+
+    pBot->fnStrategy = chooseExpectimaxAction;
+    pBot->pContext = &pBot->sExpectimaxBot;
+  } else {
+    return 0;
+  }
+
+  return 1;
+}
+
+/**
+ * Writes a price tape file and reports how long it took.
+ * @param strFilePath The path of the file to write.
+ * @param nGameAmount The number of games, one for every seed.
+ * @param ullFirstSeed The seed of the first game.
+ * @returns `0` if the file was written or `1` if it could not be.
+ */
+static int runTapeCommand(const char *strFilePath, int nGameAmount, unsigned long long ullFirstSeed) {
+  double dStartSeconds = getSeconds();
+
+  if (!writePriceTape(strFilePath, nGameAmount, ullFirstSeed)) {
+    fprintf(stderr, "Could not write the price tape to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  printf("Wrote %d games (seeds %llu to %llu) to %s in %.3f s\n", nGameAmount, ullFirstSeed,
+         ullFirstSeed + nGameAmount - 1, strFilePath, getSeconds() - dStartSeconds);
+
+  return 0;
+}
+
+/**
+ * Plays the same number of games with two bots and reports the difference between their final balances. With a price
+ * tape, both bots play the exact same markets and every game is compared in pairs, which removes the luck of the
+ * markets from the difference. Without one, the bots play different seeds.
+ * @param astrBotNames The names of the two bots.
+ * @param nGameAmount The number of games that each bot plays.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `0` if the bots were compared or `1` if a bot's name is unknown.
+ */
+static int runCompareCommand(char *astrBotNames[2], int nGameAmount, const PriceTape *pPriceTape) {
+  SimulatedBot asBots[2];
+  double adBalanceSums[2] = {0, 0};
+  double adBalanceSquareSums[2] = {0, 0};
+  double dDifferenceSum = 0;
+  double dDifferenceSquareSum = 0;
+
+  for (int nBotIndex = 0; nBotIndex < 2; nBotIndex++) {
+    if (!initializeSimulatedBot(astrBotNames[nBotIndex], &asBots[nBotIndex])) {
+      fprintf(stderr, "Unknown bot %s, which must be greedy, myopic, or expectimax\n", astrBotNames[nBotIndex]);
+
+      return 1;
+    }
+  }
+
+  double dStartSeconds = getSeconds();
+
+  for (int nGameIndex = 0; nGameIndex < nGameAmount; nGameIndex++) {
+    double adBalances[2];
+
+    for (int nBotIndex = 0; nBotIndex < 2; nBotIndex++) {
+      // Without a price tape, the second bot plays the seeds after the first bot's.
+      unsigned long long ullSeed = pPriceTape != NULL ? nGameIndex : nGameIndex + (long long)nBotIndex * nGameAmount;
+      GameState sGameState;
+
+      playSimulatedGame(asBots[nBotIndex].fnStrategy, asBots[nBotIndex].pContext, SIMULATED_INITIAL_BALANCE,
+                        pPriceTape, ullSeed, NULL, &sGameState);
+
+      adBalances[nBotIndex] = sGameState.nPlayerBalance;
+      adBalanceSums[nBotIndex] += adBalances[nBotIndex];
+      adBalanceSquareSums[nBotIndex] += adBalances[nBotIndex] * adBalances[nBotIndex];
+    }
+
+    dDifferenceSum += adBalances[0] - adBalances[1];
+    dDifferenceSquareSum += (adBalances[0] - adBalances[1]) * (adBalances[0] - adBalances[1]);
+  }
+
+  double dElapsedSeconds = getSeconds() - dStartSeconds;
+  double adVariances[2];
+
+  for (int nBotIndex = 0; nBotIndex < 2; nBotIndex++) {
+    double dMean = adBalanceSums[nBotIndex] / nGameAmount;
+
+    adVariances[nBotIndex] = adBalanceSquareSums[nBotIndex] / nGameAmount - dMean * dMean;
+
+    printf("%-10s mean final balance %12.1f (standard deviation %10.1f)\n", astrBotNames[nBotIndex], dMean,
+           sqrt(adVariances[nBotIndex]));
+  }
+
+  double dDifferenceMean = dDifferenceSum / nGameAmount;
+  double dStandardError;
+
+  if (pPriceTape != NULL) {
+    dStandardError = sqrt((dDifferenceSquareSum / nGameAmount - dDifferenceMean * dDifferenceMean) / nGameAmount);
+  } else {
+    dStandardError = sqrt((adVariances[0] + adVariances[1]) / nGameAmount);
+  }
+
+  printf("difference %12.1f +/- %.1f (%s, %d games each)\n", dDifferenceMean, dStandardError,
+         pPriceTape != NULL ? "paired on the price tape" : "independent seeds", nGameAmount);
+  printf("played %d games in %.3f s = %.0f games/s\n", 2 * nGameAmount, dElapsedSeconds,
+         2 * nGameAmount / dElapsedSeconds);
+
+  return 0;
+}
+
+/**
+ * Plays every game of a summarizing thread into the thread's own summary.
+ * @param pArgument The thread, which must be a `SummaryThread`.
+ * @returns `NULL`.
+ */
+static void *runSummaryThread(void *pArgument) {
+  SummaryThread *pSummaryThread = pArgument;
+  SimulatedBot sBot;
+
+  initializeSimulatedBot(pSummaryThread->strBotName, &sBot);
+
+  for (int nGameIndex = pSummaryThread->nFirstGameIndex; nGameIndex < pSummaryThread->nGameAmount;
+       nGameIndex += pSummaryThread->nGameIndexStep) {
+    GameState sGameState;
+
+    playSimulatedGame(sBot.fnStrategy, sBot.pContext, SIMULATED_INITIAL_BALANCE, pSummaryThread->pPriceTape, nGameIndex,
+                      NULL, &sGameState);
+    addSimulationSummaryGame(pSummaryThread->pSummary, &sGameState);
+  }
+
+  return NULL;
+}
+
+/**
+ * Prints the distribution of the profits in a simulation summary.
+ * @param pSummary The summary.
+ */
+static void printSimulationSummary(const SimulationSummary *pSummary) {
+  const QuantileSketch *pSketch = &pSummary->sProfitSketch;
+  const Histogram *pHistogram = &pSummary->sProfitHistogram;
+
+  printf("profit mean %.1f, minimum %.0f, maximum %.0f\n", pSummary->dProfitSum / pSummary->llGameAmount,
+         pSketch->dMinimumValue, pSketch->dMaximumValue);
+  printf("profit p1 %.0f, p50 %.0f, p99 %.0f\n", getQuantileSketchValue(pSketch, 0.01),
+         getQuantileSketchValue(pSketch, 0.5), getQuantileSketchValue(pSketch, 0.99));
+  printf("reached the %d%% profit target in %.2f%% of games\n", pSummary->nPlayerProfitTarget,
+         100.0 * pSummary->llTargetReachedGameAmount / pSummary->llGameAmount);
+
+  long long llMaximumBinCount = 0;
+
+  for (int nBinIndex = 0; nBinIndex < HISTOGRAM_BIN_AMOUNT; nBinIndex++) {
+    if (pHistogram->allBinCounts[nBinIndex] > llMaximumBinCount) {
+      llMaximumBinCount = pHistogram->allBinCounts[nBinIndex];
+    }
+  }
+
+  for (int nBinIndex = 0; nBinIndex < HISTOGRAM_BIN_AMOUNT; nBinIndex++) {
+    if (pHistogram->allBinCounts[nBinIndex] == 0) continue;
+
+    int nBarWidth = (int)(HISTOGRAM_BAR_WIDTH * pHistogram->allBinCounts[nBinIndex] / llMaximumBinCount);
+
+    printf("  %12.0f %10lld |%.*s\n", getHistogramBinBound(nBinIndex), pHistogram->allBinCounts[nBinIndex], nBarWidth,
+           "##################################################");
+  }
+}
+
+/**
+ * Plays many games with a bot across threads and reports the distribution of their profits. Every thread keeps its own
+ * summary, which are merged once all threads are done, so memory does not grow with the number of games.
+ * @param strBotName The name of the bot.
+ * @param nGameAmount The number of games to play.
+ * @param nThreadAmount The number of threads to play with.
+ * @param nPlayerProfitTarget The player's target profit percentage.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `0` if the games were summarized or `1` if the bot's name is unknown or memory ran out.
+ */
+static int runSummarizeCommand(const char *strBotName, int nGameAmount, int nThreadAmount, int nPlayerProfitTarget,
+                               const PriceTape *pPriceTape) {
+  SimulatedBot sBot;
+
+  if (!initializeSimulatedBot(strBotName, &sBot)) {
+    fprintf(stderr, "Unknown bot %s, which must be greedy, myopic, or expectimax\n", strBotName);
+
+    return 1;
+  }
+
+  SimulationSummary *asSummaries = malloc(sizeof(SimulationSummary) * nThreadAmount);
+
+  if (asSummaries == NULL) return 1;
+
+  SummaryThread asSummaryThreads[SIMULATED_MAXIMUM_THREAD_AMOUNT];
+  pthread_t aThreads[SIMULATED_MAXIMUM_THREAD_AMOUNT];
+  int abThreadIsStarted[SIMULATED_MAXIMUM_THREAD_AMOUNT];
+  double dStartSeconds = getSeconds();
+
+  for (int nThreadIndex = 0; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    initializeSimulationSummary(&asSummaries[nThreadIndex], nPlayerProfitTarget, nThreadIndex);
+
+    asSummaryThreads[nThreadIndex].strBotName = strBotName;
+    asSummaryThreads[nThreadIndex].pPriceTape = pPriceTape;
+    asSummaryThreads[nThreadIndex].nFirstGameIndex = nThreadIndex;
+    asSummaryThreads[nThreadIndex].nGameIndexStep = nThreadAmount;
+    asSummaryThreads[nThreadIndex].nGameAmount = nGameAmount;
+    asSummaryThreads[nThreadIndex].pSummary = &asSummaries[nThreadIndex];
+  }
+
+  for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    abThreadIsStarted[nThreadIndex] =
+      pthread_create(&aThreads[nThreadIndex], NULL, runSummaryThread, &asSummaryThreads[nThreadIndex]) == 0;
+
+    if (!abThreadIsStarted[nThreadIndex]) runSummaryThread(&asSummaryThreads[nThreadIndex]);
+  }
+
+  runSummaryThread(&asSummaryThreads[0]);
+
+  for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+    if (abThreadIsStarted[nThreadIndex]) pthread_join(aThreads[nThreadIndex], NULL);
+
+    mergeSimulationSummaries(&asSummaries[0], &asSummaries[nThreadIndex]);
+  }
+
+  double dElapsedSeconds = getSeconds() - dStartSeconds;
+
+  printf("%s: %d games on %d thread(s) in %.3f s = %.0f games/s\n", strBotName, nGameAmount, nThreadAmount,
+         dElapsedSeconds, nGameAmount / dElapsedSeconds);
+  printSimulationSummary(&asSummaries[0]);
+  free(asSummaries);
+
+  return 0;
+}
+
+/**
+ * Plays the paired games of an evaluating thread, where both bots play the same seed.
+ * @param pArgument The thread, which must be an `EvaluationThread`.
+ * @returns `NULL`.
+ */
+static void *runEvaluationThread(void *pArgument) {
+  EvaluationThread *pEvaluationThread = pArgument;
+  SimulatedBot asBots[2];
+
+  for (int nBotIndex = 0; nBotIndex < 2; nBotIndex++) {
+    initializeSimulatedBot(pEvaluationThread->astrBotNames[nBotIndex], &asBots[nBotIndex]);
+  }
+
+  for (int nGameIndex = pEvaluationThread->nFirstGameIndex; nGameIndex < pEvaluationThread->nGameAmount;
+       nGameIndex += pEvaluationThread->nGameIndexStep) {
+    for (int nBotIndex = 0; nBotIndex < 2; nBotIndex++) {
+      GameState sGameState;
+
+      playSimulatedGame(asBots[nBotIndex].fnStrategy, asBots[nBotIndex].pContext, SIMULATED_INITIAL_BALANCE,
+                        pEvaluationThread->pPriceTape, nGameIndex, NULL, &sGameState);
+
+      pEvaluationThread->aadProfits[nGameIndex - pEvaluationThread->nBatchFirstGameIndex][nBotIndex] =
+        sGameState.nPlayerBalance - sGameState.nPlayerInitialBalance;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ * Plays paired games with two bots in batches until a sequential test decides which bot earns more or the maximum
+ * number of games is reached, and reports how many games and how much time that saved over always playing the maximum.
+ * The pairs are added to the test in the order of their games, so the decision does not depend on the thread count.
+ * @param astrBotNames The names of the two bots.
+ * @param nMaximumGameAmount The number of games that a fixed-count comparison would play with each bot.
+ * @param nThreadAmount The number of threads to play every batch with.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `0` if the bots were evaluated or `1` if a bot's name is unknown.
+ */
+static int runEvaluateCommand(char *astrBotNames[2], int nMaximumGameAmount, int nThreadAmount,
+                              const PriceTape *pPriceTape) {
+  SimulatedBot sBot;
+
+  for (int nBotIndex = 0; nBotIndex < 2; nBotIndex++) {
+    if (!initializeSimulatedBot(astrBotNames[nBotIndex], &sBot)) {
+      fprintf(stderr, "Unknown bot %s, which must be greedy, myopic, or expectimax\n", astrBotNames[nBotIndex]);
+
+      return 1;
+    }
+  }
+
+  SequentialTest sTest;
+  double aadProfits[EVALUATION_BATCH_SIZE][2];
+  EvaluationThread asEvaluationThreads[SIMULATED_MAXIMUM_THREAD_AMOUNT];
+  pthread_t aThreads[SIMULATED_MAXIMUM_THREAD_AMOUNT];
+  int abThreadIsStarted[SIMULATED_MAXIMUM_THREAD_AMOUNT];
+  int nGameAmount = 0;
+  int nDecision = 0;
+  double dStartSeconds = getSeconds();
+
+  initializeSequentialTest(&sTest, SEQUENTIAL_TEST_DEFAULT_INDIFFERENCE_MARGIN, SEQUENTIAL_TEST_DEFAULT_ERROR_RATE);
+
+  while (nDecision == 0 && nGameAmount < nMaximumGameAmount) {
+    int nBatchGameAmount = nMaximumGameAmount - nGameAmount;
+
+    if (nBatchGameAmount > EVALUATION_BATCH_SIZE) nBatchGameAmount = EVALUATION_BATCH_SIZE;
+
+    for (int nThreadIndex = 0; nThreadIndex < nThreadAmount; nThreadIndex++) {
+      asEvaluationThreads[nThreadIndex].astrBotNames = astrBotNames;
+      asEvaluationThreads[nThreadIndex].pPriceTape = pPriceTape;
+      asEvaluationThreads[nThreadIndex].nBatchFirstGameIndex = nGameAmount;
+      asEvaluationThreads[nThreadIndex].nFirstGameIndex = nGameAmount + nThreadIndex;
+      asEvaluationThreads[nThreadIndex].nGameIndexStep = nThreadAmount;
+      asEvaluationThreads[nThreadIndex].nGameAmount = nGameAmount + nBatchGameAmount;
+      asEvaluationThreads[nThreadIndex].aadProfits = aadProfits;
+    }
+
+    for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+      abThreadIsStarted[nThreadIndex] =
+        pthread_create(&aThreads[nThreadIndex], NULL, runEvaluationThread, &asEvaluationThreads[nThreadIndex]) == 0;
+
+      if (!abThreadIsStarted[nThreadIndex]) runEvaluationThread(&asEvaluationThreads[nThreadIndex]);
+    }
+
+    runEvaluationThread(&asEvaluationThreads[0]);
+
+    for (int nThreadIndex = 1; nThreadIndex < nThreadAmount; nThreadIndex++) {
+      if (abThreadIsStarted[nThreadIndex]) pthread_join(aThreads[nThreadIndex], NULL);
+    }
+
+    // Stop at the exact game that decided the test, even within a batch.
+    for (int nGameIndex = 0; nDecision == 0 && nGameIndex < nBatchGameAmount; nGameIndex++) {
+      addSequentialTestPair(&sTest, aadProfits[nGameIndex][0], aadProfits[nGameIndex][1]);
+
+      nDecision = getSequentialTestDecision(&sTest);
+    }
+
+    nGameAmount += nBatchGameAmount;
+  }
+
+  double dElapsedSeconds = getSeconds() - dStartSeconds;
+  // Estimate the fixed-count comparison's time from the time taken per game so far.
+  double dFixedElapsedSeconds = dElapsedSeconds * nMaximumGameAmount / nGameAmount;
+  double dMeanDifference = sTest.dDifferenceSum / sTest.llPairAmount;
+
+  if (nDecision == 0) {
+    printf("undecided after all %d games\n", nMaximumGameAmount);
+  } else {
+    printf("%s earns more than %s\n", astrBotNames[nDecision > 0 ? 0 : 1], astrBotNames[nDecision > 0 ? 1 : 0]);
+  }
+
+  printf("mean difference %.1f over %lld paired games, log-likelihood ratio %.2f (bounds %.2f and %.2f)\n",
+         dMeanDifference, sTest.llPairAmount, getSequentialTestLogLikelihoodRatio(&sTest), sTest.dLowerBound,
+         sTest.dUpperBound);
+  printf("played %d of %d games (%.1f%%) in %.3f s, saving about %.3f s over the fixed count\n", nGameAmount,
+         nMaximumGameAmount, 100.0 * nGameAmount / nMaximumGameAmount, dElapsedSeconds,
+         dFixedElapsedSeconds - dElapsedSeconds);
+
+  return 0;
+}
+
+/**
+ * Tunes the parameters of the greedy bot and writes the history of every round, followed by the best parameters, to a
+ * file.
+ * @param strFilePath The path of the file to write.
+ * @param nCandidateAmount The number of candidates to start with.
+ * @param nInitialGameAmount The number of games that every candidate plays in the first round.
+ * @param nThreadAmount The number of threads to play with.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `0` if the bot was tuned or `1` if the file could not be written or memory ran out.
+ */
+static int runTuneCommand(const char *strFilePath, int nCandidateAmount, int nInitialGameAmount, int nThreadAmount,
+                          const PriceTape *pPriceTape) {
+  FILE *pHistoryFile = fopen(strFilePath, "w");
+
+  if (pHistoryFile == NULL) {
+    fprintf(stderr, "Could not write the tuning history to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  TuningCandidate sBestCandidate;
+  double dStartSeconds = getSeconds();
+  int nRoundAmount =
+    tuneGreedyBot(nCandidateAmount, nInitialGameAmount, nThreadAmount, pPriceTape, 0, pHistoryFile, &sBestCandidate);
+
+  if (nRoundAmount == 0) {
+    fprintf(stderr, "Could not tune the bot because memory ran out\n");
+    fclose(pHistoryFile);
+
+    return 1;
+  }
+
+  double dMeanProfit = sBestCandidate.dProfitSum / sBestCandidate.nGameAmount;
+
+  fprintf(pHistoryFile, "best,%d,%d,%d,%d,%.1f\n", sBestCandidate.nGameAmount, sBestCandidate.nMinimumMargin,
+          sBestCandidate.nMinimumUpgradeValue, sBestCandidate.nRouteValueWeight, dMeanProfit);
+
+  if (fclose(pHistoryFile) != 0) {
+    fprintf(stderr, "Could not write the tuning history to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  printf("tuned %d candidates over %d rounds on %d thread(s) in %.3f s\n", nCandidateAmount, nRoundAmount,
+         nThreadAmount, getSeconds() - dStartSeconds);
+  printf("best: minimum margin %d, minimum upgrade value %d, route value weight %d%%\n", sBestCandidate.nMinimumMargin,
+         sBestCandidate.nMinimumUpgradeValue, sBestCandidate.nRouteValueWeight);
+  printf("mean profit %.1f over %d games, history written to %s\n", dMeanProfit, sBestCandidate.nGameAmount,
+         strFilePath);
+
+  return 0;
+}
+
+/**
+ * Plays many games with a bot and records all of their events in an event log through a ledger, whose writer thread
+ * keeps the file's I/O off the thread playing the games.
+ * @param strBotName The name of the bot.
+ * @param nGameAmount The number of games to play.
+ * @param strFilePath The path of the event log file to write.
+ * @param cFullPolicyId `'D'` to drop events or `'W'` to wait for space when the ledger's ring is full.
+ * @param cSyncPolicyId `'N'` to never sync the file, `'B'` to sync after every batch, or `'G'` to sync after every
+ * batch with a game end.
+ * @param nCapacity The number of events that the ledger's ring can hold.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `0` if the games were recorded or `1` if the bot's name is unknown or the file could not be written.
+ */
+static int runRecordCommand(const char *strBotName, int nGameAmount, const char *strFilePath, char cFullPolicyId,
+                            char cSyncPolicyId, int nCapacity, const PriceTape *pPriceTape) {
+  SimulatedBot sBot;
+
+  if (!initializeSimulatedBot(strBotName, &sBot)) {
+    fprintf(stderr, "Unknown bot %s, which must be greedy, myopic, or expectimax\n", strBotName);
+
+    return 1;
+  }
+
+  static Ledger sLedger;
+
+  if (!openLedger(&sLedger, strFilePath, nCapacity, cFullPolicyId, cSyncPolicyId)) {
+    fprintf(stderr, "Could not write the event log to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  double dStartSeconds = getSeconds();
+
+  for (int nGameIndex = 0; nGameIndex < nGameAmount; nGameIndex++) {
+    GameState sGameState;
+
+    playSimulatedGame(sBot.fnStrategy, sBot.pContext, SIMULATED_INITIAL_BALANCE, pPriceTape, nGameIndex, &sLedger,
+                      &sGameState);
+  }
+
+  double dPlaySeconds = getSeconds() - dStartSeconds;
+
+  if (!closeLedger(&sLedger)) {
+    fprintf(stderr, "Could not write the event log to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  long long llFileSize = 0;
+  FILE *pFile = fopen(strFilePath, "rb");
+
+  if (pFile != NULL) {
+    fseek(pFile, 0, SEEK_END);
+    llFileSize = ftell(pFile);
+    fclose(pFile);
+  }
+
+  printf("recorded %lld events of %d games in %lld bytes (%.2f bytes per event)\n", sLedger.llWrittenAmount,
+         nGameAmount, llFileSize, sLedger.llWrittenAmount > 0 ? (double)llFileSize / sLedger.llWrittenAmount : 0.0);
+  printf("played in %.3f s and written in %.3f s\n", dPlaySeconds, getSeconds() - dStartSeconds);
+  printf("pushed %lld, dropped %lld, waited %lld, written in %lld batches of at most %d, synced %lld times\n",
+         sLedger.llPushedAmount, sLedger.llDroppedAmount, sLedger.llWaitedAmount, sLedger.llBatchAmount,
+         sLedger.nMaximumBatchSize, sLedger.llSyncAmount);
+
+  return 0;
+}
+
+/**
+ * Plays games with one or more bots and writes every game's outcome to a columnar outcome file. Every bot plays every
+ * game, so the bots' rows can be compared game by game.
+ * @param strBotNames The names of the bots, separated by commas.
+ * @param nGameAmount The number of games to play.
+ * @param strFilePath The path of the outcome file to write.
+ * @param bIsCompressing `1` to compress the columns or `0` to store them as they are.
+ * @param pPriceTape The price tape, or `NULL` to generate the prices.
+ * @returns `0` if the outcomes were exported or `1` if a bot's name is unknown or shares its first letter with another
+ * bot's, or if the file could not be written.
+ */
+static int runExportCommand(const char *strBotNames, int nGameAmount, const char *strFilePath, int bIsCompressing,
+                            const PriceTape *pPriceTape) {
+  static SimulatedBot asBots[EXPORT_MAXIMUM_BOT_AMOUNT];
+  char astrNames[EXPORT_MAXIMUM_BOT_AMOUNT][16] = {{0}};
+  int nBotAmount = 0;
+
+  // Split the comma-separated names without modifying the command line.
+  for (const char *strName = strBotNames; *strName != '\0'; strName += strName[0] == ',') {
+    size_t ulNameLength = strcspn(strName, ",");
+
+    if (nBotAmount == EXPORT_MAXIMUM_BOT_AMOUNT || ulNameLength >= sizeof(astrNames[0])) {
+      fprintf(stderr, "There must be 1 to %d bots with known names\n", EXPORT_MAXIMUM_BOT_AMOUNT);
+
+      return 1;
+    }
+
+    memcpy(astrNames[nBotAmount], strName, ulNameLength);
+
+    if (!initializeSimulatedBot(astrNames[nBotAmount], &asBots[nBotAmount])) {
+      fprintf(stderr, "Unknown bot %s, which must be greedy, myopic, or expectimax\n", astrNames[nBotAmount]);
+
+      return 1;
+    }
+
+    // The outcomes tell the bots apart by the first letters of their names.
+    for (int nOtherBotIndex = 0; nOtherBotIndex < nBotAmount; nOtherBotIndex++) {
+      if (toupper(astrNames[nOtherBotIndex][0]) == toupper(astrNames[nBotAmount][0])) {
+        fprintf(stderr, "The bots %s and %s share the first letter that tells them apart in the outcomes\n",
+                astrNames[nOtherBotIndex], astrNames[nBotAmount]);
+
+        return 1;
+      }
+    }
+
+    nBotAmount++;
+    strName += ulNameLength;
+  }
+
+  static OutcomeWriter sWriter;
+
+  if (nBotAmount == 0 || !openOutcomeWriter(&sWriter, strFilePath, bIsCompressing)) {
+    fprintf(stderr, "Could not write the outcomes to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  double dStartSeconds = getSeconds();
+  double dWriteSeconds = 0;
+  int bIsWritten = 1;
+
+  for (int nGameIndex = 0; nGameIndex < nGameAmount && bIsWritten; nGameIndex++) {
+    for (int nBotIndex = 0; nBotIndex < nBotAmount && bIsWritten; nBotIndex++) {
+      OutcomeRecorder sRecorder;
+      GameState sGameState;
+
+      // The bot's ID is the first letter of its name, which was checked to be unique among the bots.
+      startGameOutcome(&sRecorder, asBots[nBotIndex].fnStrategy, asBots[nBotIndex].pContext, nGameIndex,
+                       (char)toupper(astrNames[nBotIndex][0]));
+      playSimulatedGame(chooseRecordedAction, &sRecorder, SIMULATED_INITIAL_BALANCE, pPriceTape, nGameIndex, NULL,
+                        &sGameState);
+      finishGameOutcome(&sRecorder, &sGameState);
+
+      double dWriteStartSeconds = getSeconds();
+
+      bIsWritten = writeGameOutcome(&sWriter, &sRecorder.sOutcome);
+      dWriteSeconds += getSeconds() - dWriteStartSeconds;
+    }
+  }
+
+  double dWriteStartSeconds = getSeconds();
+
+  bIsWritten = closeOutcomeWriter(&sWriter) && bIsWritten;
+  dWriteSeconds += getSeconds() - dWriteStartSeconds;
+
+  if (!bIsWritten) {
+    fprintf(stderr, "Could not write the outcomes to %s\n", strFilePath);
+
+    return 1;
+  }
+
+  double dTotalSeconds = getSeconds() - dStartSeconds;
+
+  printf("exported %lld outcomes in %lld bytes from %lld bytes of columns (%.2fx, %.2f bytes per outcome)\n",
+         sWriter.llRowAmount, sWriter.llStoredSize, sWriter.llRawSize,
+         sWriter.llStoredSize > 0 ? (double)sWriter.llRawSize / sWriter.llStoredSize : 0.0,
+         sWriter.llRowAmount > 0 ? (double)sWriter.llStoredSize / sWriter.llRowAmount : 0.0);
+  printf("played in %.3f s and written in %.3f s (%.0f outcomes per second written)\n", dTotalSeconds - dWriteSeconds,
+         dWriteSeconds, dWriteSeconds > 0 ? sWriter.llRowAmount / dWriteSeconds : 0.0);
+
+  return 0;
+}
+
+/**
+ * Opens the price tape given on the command line, if there is one.
+ * @param strFilePath The path of the file, or `NULL` if none was given.
+ * @param[out] pPriceTape The opened price tape.
+ * @param[out] nGameAmount The number of games to play, which is lowered to the number of games in the price tape.
+ * @returns `1` if a price tape was opened, `0` if none was given, or `-1` if it could not be opened.
+ */
+static int openCommandPriceTape(const char *strFilePath, PriceTape *pPriceTape, int *nGameAmount) {
+  if (strFilePath == NULL) return 0;
+
+  if (!openPriceTape(strFilePath, pPriceTape)) {
+    fprintf(stderr, "Could not open the price tape %s\n", strFilePath);
+
+    return -1;
+  }
+
+  if (*nGameAmount > pPriceTape->nGameAmount) *nGameAmount = pPriceTape->nGameAmount;
+
+  return 1;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc >= 4 && strcmp(argv[1], "tape") == 0 && atoi(argv[3]) > 0) {
+    return runTapeCommand(argv[2], atoi(argv[3]), argc > 4 ? strtoull(argv[4], NULL, 10) : 0);
+  }
+
+  if (argc >= 5 && strcmp(argv[1], "compare") == 0 && atoi(argv[4]) > 0) {
+    PriceTape sPriceTape;
+    int nGameAmount = atoi(argv[4]);
+    int nPriceTapeStatus = openCommandPriceTape(argc > 5 ? argv[5] : NULL, &sPriceTape, &nGameAmount);
+
+    if (nPriceTapeStatus < 0) return 1;
+
+    int nExitCode = runCompareCommand(&argv[2], nGameAmount, nPriceTapeStatus ? &sPriceTape : NULL);
+
+    if (nPriceTapeStatus) closePriceTape(&sPriceTape);
+
+    return nExitCode;
+  }
+
+  if (argc >= 5 && strcmp(argv[1], "evaluate") == 0 && atoi(argv[4]) > 0) {
+    PriceTape sPriceTape;
+    int nMaximumGameAmount = atoi(argv[4]);
+    int nEvaluationThreadAmount = argc > 5 ? atoi(argv[5]) : 1;
+
+    if (nEvaluationThreadAmount < 1 || nEvaluationThreadAmount > SIMULATED_MAXIMUM_THREAD_AMOUNT) {
+      fprintf(stderr, "The number of threads must be from 1 to %d\n", SIMULATED_MAXIMUM_THREAD_AMOUNT);
+
+      return 1;
+    }
+
+    int nPriceTapeStatus = openCommandPriceTape(argc > 6 ? argv[6] : NULL, &sPriceTape, &nMaximumGameAmount);
+
+    if (nPriceTapeStatus < 0) return 1;
+
+    int nExitCode = runEvaluateCommand(&argv[2], nMaximumGameAmount, nEvaluationThreadAmount,
+                                       nPriceTapeStatus ? &sPriceTape : NULL);
+
+    if (nPriceTapeStatus) closePriceTape(&sPriceTape);
+
+    return nExitCode;
+  }
+
+  if (argc >= 5 && strcmp(argv[1], "record") == 0 && atoi(argv[3]) > 0) {
+    char cFullPolicyId = argc > 5 && strcmp(argv[5], "drop") == 0 ? DROP_FULL_POLICY_ID : WAIT_FULL_POLICY_ID;
+    char cSyncPolicyId = NEVER_SYNC_POLICY_ID;
+    int nCapacity = argc > 7 ? atoi(argv[7]) : LEDGER_DEFAULT_CAPACITY;
+
+    if (argc > 6 && strcmp(argv[6], "batch") == 0) {
+      cSyncPolicyId = BATCH_SYNC_POLICY_ID;
+    } else if (argc > 6 && strcmp(argv[6], "game") == 0) {
+      cSyncPolicyId = GAME_SYNC_POLICY_ID;
+    }
+
+    // Round the capacity down to a power of two that fits in the ring.
+    if (nCapacity < 1 || nCapacity > LEDGER_MAXIMUM_CAPACITY) nCapacity = LEDGER_DEFAULT_CAPACITY;
+
+    while (nCapacity & (nCapacity - 1)) nCapacity &= nCapacity - 1;
+
+    PriceTape sPriceTape;
+    int nGameAmount = atoi(argv[3]);
+    int nPriceTapeStatus = openCommandPriceTape(argc > 8 ? argv[8] : NULL, &sPriceTape, &nGameAmount);
+
+    if (nPriceTapeStatus < 0) return 1;
+
+    int nExitCode = runRecordCommand(argv[2], nGameAmount, argv[4], cFullPolicyId, cSyncPolicyId, nCapacity,
+                                     nPriceTapeStatus ? &sPriceTape : NULL);
+
+    if (nPriceTapeStatus) closePriceTape(&sPriceTape);
+
+    return nExitCode;
+  }
+
+  if (argc >= 5 && strcmp(argv[1], "export") == 0 && atoi(argv[3]) > 0) {
+    PriceTape sPriceTape;
+    int nGameAmount = atoi(argv[3]);
+    int nPriceTapeStatus = openCommandPriceTape(argc > 6 ? argv[6] : NULL, &sPriceTape, &nGameAmount);
+
+    if (nPriceTapeStatus < 0) return 1;
+
+    int nExitCode = runExportCommand(argv[2], nGameAmount, argv[4], !(argc > 5 && strcmp(argv[5], "raw") == 0),
+                                     nPriceTapeStatus ? &sPriceTape : NULL);
+
+    if (nPriceTapeStatus) closePriceTape(&sPriceTape);
+
+    return nExitCode;
+  }
+
+  if (argc >= 3 && strcmp(argv[1], "tune") == 0) {
+    PriceTape sPriceTape;
+    int nCandidateAmount = argc > 3 ? atoi(argv[3]) : TUNING_DEFAULT_CANDIDATE_AMOUNT;
+    int nInitialGameAmount = argc > 4 ? atoi(argv[4]) : TUNING_DEFAULT_INITIAL_GAME_AMOUNT;
+    int nTuningThreadAmount = argc > 5 ? atoi(argv[5]) : 1;
+
+    if (nCandidateAmount < 1 || nCandidateAmount > TUNING_MAXIMUM_CANDIDATE_AMOUNT || nInitialGameAmount < 1 ||
+        nTuningThreadAmount < 1 || nTuningThreadAmount > TUNING_MAXIMUM_THREAD_AMOUNT) {
+      fprintf(stderr, "There must be 1 to %d candidates, 1 or more games, and 1 to %d threads\n",
+              TUNING_MAXIMUM_CANDIDATE_AMOUNT, TUNING_MAXIMUM_THREAD_AMOUNT);
+
+      return 1;
+    }
+
+    int nPriceTapeStatus = openCommandPriceTape(argc > 6 ? argv[6] : NULL, &sPriceTape, &nInitialGameAmount);
+
+    if (nPriceTapeStatus < 0) return 1;
+
+    int nExitCode = runTuneCommand(argv[2], nCandidateAmount, nInitialGameAmount, nTuningThreadAmount,
+                                   nPriceTapeStatus ? &sPriceTape : NULL);
+
+    if (nPriceTapeStatus) closePriceTape(&sPriceTape);
+
+    return nExitCode;
+  }
+
+  int nThreadAmount = argc > 4 ? atoi(argv[4]) : 1;
+
+  if (argc >= 4 && strcmp(argv[1], "summarize") == 0 && atoi(argv[3]) > 0 && nThreadAmount >= 1 &&
+      nThreadAmount <= SIMULATED_MAXIMUM_THREAD_AMOUNT) {
+    PriceTape sPriceTape;
+    int nGameAmount = atoi(argv[3]);
+    int nPlayerProfitTarget = argc > 5 ? atoi(argv[5]) : SIMULATED_PROFIT_TARGET;
+    int nPriceTapeStatus = openCommandPriceTape(argc > 6 ? argv[6] : NULL, &sPriceTape, &nGameAmount);
+
+    if (nPriceTapeStatus < 0) return 1;
+
+    int nExitCode = runSummarizeCommand(argv[2], nGameAmount, nThreadAmount, nPlayerProfitTarget,
+                                        nPriceTapeStatus ? &sPriceTape : NULL);
+
+    if (nPriceTapeStatus) closePriceTape(&sPriceTape);
+
+    return nExitCode;
+  }
+
+  fprintf(stderr, "Usage: %s tape <file> <games> [first seed]\n", argv[0]);
+  fprintf(stderr, "       %s compare <bot> <bot> <games> [tape file]\n", argv[0]);
+  fprintf(stderr, "       %s evaluate <bot> <bot> <maximum games> [threads] [tape file]\n", argv[0]);
+  fprintf(stderr, "       %s export <bot>[,<bot>...] <games> <outcome file> [lz | raw] [tape file]\n", argv[0]);
+  fprintf(stderr, "       %s record <bot> <games> <event log file> [drop | wait] [never | batch | game] [ring capacity]"
+                  " [tape file]\n", argv[0]);
+  fprintf(stderr, "       %s summarize <bot> <games> [threads] [profit target] [tape file]\n", argv[0]);
+  fprintf(stderr, "       %s tune <history file> [candidates] [initial games] [threads] [tape file]\n", argv[0]);
+
+  return 1;
+}
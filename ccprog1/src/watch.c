@@ -0,0 +1,56 @@
+/**
+ * Copyright (C) 2024  Louis Raphael V. Panaligan
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Description: Shows a game that is being broadcast with `--broadcast`, without any input to or load on the player.
+ * Programmed by: Louis Raphael V. Panaligan
+ */
+
+// Expose nanosleep() from the POSIX standard.
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+
+#include "spectators.h"
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <broadcast name>\n", argv[0]);
+
+    return 1;
+  }
+
+  static SpectatorView sView;
+  static char acText[SPECTATOR_FRAME_SIZE];
+  int nTextSize;
+  int nReadResult;
+
+  if (!attachSpectatorView(&sView, argv[1])) {
+    fprintf(stderr, "Could not find the broadcast %s\n", argv[1]);
+
+    return 1;
+  }
+
+  // Print out every frame as the player saw it, and only check for new ones a hundred times per second.
+  while ((nReadResult = readSpectatorFrame(&sView, acText, &nTextSize)) >= 0) {
+    if (nReadResult == 1) {
+      fwrite(acText, 1, nTextSize, stdout);
+      fflush(stdout);
+    } else {
+      struct timespec sDuration = {0, SPECTATOR_POLL_NANOSECONDS};
+
+      nanosleep(&sDuration, NULL);
+    }
+  }
+
+  if (sView.llSkippedAmount > 0) fprintf(stderr, "\nSkipped %lld frames\n", sView.llSkippedAmount);
+
+  detachSpectatorView(&sView);
+
+  return 0;
+}
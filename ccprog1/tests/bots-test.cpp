@@ -0,0 +1,160 @@
+extern "C" {
+#include "bots.h"
+}
+
+#include <gtest/gtest.h>
+
+const int kPlayerBalance = 1000;
+const int kDepth = 1;
+const int kSampleAmount = 4;
+
+// searchExpectimax()
+TEST(SearchExpectimaxTest, EndsPlanWithNavigation) {
+  GameState game_state;
+  GameAction turn_actions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int turn_action_amount;
+
+  initializeGameState(&game_state, kPlayerBalance);
+  srand(0);
+  generateGameMarketPrices(&game_state);
+
+  long long node_amount = searchExpectimax(&game_state, kDepth, kSampleAmount, 1, turn_actions, &turn_action_amount);
+
+  EXPECT_GT(node_amount, 0);
+  ASSERT_GT(turn_action_amount, 0);
+  EXPECT_EQ(turn_actions[turn_action_amount - 1].cActionId, 'N');
+}
+
+TEST(SearchExpectimaxTest, BuysGunsInTondoForSapa) {
+  GameState game_state;
+  GameAction turn_actions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int turn_action_amount;
+
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.cPortId = 'T';
+  game_state.anMarketPrices[getCargoIndex('C')] = MAXIMUM_TONDO_COCONUT_PRICE;
+  game_state.anMarketPrices[getCargoIndex('R')] = MAXIMUM_TONDO_RICE_PRICE;
+  game_state.anMarketPrices[getCargoIndex('S')] = MAXIMUM_TONDO_SILK_PRICE;
+  game_state.anMarketPrices[getCargoIndex('G')] = MINIMUM_TONDO_GUN_PRICE;
+
+  searchExpectimax(&game_state, kDepth, kSampleAmount, 1, turn_actions, &turn_action_amount);
+
+  ASSERT_EQ(turn_action_amount, 2);
+  EXPECT_EQ(turn_actions[0].cActionId, 'B');
+  EXPECT_EQ(turn_actions[0].cCargoId, 'G');
+  EXPECT_EQ(turn_actions[1].cPortId, 'S');
+}
+
+TEST(SearchExpectimaxTest, SellsEverythingOnLastTurn) {
+  GameState game_state;
+  GameAction turn_actions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int turn_action_amount;
+
+  initializeGameState(&game_state, kPlayerBalance);
+  srand(0);
+  generateGameMarketPrices(&game_state);
+  game_state.nPlayerTurns = MAXIMUM_PLAYER_TURNS - 1;
+  game_state.anShipCargoAmounts[getCargoIndex('S')] = 10;
+
+  searchExpectimax(&game_state, kDepth, kSampleAmount, 1, turn_actions, &turn_action_amount);
+
+  ASSERT_EQ(turn_action_amount, 2);
+  EXPECT_EQ(turn_actions[0].cActionId, 'S');
+  EXPECT_EQ(turn_actions[0].nCargoAmount, 10);
+}
+
+TEST(SearchExpectimaxTest, MatchesSingleThreadWithMultipleThreads) {
+  GameState game_state;
+  GameAction single_thread_actions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  GameAction multiple_thread_actions[MAXIMUM_TURN_PLAN_ACTION_AMOUNT];
+  int single_thread_action_amount;
+  int multiple_thread_action_amount;
+
+  initializeGameState(&game_state, kPlayerBalance);
+  srand(1);
+  generateGameMarketPrices(&game_state);
+
+  searchExpectimax(&game_state, 2, kSampleAmount, 1, single_thread_actions, &single_thread_action_amount);
+  searchExpectimax(&game_state, 2, kSampleAmount, 4, multiple_thread_actions, &multiple_thread_action_amount);
+
+  ASSERT_EQ(single_thread_action_amount, multiple_thread_action_amount);
+
+  for (int action_index = 0; action_index < single_thread_action_amount; action_index++) {
+    EXPECT_EQ(single_thread_actions[action_index].cActionId, multiple_thread_actions[action_index].cActionId);
+    EXPECT_EQ(single_thread_actions[action_index].cCargoId, multiple_thread_actions[action_index].cCargoId);
+    EXPECT_EQ(single_thread_actions[action_index].cPortId, multiple_thread_actions[action_index].cPortId);
+  }
+}
+
+// chooseExpectimaxAction()
+TEST(ChooseExpectimaxActionTest, PlaysFullGameWithValidActions) {
+  ExpectimaxBot bot;
+  GameState game_state;
+
+  initializeExpectimaxBot(&bot, kDepth, kSampleAmount, 1);
+  initializeGameState(&game_state, kPlayerBalance);
+  srand(2);
+  generateGameMarketPrices(&game_state);
+
+  while (!isGameOver(&game_state)) {
+    GameAction game_action;
+
+    chooseExpectimaxAction(&game_state, &bot, &game_action);
+
+    ASSERT_EQ(applyGameAction(&game_state, &game_action), 1);
+
+    if (game_action.cActionId == 'N') generateGameMarketPrices(&game_state);
+  }
+
+  EXPECT_GT(game_state.nPlayerBalance, kPlayerBalance);
+}
+
+// chooseGreedyAction()
+TEST(ChooseGreedyActionTest, PlaysFullGameWithValidActions) {
+  GreedyBot bot;
+  GameState game_state;
+
+  initializeGreedyBot(&bot, GREEDY_DEFAULT_MINIMUM_MARGIN, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE,
+                      GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT);
+  initializeGameState(&game_state, kPlayerBalance);
+  srand(2);
+  generateGameMarketPrices(&game_state);
+
+  while (!isGameOver(&game_state)) {
+    GameAction game_action;
+
+    chooseGreedyAction(&game_state, &bot, &game_action);
+
+    ASSERT_EQ(applyGameAction(&game_state, &game_action), 1);
+
+    if (game_action.cActionId == 'N') generateGameMarketPrices(&game_state);
+  }
+
+  EXPECT_GT(game_state.nPlayerBalance, kPlayerBalance);
+  EXPECT_EQ(getShipTotalCargoAmount(&game_state), 0);
+}
+
+TEST(ChooseGreedyActionTest, BuysGunsInTondoForSapa) {
+  GreedyBot bot;
+  GameState game_state;
+  GameAction game_action;
+
+  initializeGreedyBot(&bot, GREEDY_DEFAULT_MINIMUM_MARGIN, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE, 0);
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.cPortId = 'T';
+
+  for (int cargo_index = 0; cargo_index < CARGO_AMOUNT; cargo_index++) game_state.anMarketPrices[cargo_index] = 100;
+
+  game_state.anMarketPrices[3] = 70;
+
+  chooseGreedyAction(&game_state, &bot, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'B');
+  EXPECT_EQ(game_action.cCargoId, 'G');
+
+  applyGameAction(&game_state, &game_action);
+  chooseGreedyAction(&game_state, &bot, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'N');
+  EXPECT_EQ(game_action.cPortId, 'S');
+}
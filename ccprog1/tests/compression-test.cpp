@@ -0,0 +1,73 @@
+extern "C" {
+#include "compression.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+const int kBlockSize = 1 << 16;
+
+/**
+ * Compresses a block and decompresses it back.
+ * @param source The block.
+ * @returns The decompressed block, or an empty block if decompressing failed.
+ */
+std::vector<unsigned char> round_trip(const std::vector<unsigned char>& source) {
+  std::vector<unsigned char> compressed(LZ_MAXIMUM_COMPRESSED_SIZE(source.size()));
+  std::vector<unsigned char> decompressed(source.size());
+  int compressed_size = compressLzBlock(source.data(), source.size(), compressed.data());
+  int decompressed_size = decompressLzBlock(compressed.data(), compressed_size, decompressed.data(), source.size());
+
+  EXPECT_LE(compressed_size, static_cast<int>(LZ_MAXIMUM_COMPRESSED_SIZE(source.size())));
+  EXPECT_EQ(decompressed_size, static_cast<int>(source.size()));
+
+  return decompressed;
+}
+
+// compressLzBlock()
+TEST(CompressLzBlockTest, ShrinksRepetitiveBlocks) {
+  std::vector<unsigned char> source(kBlockSize);
+  std::vector<unsigned char> compressed(LZ_MAXIMUM_COMPRESSED_SIZE(kBlockSize));
+
+  for (int i = 0; i < kBlockSize; i++) source[i] = (i / 4) % 16 == 0 ? i % 7 : 0;
+
+  EXPECT_LT(compressLzBlock(source.data(), kBlockSize, compressed.data()), kBlockSize / 8);
+  EXPECT_EQ(round_trip(source), source);
+}
+
+TEST(CompressLzBlockTest, RoundTripsRandomBlocks) {
+  std::vector<unsigned char> source(kBlockSize);
+  unsigned int random_state = 12345;
+
+  for (int i = 0; i < kBlockSize; i++) {
+    random_state = random_state * 1103515245 + 12345;
+    source[i] = random_state >> 24;
+  }
+
+  EXPECT_EQ(round_trip(source), source);
+}
+
+TEST(CompressLzBlockTest, RoundTripsShortBlocks) {
+  for (int size = 0; size <= 20; size++) {
+    std::vector<unsigned char> source(size, 'A');
+
+    EXPECT_EQ(round_trip(source), source);
+  }
+}
+
+// decompressLzBlock()
+TEST(DecompressLzBlockTest, RejectsCorruptedBlocks) {
+  std::vector<unsigned char> source(kBlockSize, 'A');
+  std::vector<unsigned char> compressed(LZ_MAXIMUM_COMPRESSED_SIZE(kBlockSize));
+  std::vector<unsigned char> decompressed(kBlockSize);
+  int compressed_size = compressLzBlock(source.data(), kBlockSize, compressed.data());
+
+  EXPECT_EQ(decompressLzBlock(compressed.data(), compressed_size - 1, decompressed.data(), kBlockSize), -1);
+  EXPECT_EQ(decompressLzBlock(compressed.data(), compressed_size, decompressed.data(), kBlockSize - 1), -1);
+
+  // A match that reaches back before the start of the block.
+  const unsigned char bad_offset[] = {0x10, 'A', 0x02, 0x00, 0x00};
+
+  EXPECT_EQ(decompressLzBlock(bad_offset, sizeof(bad_offset), decompressed.data(), kBlockSize), -1);
+}
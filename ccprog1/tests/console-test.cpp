@@ -4,6 +4,9 @@ extern "C" {
 
 #include <gtest/gtest.h>
 
+#include <climits>
+#include <string>
+
 #include "utils.cpp"
 
 const int left_padding_size = 1;
@@ -14,6 +17,7 @@ TEST(GetIntegerInputTest, ReturnsGivenInteger) {
   FILE* mock_inputs_file = freopen("mocks/integer.txt", "r", stdin);
 
   verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
 
   int given_integer = getIntegerInput(left_padding_size);
 
@@ -27,6 +31,7 @@ TEST(GetIntegerInputTest, HandlesNegativeIntegers) {
   FILE* mock_inputs_file = freopen("mocks/integer.negative.txt", "r", stdin);
 
   verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
 
   int given_integer = getIntegerInput(left_padding_size);
 
@@ -40,6 +45,7 @@ TEST(GetIntegerInputTest, TruncatesFloatsIntoIntegers) {
   FILE* mock_inputs_file = freopen("mocks/float.txt", "r", stdin);
 
   verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
 
   int given_integer = getIntegerInput(left_padding_size);
 
@@ -54,6 +60,7 @@ TEST(GetCharacterInputTest, ReturnsGivenCharacter) {
   FILE* mock_inputs_file = freopen("mocks/character.txt", "r", stdin);
 
   verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
 
   int given_character = getCharacterInput(left_padding_size);
 
@@ -67,6 +74,7 @@ TEST(GetCharacterInputTest, HandlesIntegerCharacters) {
   FILE* mock_inputs_file = freopen("mocks/integer.txt", "r", stdin);
 
   verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
 
   int given_character = getCharacterInput(left_padding_size);
 
@@ -80,6 +88,7 @@ TEST(GetCharacterInputTest, TruncatesStringsIntoCharacters) {
   FILE* mock_inputs_file = freopen("mocks/string.txt", "r", stdin);
 
   verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
 
   int given_character = getCharacterInput(left_padding_size);
 
@@ -87,3 +96,167 @@ TEST(GetCharacterInputTest, TruncatesStringsIntoCharacters) {
 
   EXPECT_EQ(given_character, 'A');
 }
+
+TEST(GetCharacterInputTest, ReadsLinesWhenInputIsNotTerminal) {
+  // Mock a user inputting a character response of "ABCD."
+  FILE* mock_inputs_file = freopen("mocks/string.txt", "r", stdin);
+
+  verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
+
+  EXPECT_EQ(setRawInputEnabled(1), 0);
+
+  int given_character = getCharacterInput(left_padding_size);
+
+  fclose(mock_inputs_file);
+
+  EXPECT_EQ(given_character, 'A');
+}
+
+// hasQueuedInput()
+TEST(HasQueuedInputTest, ConsumesTypedAheadCommandAcrossInputs) {
+  // Mock a user inputting a whole trade on one line.
+  FILE* mock_inputs_file = freopen("mocks/command.txt", "r", stdin);
+
+  verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
+
+  EXPECT_EQ(hasQueuedInput(), 0);
+  EXPECT_EQ(getCharacterInput(left_padding_size), 'B');
+  EXPECT_EQ(isInputTypedAhead(), 1);
+  EXPECT_EQ(hasQueuedInput(), 1);
+  EXPECT_EQ(getCharacterInput(left_padding_size), 'G');
+  EXPECT_EQ(getIntegerInput(left_padding_size), 40);
+  EXPECT_EQ(getCharacterInput(left_padding_size), 'Y');
+  EXPECT_EQ(hasQueuedInput(), 0);
+
+  fclose(mock_inputs_file);
+}
+
+TEST(HasQueuedInputTest, DiscardsRestOfCommand) {
+  // Mock a user inputting a whole trade on one line.
+  FILE* mock_inputs_file = freopen("mocks/command.txt", "r", stdin);
+
+  verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
+
+  EXPECT_EQ(getCharacterInput(left_padding_size), 'B');
+
+  discardQueuedInput();
+
+  EXPECT_EQ(hasQueuedInput(), 0);
+  EXPECT_EQ(isInputTypedAhead(), 0);
+
+  fclose(mock_inputs_file);
+}
+
+TEST(GetIntegerInputTest, SkipsTokensThatAreNotIntegers) {
+  // Mock a user inputting "abc" and then 5 on the same line.
+  FILE* mock_inputs_file = freopen("mocks/integer.invalid.txt", "r", stdin);
+
+  verify_file_reopening(mock_inputs_file);
+  discardQueuedInput();
+
+  EXPECT_EQ(getIntegerInput(left_padding_size), INT_MIN);
+  EXPECT_EQ(getIntegerInput(left_padding_size), 5);
+
+  fclose(mock_inputs_file);
+}
+
+// printStyledText()
+TEST(PrintStyledTextTest, PrintsEscapeSequencesAroundSpan) {
+  begin_output_capture(1);
+
+  printStyledText(RED_COLOR_ID, "Error");
+  printConsoleText("Text");
+
+  EXPECT_EQ(end_output_capture(), COLOR_RED "Error" COLOR_DEFAULT "Text");
+}
+
+TEST(PrintStyledTextTest, CoalescesSpansOfSameColor) {
+  begin_output_capture(1);
+
+  printStyledText(RED_COLOR_ID, "First");
+  printStyledText(RED_COLOR_ID, "Second");
+
+  EXPECT_EQ(end_output_capture(), COLOR_RED "FirstSecond");
+}
+
+TEST(PrintStyledTextTest, SkipsColorChangesForBlankText) {
+  begin_output_capture(1);
+
+  printStyledText(GREEN_COLOR_ID, "Green");
+  printConsoleText("  \n");
+  printStyledText(GREEN_COLOR_ID, "Green");
+
+  EXPECT_EQ(end_output_capture(), COLOR_GREEN "Green  \nGreen");
+}
+
+TEST(PrintStyledTextTest, PrintsNoEscapeSequencesWhenColorsAreDisabled) {
+  begin_output_capture(0);
+
+  printStyledText(YELLOW_COLOR_ID, "Yellow");
+  setConsoleColorToRed();
+  printConsoleText("Red");
+  resetConsoleColor();
+  printConsoleText("Text");
+
+  EXPECT_EQ(end_output_capture(), "YellowRedText");
+}
+
+// printConsoleFrame()
+TEST(PrintConsoleFrameTest, PrintsSameTextAsConsole) {
+  static ConsoleFrame frame;
+
+  begin_output_capture(1);
+
+  beginConsoleFrame(&frame);
+  printStyledText(GREEN_COLOR_ID, "Frame");
+  endConsoleFrame();
+
+  printConsoleText("Before");
+
+  EXPECT_TRUE(printConsoleFrame(&frame));
+
+  printConsoleText("After");
+
+  EXPECT_EQ(end_output_capture(), "Before" COLOR_GREEN "Frame" COLOR_DEFAULT "After");
+}
+
+TEST(PrintConsoleFrameTest, PrintsColorThatFrameStartedIn) {
+  static ConsoleFrame frame;
+
+  begin_output_capture(1);
+
+  setConsoleColorToRed();
+  printConsoleText("Red");
+
+  beginConsoleFrame(&frame);
+  printConsoleText("Frame");
+  endConsoleFrame();
+
+  resetConsoleColor();
+  printConsoleText("Default");
+  setConsoleColorToRed();
+
+  EXPECT_TRUE(printConsoleFrame(&frame));
+
+  resetConsoleColor();
+
+  EXPECT_EQ(end_output_capture(), COLOR_RED "Red" COLOR_DEFAULT "Default" COLOR_RED "Frame");
+}
+
+TEST(PrintConsoleFrameTest, RejectsFrameOfOtherColor) {
+  static ConsoleFrame frame;
+
+  begin_output_capture(1);
+
+  setConsoleColorToYellow();
+  beginConsoleFrame(&frame);
+  printConsoleText("Frame");
+  endConsoleFrame();
+  resetConsoleColor();
+
+  EXPECT_FALSE(printConsoleFrame(&frame));
+  EXPECT_EQ(end_output_capture(), "");
+}
@@ -0,0 +1,180 @@
+extern "C" {
+#include "engine.h"
+}
+
+#include <gtest/gtest.h>
+
+const int kPlayerBalance = 1000;
+const int kCargoPrice = 10;
+
+/**
+ * Sets up a game's state with the same market price for every cargo.
+ * @param game_state The state of the game.
+ */
+void initialize_test_game_state(GameState* game_state) {
+  initializeGameState(game_state, kPlayerBalance);
+
+  for (int cargo_index = 0; cargo_index < CARGO_AMOUNT; cargo_index++) {
+    game_state->anMarketPrices[cargo_index] = kCargoPrice;
+  }
+}
+
+// initializeGameState()
+TEST(InitializeGameStateTest, StartsInManilaWithTierOneShip) {
+  GameState game_state;
+
+  initializeGameState(&game_state, kPlayerBalance);
+
+  EXPECT_EQ(game_state.cPortId, 'M');
+  EXPECT_EQ(game_state.nPlayerBalance, kPlayerBalance);
+  EXPECT_EQ(game_state.nShipCargoLimit, TIER_ONE_SHIP_CARGO_LIMIT);
+  EXPECT_EQ(getShipTotalCargoAmount(&game_state), 0);
+}
+
+// generateGameMarketPrices()
+TEST(GenerateGameMarketPricesTest, StaysWithinPortRanges) {
+  GameState game_state;
+
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.cPortId = 'S';
+  srand(0);
+  generateGameMarketPrices(&game_state);
+
+  EXPECT_GE(game_state.anMarketPrices[getCargoIndex('G')], MINIMUM_SAPA_GUN_PRICE);
+  EXPECT_LE(game_state.anMarketPrices[getCargoIndex('G')], MAXIMUM_SAPA_GUN_PRICE);
+}
+
+// getMaximumBuyAmount()
+TEST(GetMaximumBuyAmountTest, IsLimitedByBalance) {
+  GameState game_state;
+
+  initialize_test_game_state(&game_state);
+  game_state.nPlayerBalance = 5 * kCargoPrice + 1;
+
+  EXPECT_EQ(getMaximumBuyAmount(&game_state, 'C'), 5);
+}
+
+TEST(GetMaximumBuyAmountTest, IsLimitedByStorage) {
+  GameState game_state;
+
+  initialize_test_game_state(&game_state);
+  game_state.anShipCargoAmounts[getCargoIndex('R')] = TIER_ONE_SHIP_CARGO_LIMIT - 3;
+
+  EXPECT_EQ(getMaximumBuyAmount(&game_state, 'C'), 3);
+}
+
+TEST(GetMaximumBuyAmountTest, IsZeroWhenAnyPriceIsUnaffordable) {
+  GameState game_state;
+
+  initialize_test_game_state(&game_state);
+  game_state.anMarketPrices[getCargoIndex('G')] = kPlayerBalance + 1;
+
+  EXPECT_EQ(getMaximumBuyAmount(&game_state, 'C'), 0);
+}
+
+// applyGameAction()
+TEST(ApplyGameActionTest, BuysCargo) {
+  GameState game_state;
+  GameAction game_action = {'B', 'G', 4, 0};
+
+  initialize_test_game_state(&game_state);
+
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 1);
+  EXPECT_EQ(game_state.nPlayerBalance, kPlayerBalance - 4 * kCargoPrice);
+  EXPECT_EQ(game_state.anShipCargoAmounts[getCargoIndex('G')], 4);
+}
+
+TEST(ApplyGameActionTest, RejectsUnaffordableCargo) {
+  GameState game_state;
+  GameAction game_action = {'B', 'G', kPlayerBalance, 0};
+
+  initialize_test_game_state(&game_state);
+
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 0);
+  EXPECT_EQ(game_state.nPlayerBalance, kPlayerBalance);
+}
+
+TEST(ApplyGameActionTest, RejectsBuyingWhenAnyPriceIsUnaffordable) {
+  GameState game_state;
+  GameAction game_action = {'B', 'C', 1, 0};
+
+  initialize_test_game_state(&game_state);
+  game_state.anMarketPrices[getCargoIndex('G')] = kPlayerBalance + 1;
+
+  // The action prompt does not offer buying, even though a coconut is affordable.
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 0);
+  EXPECT_EQ(game_state.nPlayerBalance, kPlayerBalance);
+}
+
+TEST(ApplyGameActionTest, RejectsSellingMissingCargo) {
+  GameState game_state;
+  GameAction game_action = {'S', 'C', 1, 0};
+
+  initialize_test_game_state(&game_state);
+
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 0);
+}
+
+TEST(ApplyGameActionTest, UpgradesShip) {
+  GameState game_state;
+  GameAction game_action = {'U', 0, 0, 0};
+
+  initialize_test_game_state(&game_state);
+
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 1);
+  EXPECT_EQ(game_state.nPlayerBalance, kPlayerBalance - TIER_TWO_SHIP_UPGRADE_COST);
+  EXPECT_EQ(game_state.nShipCargoLimit, TIER_TWO_SHIP_CARGO_LIMIT);
+}
+
+TEST(ApplyGameActionTest, NavigatesAndSpendsTurn) {
+  GameState game_state;
+  GameAction game_action = {'N', 0, 0, 'S'};
+
+  initialize_test_game_state(&game_state);
+
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 1);
+  EXPECT_EQ(game_state.cPortId, 'S');
+  EXPECT_EQ(game_state.nPlayerTurns, 1);
+}
+
+TEST(ApplyGameActionTest, RejectsNavigatingToCurrentPort) {
+  GameState game_state;
+  GameAction game_action = {'N', 0, 0, 'M'};
+
+  initialize_test_game_state(&game_state);
+
+  EXPECT_EQ(applyGameAction(&game_state, &game_action), 0);
+}
+
+// isGameOver()
+TEST(IsGameOverTest, EndsAfterQuitting) {
+  GameState game_state;
+  GameAction game_action = {'Q', 0, 0, 0};
+
+  initialize_test_game_state(&game_state);
+  applyGameAction(&game_state, &game_action);
+
+  EXPECT_EQ(isGameOver(&game_state), 1);
+}
+
+TEST(IsGameOverTest, EndsAfterLastTurn) {
+  GameState game_state;
+
+  initialize_test_game_state(&game_state);
+  game_state.nPlayerTurns = MAXIMUM_PLAYER_TURNS;
+
+  EXPECT_EQ(isGameOver(&game_state), 1);
+}
+
+// hashGameState()
+TEST(HashGameStateTest, DistinguishesStates) {
+  GameState game_state;
+
+  initialize_test_game_state(&game_state);
+
+  unsigned long long hash = hashGameState(&game_state);
+
+  game_state.anShipCargoAmounts[0]++;
+
+  EXPECT_NE(hashGameState(&game_state), hash);
+}
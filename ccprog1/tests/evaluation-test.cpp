@@ -0,0 +1,75 @@
+extern "C" {
+#include "evaluation.h"
+}
+
+#include <gtest/gtest.h>
+
+const double kIndifferenceMargin = 10;
+const double kErrorRate = 0.05;
+const int kMaximumPairAmount = 10000;
+
+/**
+ * Adds pairs whose differences alternate around a mean to a sequential test until it decides.
+ * @param test The test.
+ * @param mean_difference The mean difference of the pairs.
+ * @returns The decision of the test.
+ */
+int add_pairs_until_decision(SequentialTest* test, double mean_difference) {
+  for (int pair_index = 0; pair_index < kMaximumPairAmount; pair_index++) {
+    double noise = pair_index % 2 == 0 ? 100 : -100;
+
+    addSequentialTestPair(test, 1000 + mean_difference + noise, 1000);
+
+    if (getSequentialTestDecision(test) != 0) break;
+  }
+
+  return getSequentialTestDecision(test);
+}
+
+// initializeSequentialTest()
+TEST(InitializeSequentialTestTest, HasSymmetricBounds) {
+  SequentialTest test;
+
+  initializeSequentialTest(&test, kIndifferenceMargin, kErrorRate);
+
+  EXPECT_NEAR(test.dLowerBound, -test.dUpperBound, 1e-9);
+  EXPECT_GT(test.dUpperBound, 0);
+}
+
+// getSequentialTestDecision()
+TEST(GetSequentialTestDecisionTest, DecidesForLargerFirstValues) {
+  SequentialTest test;
+
+  initializeSequentialTest(&test, kIndifferenceMargin, kErrorRate);
+
+  EXPECT_EQ(add_pairs_until_decision(&test, 2 * kIndifferenceMargin), 1);
+  EXPECT_LT(test.llPairAmount, kMaximumPairAmount);
+}
+
+TEST(GetSequentialTestDecisionTest, DecidesForLargerSecondValues) {
+  SequentialTest test;
+
+  initializeSequentialTest(&test, kIndifferenceMargin, kErrorRate);
+
+  EXPECT_EQ(add_pairs_until_decision(&test, -2 * kIndifferenceMargin), -1);
+}
+
+TEST(GetSequentialTestDecisionTest, WaitsForMinimumPairs) {
+  SequentialTest test;
+
+  initializeSequentialTest(&test, kIndifferenceMargin, kErrorRate);
+
+  for (int pair_index = 0; pair_index < SEQUENTIAL_TEST_MINIMUM_PAIR_AMOUNT - 1; pair_index++) {
+    addSequentialTestPair(&test, 1000 * (pair_index + 2), 0);
+  }
+
+  EXPECT_EQ(getSequentialTestDecision(&test), 0);
+}
+
+TEST(GetSequentialTestDecisionTest, StaysUndecidedWithoutDifference) {
+  SequentialTest test;
+
+  initializeSequentialTest(&test, kIndifferenceMargin, kErrorRate);
+
+  EXPECT_EQ(add_pairs_until_decision(&test, 0), 0);
+}
@@ -0,0 +1,273 @@
+extern "C" {
+#include "events.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "paths.cpp"
+
+const unsigned long long kSeed = 1234567890123ULL;
+const int kPlayerId = 42;
+const int kPlayerBalance = 1000;
+const int kPlayerProfitTarget = 50;
+
+/**
+ * Writes a short game with every kind of event to the test's event log file.
+ */
+void write_test_event_log() {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  game_event.cEventId = 'G';
+  game_event.ullSeed = kSeed;
+  game_event.cPriceSourceId = 'S';
+  game_event.nPlayerId = kPlayerId;
+  game_event.nPlayerBalance = kPlayerBalance;
+  game_event.nPlayerProfitTarget = kPlayerProfitTarget;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'M';
+  game_event.anMarketPrices[0] = 3;
+  game_event.anMarketPrices[1] = 20;
+  game_event.anMarketPrices[2] = 1;
+  game_event.anMarketPrices[3] = 84;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'T';
+  game_event.cActionId = 'B';
+  game_event.cCargoId = 'G';
+  game_event.nCargoAmount = 11;
+  game_event.nCargoPrice = 84;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'U';
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'V';
+  game_event.cPortId = 'S';
+  game_event.unStateHash = 0xDEADBEEF;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'E';
+  game_event.nPlayerBalance = kPlayerBalance - 76;
+  writeGameEvent(writer, &game_event);
+
+  EXPECT_EQ(writer->llEventAmount, 6);
+  EXPECT_EQ(closeEventLogWriter(writer), 1);
+
+  delete writer;
+}
+
+// readGameEvent()
+TEST(ReadGameEventTest, ReadsBackEveryEvent) {
+  EventLogReader* reader = new EventLogReader;
+  GameEvent game_event;
+
+  write_test_event_log();
+
+  ASSERT_EQ(openEventLogReader(reader, make_test_file_path("events").c_str()), 1);
+
+  ASSERT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(game_event.cEventId, 'G');
+  EXPECT_EQ(game_event.ullSeed, kSeed);
+  EXPECT_EQ(game_event.cPriceSourceId, 'S');
+  EXPECT_EQ(game_event.nPlayerId, kPlayerId);
+  EXPECT_EQ(game_event.nPlayerBalance, kPlayerBalance);
+  EXPECT_EQ(game_event.nPlayerProfitTarget, kPlayerProfitTarget);
+
+  ASSERT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(game_event.cEventId, 'M');
+  EXPECT_EQ(game_event.cPortId, 'M');
+  EXPECT_EQ(game_event.anMarketPrices[0], 3);
+  EXPECT_EQ(game_event.anMarketPrices[1], 20);
+  EXPECT_EQ(game_event.anMarketPrices[2], 1);
+  EXPECT_EQ(game_event.anMarketPrices[3], 84);
+
+  ASSERT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(game_event.cEventId, 'T');
+  EXPECT_EQ(game_event.cActionId, 'B');
+  EXPECT_EQ(game_event.cCargoId, 'G');
+  EXPECT_EQ(game_event.nCargoAmount, 11);
+  EXPECT_EQ(game_event.nCargoPrice, 84);
+
+  ASSERT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(game_event.cEventId, 'U');
+  EXPECT_EQ(game_event.nShipCargoLimit, TIER_TWO_SHIP_CARGO_LIMIT);
+  EXPECT_EQ(game_event.nShipUpgradeCost, TIER_TWO_SHIP_UPGRADE_COST);
+
+  ASSERT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(game_event.cEventId, 'V');
+  EXPECT_EQ(game_event.cPortId, 'S');
+  EXPECT_EQ(game_event.nPlayerTurns, 0);
+  EXPECT_EQ(game_event.unStateHash, 0xDEADBEEF);
+
+  ASSERT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(game_event.cEventId, 'E');
+  EXPECT_EQ(game_event.cPortId, 'S');
+  EXPECT_EQ(game_event.nPlayerTurns, 1);
+  EXPECT_EQ(game_event.nPlayerBalance, kPlayerBalance - 76);
+
+  EXPECT_EQ(readGameEvent(reader, &game_event), 0);
+
+  closeEventLogReader(reader);
+  std::remove(make_test_file_path("events").c_str());
+
+  delete reader;
+}
+
+TEST(ReadGameEventTest, RejectsTruncatedEvent) {
+  EventLogReader* reader = new EventLogReader;
+  GameEvent game_event;
+  FILE* file = std::fopen(make_test_file_path("events").c_str(), "wb");
+
+  ASSERT_NE(file, nullptr);
+
+  // A game start event whose seed never ends.
+  std::fputs(EVENT_LOG_MAGIC, file);
+  std::fputc(EVENT_LOG_VERSION, file);
+  std::fwrite("\x00\xFF\xFF", 1, 3, file);
+  std::fclose(file);
+
+  ASSERT_EQ(openEventLogReader(reader, make_test_file_path("events").c_str()), 1);
+  EXPECT_EQ(readGameEvent(reader, &game_event), -1);
+
+  closeEventLogReader(reader);
+  std::remove(make_test_file_path("events").c_str());
+
+  delete reader;
+}
+
+TEST(ReadGameEventTest, RejectsUnknownCargo) {
+  EventLogReader* reader = new EventLogReader;
+  GameEvent game_event;
+  FILE* file = std::fopen(make_test_file_path("events").c_str(), "wb");
+
+  ASSERT_NE(file, nullptr);
+
+  // A game start event followed by a trade of the eighth cargo, which does not exist.
+  std::fputs(EVENT_LOG_MAGIC, file);
+  std::fputc(EVENT_LOG_VERSION, file);
+  std::fwrite("\x00\x00\x00\x00\x00\x7A\x01\x00", 1, 8, file);
+  std::fclose(file);
+
+  ASSERT_EQ(openEventLogReader(reader, make_test_file_path("events").c_str()), 1);
+  EXPECT_EQ(readGameEvent(reader, &game_event), 1);
+  EXPECT_EQ(readGameEvent(reader, &game_event), -1);
+
+  closeEventLogReader(reader);
+  std::remove(make_test_file_path("events").c_str());
+
+  delete reader;
+}
+
+// openEventLogReader()
+TEST(OpenEventLogReaderTest, RejectsOtherFiles) {
+  EventLogReader* reader = new EventLogReader;
+  FILE* file = std::fopen(make_test_file_path("events").c_str(), "wb");
+
+  ASSERT_NE(file, nullptr);
+
+  std::fputs("This is not an event log.", file);
+  std::fclose(file);
+
+  EXPECT_EQ(openEventLogReader(reader, make_test_file_path("events").c_str()), 0);
+  EXPECT_EQ(openEventLogReader(reader, "missing-events-test.events"), 0);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete reader;
+}
+
+// writeGameEvent()
+TEST(WriteGameEventTest, EncodesTradesInFewBytes) {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  int header_size = writer->nBufferSize;
+
+  game_event.cEventId = 'T';
+  game_event.cActionId = 'S';
+  game_event.cCargoId = 'R';
+  game_event.nCargoAmount = 300;
+  writeGameEvent(writer, &game_event);
+
+  EXPECT_LE(writer->nBufferSize - header_size, 4);
+
+  closeEventLogWriter(writer);
+  std::remove(make_test_file_path("events").c_str());
+
+  delete writer;
+}
+
+TEST(WriteGameEventTest, RejectsUnknownKindsAndPriceSources) {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  int header_size = writer->nBufferSize;
+
+  game_event.cEventId = '?';
+
+  EXPECT_EQ(writeGameEvent(writer, &game_event), 0);
+
+  game_event.cEventId = GAME_START_EVENT_ID;
+  game_event.cPriceSourceId = '?';
+
+  EXPECT_EQ(writeGameEvent(writer, &game_event), 0);
+  EXPECT_EQ(writer->nBufferSize, header_size);
+
+  closeEventLogWriter(writer);
+  std::remove(make_test_file_path("events").c_str());
+
+  delete writer;
+}
+
+TEST(WriteGameEventTest, RejectsUnknownCargosAndPorts) {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  int header_size = writer->nBufferSize;
+
+  game_event.cEventId = TRADE_EVENT_ID;
+  game_event.cActionId = 'B';
+  game_event.cCargoId = '?';
+  game_event.nCargoAmount = 1;
+
+  EXPECT_EQ(writeGameEvent(writer, &game_event), 0);
+
+  game_event.cEventId = VOYAGE_EVENT_ID;
+  game_event.cPortId = '?';
+
+  EXPECT_EQ(writeGameEvent(writer, &game_event), 0);
+  EXPECT_EQ(writer->nBufferSize, header_size);
+  EXPECT_EQ(writer->llEventAmount, 0);
+
+  closeEventLogWriter(writer);
+  std::remove(make_test_file_path("events").c_str());
+
+  delete writer;
+}
+
+// setGameActionEvent()
+TEST(SetGameActionEventTest, UsesMarketPriceForTrades) {
+  GameState game_state;
+  GameAction game_action = {'B', 'S', 5, 0};
+  GameEvent game_event;
+
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.anMarketPrices[2] = 30;
+  setGameActionEvent(&game_state, &game_action, &game_event);
+
+  EXPECT_EQ(game_event.cEventId, 'T');
+  EXPECT_EQ(game_event.nCargoPrice, 30);
+  EXPECT_EQ(game_event.nCargoAmount, 5);
+}
@@ -0,0 +1,79 @@
+extern "C" {
+#include "json-lines.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+/**
+ * Writes a JSON object to a temporary stream and reads it back.
+ * @param json_line The JSON object.
+ * @param is_written Whether the whole object was written.
+ * @returns The written line.
+ */
+std::string write_to_string(JsonLine* json_line, int* is_written) {
+  std::FILE* stream = std::tmpfile();
+  char line[JSON_LINE_BUFFER_SIZE + 1] = {};
+
+  *is_written = writeJsonLine(json_line, stream);
+
+  std::rewind(stream);
+  std::size_t line_size = std::fread(line, 1, JSON_LINE_BUFFER_SIZE, stream);
+  std::fclose(stream);
+
+  return std::string(line, line_size);
+}
+
+// writeJsonLine()
+TEST(WriteJsonLineTest, WritesEveryKindOfField) {
+  JsonLine json_line;
+  const int prices[] = {3, -20, 0, 2147483647};
+  int is_written;
+
+  beginJsonLine(&json_line);
+  addJsonStringField(&json_line, "screen", "main");
+  addJsonIntegerField(&json_line, "balance", -9223372036854775807LL - 1);
+  addJsonCharacterField(&json_line, "port", 'M');
+  addJsonBooleanField(&json_line, "won", 1);
+  addJsonIntegerArrayField(&json_line, "prices", prices, 4);
+
+  EXPECT_EQ(write_to_string(&json_line, &is_written),
+            "{\"screen\":\"main\",\"balance\":-9223372036854775808,\"port\":\"M\",\"won\":true,"
+            "\"prices\":[3,-20,0,2147483647]}\n");
+  EXPECT_EQ(is_written, 1);
+}
+
+TEST(WriteJsonLineTest, WritesEmptyObjects) {
+  JsonLine json_line;
+  int is_written;
+
+  beginJsonLine(&json_line);
+
+  EXPECT_EQ(write_to_string(&json_line, &is_written), "{}\n");
+}
+
+TEST(WriteJsonLineTest, EscapesStrings) {
+  JsonLine json_line;
+  int is_written;
+
+  beginJsonLine(&json_line);
+  addJsonStringField(&json_line, "text", "a\"b\\c\n");
+  addJsonCharacterField(&json_line, "id", '"');
+
+  EXPECT_EQ(write_to_string(&json_line, &is_written), "{\"text\":\"a\\\"b\\\\c\\u000a\",\"id\":\"\\\"\"}\n");
+}
+
+TEST(WriteJsonLineTest, DropsFieldsThatDoNotFit) {
+  JsonLine json_line;
+  std::string long_value(JSON_LINE_BUFFER_SIZE, 'x');
+  int is_written;
+
+  beginJsonLine(&json_line);
+  addJsonIntegerField(&json_line, "turns", 5);
+  addJsonStringField(&json_line, "text", long_value.c_str());
+
+  EXPECT_EQ(write_to_string(&json_line, &is_written), "{\"turns\":5}\n");
+  EXPECT_EQ(is_written, 0);
+}
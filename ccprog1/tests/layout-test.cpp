@@ -0,0 +1,69 @@
+extern "C" {
+#include "layout.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+static const char* const indented_template = "  Title\n\n  • Item %d\n";
+static const char* const box_template = " ==X==\n   ║\n";
+
+// getLayoutTemplate()
+TEST(GetLayoutTemplateTest, KeepsTemplateInDesignWidth) {
+  setLayoutWidth(MAX_PRINT_WIDTH);
+
+  EXPECT_EQ(getLayoutTemplate(indented_template), indented_template);
+}
+
+TEST(GetLayoutTemplateTest, CentersIndentedLinesInWiderConsoles) {
+  setLayoutWidth(MAX_PRINT_WIDTH + 20);
+
+  EXPECT_EQ(std::string(getLayoutTemplate(indented_template)), "            Title\n\n            • Item %d\n");
+}
+
+TEST(GetLayoutTemplateTest, KeepsLinesAlignedInNarrowerConsoles) {
+  setLayoutWidth(80);
+
+  EXPECT_EQ(std::string(getLayoutTemplate(box_template)), "==X==\n  ║\n");
+}
+
+TEST(GetLayoutTemplateTest, ReusesTemplateUntilWidthChanges) {
+  setLayoutWidth(MAX_PRINT_WIDTH + 20);
+
+  const char* laid_out_template = getLayoutTemplate(indented_template);
+
+  EXPECT_EQ(getLayoutTemplate(indented_template), laid_out_template);
+
+  setLayoutWidth(MAX_PRINT_WIDTH + 4);
+
+  EXPECT_EQ(std::string(getLayoutTemplate(indented_template)), "    Title\n\n    • Item %d\n");
+}
+
+// getLayoutPaddingSize()
+TEST(GetLayoutPaddingSizeTest, CentersPaddingInConsoleWidth) {
+  setLayoutWidth(MAX_PRINT_WIDTH + 20);
+
+  EXPECT_EQ(getLayoutPaddingSize(56), 66);
+}
+
+TEST(GetLayoutPaddingSizeTest, NeverReturnsNegativePadding) {
+  setLayoutWidth(40);
+
+  EXPECT_EQ(getLayoutPaddingSize(56), 0);
+}
+
+// getLayoutSeparator()
+TEST(GetLayoutSeparatorTest, SpansConsoleWidth) {
+  setLayoutWidth(10);
+
+  EXPECT_EQ(std::string(getLayoutSeparator()), "━━━━━━━━━━");
+}
+
+TEST(GetLayoutSeparatorTest, LimitsWidth) {
+  setLayoutWidth(MAXIMUM_LAYOUT_WIDTH * 2);
+
+  EXPECT_EQ(getLayoutWidth(), MAXIMUM_LAYOUT_WIDTH);
+  EXPECT_EQ(std::strlen(getLayoutSeparator()), std::strlen("━") * MAXIMUM_LAYOUT_WIDTH);
+}
@@ -0,0 +1,155 @@
+extern "C" {
+#include "leaderboard.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "paths.cpp"
+
+// recordLeaderboardGame()
+TEST(RecordLeaderboardGameTest, KeepsBestProfitAndTotals) {
+  static Leaderboard leaderboard;
+  LeaderboardEntry entry;
+
+  std::remove(make_test_file_path("board").c_str());
+  ASSERT_EQ(openLeaderboard(&leaderboard, make_test_file_path("board").c_str(), 3), 1);
+
+  readLeaderboardEntry(&leaderboard, 7, &entry);
+
+  EXPECT_EQ(entry.nGameAmount, 0);
+
+  recordLeaderboardGame(&leaderboard, 7, -50, 4);
+
+  readLeaderboardEntry(&leaderboard, 7, &entry);
+
+  EXPECT_EQ(entry.nPlayerId, 7);
+  EXPECT_EQ(entry.nBestProfit, -50);
+  EXPECT_EQ(entry.nGameAmount, 1);
+  EXPECT_EQ(entry.llTotalTurns, 4);
+
+  recordLeaderboardGame(&leaderboard, 7, 300, 10);
+  recordLeaderboardGame(&leaderboard, 7, 100, 6);
+
+  readLeaderboardEntry(&leaderboard, 7, &entry);
+
+  EXPECT_EQ(entry.nBestProfit, 300);
+  EXPECT_EQ(entry.nGameAmount, 3);
+  EXPECT_EQ(entry.llTotalTurns, 20);
+
+  closeLeaderboard(&leaderboard);
+  std::remove(make_test_file_path("board").c_str());
+}
+
+TEST(RecordLeaderboardGameTest, CountsEveryConcurrentGame) {
+  const int kThreadAmount = 4;
+  const int kGameAmount = 2000;
+  static Leaderboard leaderboards[kThreadAmount];
+  std::vector<std::thread> threads;
+  LeaderboardEntry entry;
+
+  std::remove(make_test_file_path("board").c_str());
+
+  // Every thread maps the file on its own, like a separate game process would.
+  for (int thread_index = 0; thread_index < kThreadAmount; thread_index++) {
+    ASSERT_EQ(openLeaderboard(&leaderboards[thread_index], make_test_file_path("board").c_str(), 1), 1);
+  }
+
+  for (int thread_index = 0; thread_index < kThreadAmount; thread_index++) {
+    threads.emplace_back([thread_index, kGameAmount] {
+      for (int game_index = 0; game_index < kGameAmount; game_index++) {
+        recordLeaderboardGame(&leaderboards[thread_index], 42, thread_index * kGameAmount + game_index, 1);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) thread.join();
+
+  readLeaderboardEntry(&leaderboards[0], 42, &entry);
+
+  EXPECT_EQ(entry.nBestProfit, kThreadAmount * kGameAmount - 1);
+  EXPECT_EQ(entry.nGameAmount, kThreadAmount * kGameAmount);
+  EXPECT_EQ(entry.llTotalTurns, kThreadAmount * kGameAmount);
+
+  for (Leaderboard& leaderboard : leaderboards) closeLeaderboard(&leaderboard);
+
+  std::remove(make_test_file_path("board").c_str());
+}
+
+// getLeaderboardTop()
+TEST(GetLeaderboardTopTest, KeepsBestMerchantsInOrder) {
+  static Leaderboard leaderboard;
+  static Leaderboard other_leaderboard;
+  LeaderboardEntry entries[LEADERBOARD_MAXIMUM_TOP_AMOUNT];
+
+  std::remove(make_test_file_path("board").c_str());
+  ASSERT_EQ(openLeaderboard(&leaderboard, make_test_file_path("board").c_str(), 3), 1);
+  ASSERT_EQ(openLeaderboard(&other_leaderboard, make_test_file_path("board").c_str(), 3), 1);
+
+  recordLeaderboardGame(&leaderboard, 1, 100, 1);
+  recordLeaderboardGame(&leaderboard, 2, 500, 1);
+  recordLeaderboardGame(&leaderboard, 3, 300, 1);
+  recordLeaderboardGame(&leaderboard, 4, 200, 1);
+  recordLeaderboardGame(&leaderboard, 1, 400, 1);
+
+  ASSERT_EQ(getLeaderboardTop(&leaderboard, entries), 3);
+  EXPECT_EQ(entries[0].nPlayerId, 2);
+  EXPECT_EQ(entries[1].nPlayerId, 1);
+  EXPECT_EQ(entries[2].nPlayerId, 3);
+
+  // A game recorded by another process is seen once the heap is rebuilt.
+  recordLeaderboardGame(&other_leaderboard, 999, 450, 1);
+
+  ASSERT_EQ(getLeaderboardTop(&leaderboard, entries), 3);
+  EXPECT_EQ(entries[0].nPlayerId, 2);
+  EXPECT_EQ(entries[1].nPlayerId, 999);
+  EXPECT_EQ(entries[2].nPlayerId, 1);
+  EXPECT_EQ(entries[2].nBestProfit, 400);
+
+  closeLeaderboard(&other_leaderboard);
+  closeLeaderboard(&leaderboard);
+  std::remove(make_test_file_path("board").c_str());
+}
+
+TEST(GetLeaderboardTopTest, FindsGamesRecordedBeforeOpening) {
+  static Leaderboard leaderboard;
+  static Leaderboard other_leaderboard;
+  LeaderboardEntry entries[LEADERBOARD_MAXIMUM_TOP_AMOUNT];
+
+  std::remove(make_test_file_path("board").c_str());
+  ASSERT_EQ(openLeaderboard(&other_leaderboard, make_test_file_path("board").c_str(), 1), 1);
+
+  recordLeaderboardGame(&other_leaderboard, 7, 300, 1);
+  recordLeaderboardGame(&other_leaderboard, 8, 100, 1);
+
+  ASSERT_EQ(openLeaderboard(&leaderboard, make_test_file_path("board").c_str(), 2), 1);
+
+  // The game is recorded before the heap is ever built, which must not hide the earlier games.
+  recordLeaderboardGame(&leaderboard, 9, 200, 1);
+
+  ASSERT_EQ(getLeaderboardTop(&leaderboard, entries), 2);
+  EXPECT_EQ(entries[0].nPlayerId, 7);
+  EXPECT_EQ(entries[1].nPlayerId, 9);
+
+  closeLeaderboard(&other_leaderboard);
+  closeLeaderboard(&leaderboard);
+  std::remove(make_test_file_path("board").c_str());
+}
+
+// openLeaderboard()
+TEST(OpenLeaderboardTest, RejectsOtherFiles) {
+  static Leaderboard leaderboard;
+  FILE* other_file = std::fopen(make_test_file_path("board").c_str(), "w");
+
+  ASSERT_NE(other_file, nullptr);
+
+  std::fputs("not a leaderboard", other_file);
+  std::fclose(other_file);
+
+  EXPECT_EQ(openLeaderboard(&leaderboard, make_test_file_path("board").c_str(), 1), 0);
+
+  std::remove(make_test_file_path("board").c_str());
+}
@@ -0,0 +1,120 @@
+extern "C" {
+#include "ledger.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "paths.cpp"
+
+const int kGameAmount = 2000;
+const int kGameEventAmount = 4;
+
+/**
+ * Pushes short games, each with a game start, market, voyage, and game end event, into a ledger.
+ * @param ledger The ledger.
+ */
+void push_test_games(Ledger* ledger) {
+  GameEvent game_event = {};
+
+  game_event.cPriceSourceId = 'S';
+  game_event.nPlayerBalance = 1000;
+  game_event.anMarketPrices[0] = 5;
+  game_event.cPortId = 'T';
+
+  for (int game_index = 0; game_index < kGameAmount; game_index++) {
+    game_event.ullSeed = game_index;
+
+    for (char event_id : {'G', 'M', 'V', 'E'}) {
+      game_event.cEventId = event_id;
+      pushLedgerEvent(ledger, &game_event);
+    }
+  }
+}
+
+/**
+ * Counts the events in the test's event log file.
+ * @returns The number of events, or `-1` if the file is corrupted.
+ */
+long long count_test_events() {
+  EventLogReader* reader = new EventLogReader;
+  GameEvent game_event;
+  int read_result;
+
+  if (!openEventLogReader(reader, make_test_file_path("events").c_str())) {
+    delete reader;
+
+    return -1;
+  }
+
+  while ((read_result = readGameEvent(reader, &game_event)) == 1) {
+  }
+
+  long long event_amount = read_result == 0 ? reader->llEventAmount : -1;
+
+  closeEventLogReader(reader);
+
+  delete reader;
+
+  return event_amount;
+}
+
+// pushLedgerEvent()
+TEST(PushLedgerEventTest, WaitsForSpaceWithoutLosingEvents) {
+  Ledger* ledger = new Ledger;
+
+  ASSERT_EQ(openLedger(ledger, make_test_file_path("events").c_str(), 2, 'W', 'N'), 1);
+
+  push_test_games(ledger);
+
+  ASSERT_EQ(closeLedger(ledger), 1);
+  EXPECT_EQ(ledger->llPushedAmount, kGameAmount * kGameEventAmount);
+  EXPECT_EQ(ledger->llDroppedAmount, 0);
+  EXPECT_EQ(ledger->llWrittenAmount, ledger->llPushedAmount);
+  EXPECT_LE(ledger->nMaximumBatchSize, 2);
+  EXPECT_EQ(ledger->llSyncAmount, 0);
+  EXPECT_EQ(count_test_events(), kGameAmount * kGameEventAmount);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete ledger;
+}
+
+TEST(PushLedgerEventTest, CountsDroppedEvents) {
+  Ledger* ledger = new Ledger;
+
+  ASSERT_EQ(openLedger(ledger, make_test_file_path("events").c_str(), 2, 'D', 'N'), 1);
+
+  push_test_games(ledger);
+
+  ASSERT_EQ(closeLedger(ledger), 1);
+  EXPECT_GT(ledger->llDroppedAmount, 0);
+  EXPECT_EQ(ledger->llWaitedAmount, 0);
+  EXPECT_EQ(ledger->llPushedAmount + ledger->llDroppedAmount, kGameAmount * kGameEventAmount);
+  EXPECT_EQ(ledger->llWrittenAmount, ledger->llPushedAmount);
+
+  // The events left are still readable, since both the writer and the reader skip the dropped ones.
+  EXPECT_EQ(count_test_events(), ledger->llWrittenAmount);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete ledger;
+}
+
+// closeLedger()
+TEST(CloseLedgerTest, SyncsEveryBatch) {
+  Ledger* ledger = new Ledger;
+
+  ASSERT_EQ(openLedger(ledger, make_test_file_path("events").c_str(), LEDGER_DEFAULT_CAPACITY, 'W', 'B'), 1);
+
+  push_test_games(ledger);
+
+  ASSERT_EQ(closeLedger(ledger), 1);
+  EXPECT_EQ(ledger->llSyncAmount, ledger->llBatchAmount);
+  EXPECT_EQ(count_test_events(), kGameAmount * kGameEventAmount);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete ledger;
+}
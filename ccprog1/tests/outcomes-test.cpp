@@ -0,0 +1,172 @@
+extern "C" {
+#include "outcomes.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+
+#include "paths.cpp"
+
+const int kRowAmount = OUTCOME_ROW_GROUP_SIZE + 100;
+
+/**
+ * Makes up the outcome of a game from its index.
+ * @param index The index of the game.
+ * @returns The outcome.
+ */
+GameOutcome make_test_outcome(int index) {
+  GameOutcome outcome = {};
+
+  outcome.ullSeed = 1000000000000ULL + index;
+  outcome.cStrategyId = index % 2 == 0 ? 'G' : 'M';
+  outcome.nPlayerBalance = 1000 + index % 5000;
+  outcome.nPlayerProfit = index % 5000 - 900;
+  outcome.ucPlayerTurns = index % 16;
+  outcome.ucUpgradeAmount = index % 3;
+
+  for (int i = 0; i < CARGO_AMOUNT; i++) outcome.anCargoVolumes[i] = (index * (i + 1)) % 700;
+
+  return outcome;
+}
+
+/**
+ * Writes and reads back every test outcome.
+ * @param is_compressing Whether the columns are compressed.
+ * @returns The number of bytes written.
+ */
+long long round_trip(int is_compressing) {
+  OutcomeWriter* writer = new OutcomeWriter;
+  OutcomeReader* reader = new OutcomeReader;
+  GameOutcome outcome;
+
+  EXPECT_EQ(openOutcomeWriter(writer, make_test_file_path("outcomes").c_str(), is_compressing), 1);
+
+  for (int i = 0; i < kRowAmount; i++) {
+    outcome = make_test_outcome(i);
+    EXPECT_EQ(writeGameOutcome(writer, &outcome), 1);
+  }
+
+  EXPECT_EQ(closeOutcomeWriter(writer), 1);
+  EXPECT_EQ(openOutcomeReader(reader, make_test_file_path("outcomes").c_str()), 1);
+
+  for (int i = 0; i < kRowAmount; i++) {
+    GameOutcome expected_outcome = make_test_outcome(i);
+
+    EXPECT_EQ(readGameOutcome(reader, &outcome), 1);
+    EXPECT_EQ(outcome.ullSeed, expected_outcome.ullSeed);
+    EXPECT_EQ(outcome.cStrategyId, expected_outcome.cStrategyId);
+    EXPECT_EQ(outcome.nPlayerBalance, expected_outcome.nPlayerBalance);
+    EXPECT_EQ(outcome.nPlayerProfit, expected_outcome.nPlayerProfit);
+    EXPECT_EQ(outcome.ucPlayerTurns, expected_outcome.ucPlayerTurns);
+    EXPECT_EQ(outcome.ucUpgradeAmount, expected_outcome.ucUpgradeAmount);
+
+    for (int j = 0; j < CARGO_AMOUNT; j++) EXPECT_EQ(outcome.anCargoVolumes[j], expected_outcome.anCargoVolumes[j]);
+  }
+
+  EXPECT_EQ(readGameOutcome(reader, &outcome), 0);
+  EXPECT_EQ(writer->llRowAmount, kRowAmount);
+
+  long long stored_size = writer->llStoredSize;
+
+  closeOutcomeReader(reader);
+  std::remove(make_test_file_path("outcomes").c_str());
+
+  delete writer;
+  delete reader;
+
+  return stored_size;
+}
+
+// readGameOutcome()
+TEST(ReadGameOutcomeTest, ReadsBackEveryRow) {
+  long long raw_size = round_trip(0);
+  long long compressed_size = round_trip(1);
+
+  EXPECT_LT(compressed_size, raw_size);
+}
+
+TEST(ReadGameOutcomeTest, DetectsTruncatedFiles) {
+  OutcomeWriter* writer = new OutcomeWriter;
+  OutcomeReader* reader = new OutcomeReader;
+  GameOutcome outcome = make_test_outcome(0);
+
+  ASSERT_EQ(openOutcomeWriter(writer, make_test_file_path("outcomes").c_str(), 1), 1);
+  writeGameOutcome(writer, &outcome);
+  closeOutcomeWriter(writer);
+
+  std::FILE* file = std::fopen(make_test_file_path("outcomes").c_str(), "rb+");
+
+  ASSERT_NE(file, nullptr);
+
+  std::fseek(file, 0, SEEK_END);
+
+  long file_size = std::ftell(file);
+
+  std::fclose(file);
+  ASSERT_EQ(truncate(make_test_file_path("outcomes").c_str(), file_size - 1), 0);
+
+  ASSERT_EQ(openOutcomeReader(reader, make_test_file_path("outcomes").c_str()), 1);
+  EXPECT_EQ(readGameOutcome(reader, &outcome), -1);
+
+  closeOutcomeReader(reader);
+  std::remove(make_test_file_path("outcomes").c_str());
+
+  delete writer;
+  delete reader;
+}
+
+// openOutcomeReader()
+TEST(OpenOutcomeReaderTest, RejectsOtherFiles) {
+  OutcomeReader* reader = new OutcomeReader;
+  std::FILE* file = std::fopen(make_test_file_path("outcomes").c_str(), "wb");
+
+  ASSERT_NE(file, nullptr);
+
+  std::fputs("TAPE", file);
+  std::fclose(file);
+
+  EXPECT_EQ(openOutcomeReader(reader, make_test_file_path("outcomes").c_str()), 0);
+  EXPECT_EQ(openOutcomeReader(reader, "missing.outcomes"), 0);
+
+  std::remove(make_test_file_path("outcomes").c_str());
+
+  delete reader;
+}
+
+// chooseRecordedAction()
+TEST(ChooseRecordedActionTest, CountsOnlyValidActions) {
+  OutcomeRecorder recorder;
+  GameState game_state;
+  GameAction game_action;
+
+  initializeGameState(&game_state, 1000);
+  game_state.anMarketPrices[0] = 10;
+
+  startGameOutcome(
+      &recorder,
+      [](const GameState*, void* context, GameAction* action) { *action = *static_cast<GameAction*>(context); },
+      &game_action, 7, 'T');
+
+  game_action = {'B', 'C', 5, 'M'};
+  chooseRecordedAction(&game_state, &recorder, &game_action);
+  game_action = {'S', 'C', 5, 'M'};
+  chooseRecordedAction(&game_state, &recorder, &game_action);
+  game_action = {'U', 'C', 0, 'M'};
+  chooseRecordedAction(&game_state, &recorder, &game_action);
+
+  EXPECT_EQ(recorder.sOutcome.ullSeed, 7ULL);
+  EXPECT_EQ(recorder.sOutcome.cStrategyId, 'T');
+  EXPECT_EQ(recorder.sOutcome.anCargoVolumes[0], 5);
+  EXPECT_EQ(recorder.sOutcome.ucUpgradeAmount, 1);
+
+  game_state.nPlayerBalance = 1234;
+  game_state.nPlayerTurns = 15;
+  finishGameOutcome(&recorder, &game_state);
+
+  EXPECT_EQ(recorder.sOutcome.nPlayerBalance, 1234);
+  EXPECT_EQ(recorder.sOutcome.nPlayerProfit, 234);
+  EXPECT_EQ(recorder.sOutcome.ucPlayerTurns, 15);
+}
@@ -0,0 +1,14 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+/**
+ * Names a file after the running test, so that tests run in parallel never share one.
+ * @param extension The file's extension.
+ * @returns The file's path, relative to the working directory.
+ */
+std::string make_test_file_path(const char* extension) {
+  const ::testing::TestInfo* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+
+  return std::string(test_info->test_suite_name()) + "." + test_info->name() + "." + extension;
+}
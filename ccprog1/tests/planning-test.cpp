@@ -0,0 +1,83 @@
+extern "C" {
+#include "planning.h"
+#include "trading.h"
+}
+
+#include <gtest/gtest.h>
+
+const int kPlayerBalance = 5000;
+const int kPlayerTurns = 0;
+
+// getBalanceBucket()
+TEST(GetBalanceBucketTest, ReturnsFirstBucketForSmallBalances) {
+  EXPECT_EQ(getBalanceBucket(BALANCE_BUCKET_BASE_SIZE - 1), 0);
+}
+
+TEST(GetBalanceBucketTest, DoublesBucketSizes) {
+  EXPECT_EQ(getBalanceBucket(BALANCE_BUCKET_BASE_SIZE), 1);
+  EXPECT_EQ(getBalanceBucket(BALANCE_BUCKET_BASE_SIZE * 2 - 1), 1);
+  EXPECT_EQ(getBalanceBucket(BALANCE_BUCKET_BASE_SIZE * 2), 2);
+}
+
+TEST(GetBalanceBucketTest, ClampsToLastBucket) { EXPECT_EQ(getBalanceBucket(2147483647), BALANCE_BUCKET_AMOUNT - 1); }
+
+// getShipUpgradeValue()
+TEST(GetShipUpgradeValueTest, ReturnsZeroForHighestTier) {
+  EXPECT_EQ(getShipUpgradeValue(TIER_FOUR_SHIP_CARGO_LIMIT, kPlayerBalance, kPlayerTurns), 0);
+}
+
+TEST(GetShipUpgradeValueTest, LosesCostWhenNoTurnsRemain) {
+  int ship_upgrade_value = getShipUpgradeValue(TIER_ONE_SHIP_CARGO_LIMIT, kPlayerBalance, MAXIMUM_PLAYER_TURNS);
+
+  EXPECT_EQ(ship_upgrade_value, -TIER_TWO_SHIP_UPGRADE_COST);
+}
+
+TEST(GetShipUpgradeValueTest, PaysBackEarlyInTheGame) {
+  EXPECT_GT(getShipUpgradeValue(TIER_ONE_SHIP_CARGO_LIMIT, kPlayerBalance, kPlayerTurns), 0);
+}
+
+TEST(GetShipUpgradeValueTest, IsGreaterWithMoreTurnsRemaining) {
+  int early_ship_upgrade_value = getShipUpgradeValue(TIER_ONE_SHIP_CARGO_LIMIT, kPlayerBalance, kPlayerTurns);
+  int late_ship_upgrade_value =
+    getShipUpgradeValue(TIER_ONE_SHIP_CARGO_LIMIT, kPlayerBalance, MAXIMUM_PLAYER_TURNS - 2);
+
+  EXPECT_GT(early_ship_upgrade_value, late_ship_upgrade_value);
+}
+
+// getRouteValue()
+TEST(GetRouteValueTest, ReturnsZeroForCurrentPort) { EXPECT_EQ(getRouteValue('T', 'T', kPlayerTurns), 0); }
+
+TEST(GetRouteValueTest, ReturnsZeroForLastVoyage) {
+  EXPECT_EQ(getRouteValue('T', 'S', MAXIMUM_PLAYER_TURNS - 1), 0);
+}
+
+TEST(GetRouteValueTest, ReturnsExpectedMarginForSecondToLastVoyage) {
+  // Guns are bought in Tondo for 70 - 95 and are expected to sell in Sapa for 252.5.
+  EXPECT_EQ(getRouteValue('T', 'S', MAXIMUM_PLAYER_TURNS - 2), 170);
+}
+
+TEST(GetRouteValueTest, IncreasesWithMoreTurnsRemaining) {
+  EXPECT_GT(getRouteValue('T', 'S', kPlayerTurns), getRouteValue('T', 'S', MAXIMUM_PLAYER_TURNS - 2));
+}
+
+// getRecommendedPortId()
+TEST(GetRecommendedPortIdTest, NeverRecommendsCurrentPort) {
+  const char port_ids[] = {'T', 'M', 'P', 'S'};
+
+  for (char port_id : port_ids) {
+    for (int player_turns = 0; player_turns < MAXIMUM_PLAYER_TURNS; player_turns++) {
+      EXPECT_NE(getRecommendedPortId(port_id, player_turns), port_id);
+    }
+  }
+}
+
+TEST(GetRecommendedPortIdTest, RecommendsSapaFromTondo) { EXPECT_EQ(getRecommendedPortId('T', kPlayerTurns), 'S'); }
+
+TEST(GetRecommendedPortIdTest, RecommendsRouteWithHighestValue) {
+  char recommended_port_id = getRecommendedPortId('M', kPlayerTurns);
+  const char port_ids[] = {'T', 'P', 'S'};
+
+  for (char port_id : port_ids) {
+    EXPECT_GE(getRouteValue('M', recommended_port_id, kPlayerTurns), getRouteValue('M', port_id, kPlayerTurns));
+  }
+}
@@ -14,6 +14,7 @@ const char kTransactionType = 'B';
 const int kShipCargoAmount = 1;
 const char kCargoId = 'C';
 const char kPortId = 'T';
+const int kPlayerTurns = 0;
 
 // promptForPlayerId()
 TEST(PromptForPlayerIdTest, ReturnsGivenInteger) {
@@ -317,7 +318,7 @@ TEST(PromptForShipUpgradeTest, ReturnsTrue) {
 
   verify_file_reopening(mock_inputs_file);
 
-  bool is_upgrading = promptForShipUpgrade(kShipCargoLimit, kPlayerBalance);
+  bool is_upgrading = promptForShipUpgrade(kShipCargoLimit, kPlayerBalance, kPlayerTurns);
 
   fclose(mock_inputs_file);
 
@@ -330,7 +331,7 @@ TEST(PromptForShipUpgradeTest, ReturnsFalse) {
 
   verify_file_reopening(mock_inputs_file);
 
-  bool is_upgrading = promptForShipUpgrade(kShipCargoLimit, kPlayerBalance);
+  bool is_upgrading = promptForShipUpgrade(kShipCargoLimit, kPlayerBalance, kPlayerTurns);
 
   fclose(mock_inputs_file);
 
@@ -343,7 +344,7 @@ TEST(PromptForShipUpgradeTest, RetriesWhenResponseIsAnInvalidCharacter) {
 
   verify_file_reopening(mock_inputs_file);
 
-  bool is_upgrading = promptForShipUpgrade(kShipCargoLimit, kPlayerBalance);
+  bool is_upgrading = promptForShipUpgrade(kShipCargoLimit, kPlayerBalance, kPlayerTurns);
 
   fclose(mock_inputs_file);
 
@@ -357,7 +358,7 @@ TEST(PromptForPortIdTest, ReturnsGivenCharacter) {
 
   verify_file_reopening(mock_inputs_file);
 
-  char given_port_id = promptForPortId(kPortId);
+  char given_port_id = promptForPortId(kPortId, kPlayerTurns);
 
   fclose(mock_inputs_file);
 
@@ -370,7 +371,7 @@ TEST(PromptForPortIdTest, RetriesWhenResponseIsAnInvalidCharacter) {
 
   verify_file_reopening(mock_inputs_file);
 
-  char given_port_id = promptForPortId(kPortId);
+  char given_port_id = promptForPortId(kPortId, kPlayerTurns);
 
   fclose(mock_inputs_file);
 
@@ -383,7 +384,7 @@ TEST(PromptForPortIdTest, RetriesWhenResponseIsAnInteger) {
 
   verify_file_reopening(mock_inputs_file);
 
-  char given_port_id = promptForPortId(kPortId);
+  char given_port_id = promptForPortId(kPortId, kPlayerTurns);
 
   fclose(mock_inputs_file);
 
@@ -0,0 +1,99 @@
+extern "C" {
+#include "layout.h"
+#include "recording.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "paths.cpp"
+#include "utils.cpp"
+
+/**
+ * Reads the test's recording file.
+ * @returns The whole file.
+ */
+std::string read_test_recording() {
+  std::ifstream recording_file(make_test_file_path("cast").c_str());
+  std::stringstream recording;
+
+  recording << recording_file.rdbuf();
+
+  return recording.str();
+}
+
+// startSessionRecording()
+TEST(StartSessionRecordingTest, WritesAsciicastHeader) {
+  setLayoutWidth(80);
+
+  ASSERT_EQ(startSessionRecording(make_test_file_path("cast").c_str()), 1);
+  EXPECT_EQ(stopSessionRecording(), 1);
+
+  std::string recording = read_test_recording();
+
+  EXPECT_EQ(recording.rfind("{\"version\":2,\"width\":80,\"height\":", 0), 0u);
+  EXPECT_EQ(recording.back(), '\n');
+  EXPECT_EQ(recording.find('\n'), recording.size() - 1);
+
+  setLayoutWidth(0);
+  std::remove(make_test_file_path("cast").c_str());
+}
+
+// stopSessionRecording()
+TEST(StopSessionRecordingTest, WritesEveryChunkAsEscapedEvent) {
+  ASSERT_EQ(startSessionRecording(make_test_file_path("cast").c_str()), 1);
+
+  begin_output_capture(1);
+  printConsoleText("Screen \"%d\"\n", 1);
+  printStyledText(GREEN_COLOR_ID, "Prompt\\");
+  flushOutputChunk();
+  end_output_capture();
+
+  EXPECT_EQ(stopSessionRecording(), 1);
+
+  std::string recording = read_test_recording();
+  std::string event = recording.substr(recording.find('\n') + 1);
+
+  EXPECT_EQ(event.find("[0."), 0u);
+  EXPECT_NE(event.find(", \"o\", \"Screen \\\"1\\\"\\n\\u001b[0;32mPrompt\\\\"), std::string::npos);
+  EXPECT_EQ(event.find('\n'), event.size() - 1);
+
+  std::remove(make_test_file_path("cast").c_str());
+}
+
+TEST(StopSessionRecordingTest, KeepsRepeatedChunks) {
+  long long recorded_amount;
+  long long waited_amount;
+
+  ASSERT_EQ(startSessionRecording(make_test_file_path("cast").c_str()), 1);
+
+  begin_output_capture(0);
+
+  for (const char* text : {"Prompt", "Prompt", "Screen", "Prompt", "Prompt", "Prompt"}) {
+    printConsoleText("%s", text);
+    flushOutputChunk();
+  }
+
+  end_output_capture();
+
+  EXPECT_EQ(stopSessionRecording(), 1);
+
+  getSessionRecordingAmounts(&recorded_amount, &waited_amount);
+
+  // A prompt that is printed again after an invalid input is new output, so every print is kept.
+  EXPECT_EQ(recorded_amount, 6);
+  EXPECT_EQ(waited_amount, 0);
+
+  std::string recording = read_test_recording();
+  int line_amount = 0;
+
+  for (char character : recording) line_amount += character == '\n';
+
+  EXPECT_EQ(line_amount, 7);
+
+  std::remove(make_test_file_path("cast").c_str());
+}
@@ -0,0 +1,243 @@
+extern "C" {
+#include "bots.h"
+#include "replay.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "paths.cpp"
+
+const int kGameAmount = 8;
+const int kPlayerBalance = 1000;
+
+/**
+ * Records greedy bot games to the test's event log file.
+ * @param price_tape The price tape to play the games with, or `NULL` to generate the prices from the seeds.
+ */
+void record_test_games(const PriceTape* price_tape) {
+  Ledger* ledger = new Ledger;
+  GreedyBot bot;
+  GameState game_state;
+
+  initializeGreedyBot(&bot, GREEDY_DEFAULT_MINIMUM_MARGIN, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE,
+                      GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT);
+
+  ASSERT_EQ(openLedger(ledger, make_test_file_path("events").c_str(), LEDGER_DEFAULT_CAPACITY, 'W', 'N'), 1);
+
+  for (int game_index = 0; game_index < kGameAmount; game_index++) {
+    playSimulatedGame(chooseGreedyAction, &bot, kPlayerBalance, price_tape, game_index, ledger, &game_state);
+  }
+
+  ASSERT_EQ(closeLedger(ledger), 1);
+
+  delete ledger;
+}
+
+/**
+ * Replays the test's event log file.
+ * @param price_tape The price tape that the games were played with, or `NULL` if none.
+ * @param[out] result What happened while replaying.
+ * @returns The return value of `replayEventLog()`.
+ */
+int replay_test_games(const PriceTape* price_tape, ReplayResult* result) {
+  EventLogReader* reader = new EventLogReader;
+
+  if (!openEventLogReader(reader, make_test_file_path("events").c_str())) {
+    delete reader;
+
+    return -1;
+  }
+
+  int is_replayed = replayEventLog(reader, price_tape, result);
+
+  closeEventLogReader(reader);
+
+  delete reader;
+
+  return is_replayed;
+}
+
+// replayEventLog()
+TEST(ReplayEventLogTest, MatchesSimulatedGames) {
+  ReplayResult result;
+
+  record_test_games(NULL);
+
+  ASSERT_EQ(replay_test_games(NULL, &result), 1);
+  EXPECT_EQ(result.cDivergenceId, 0);
+  EXPECT_EQ(result.llGameAmount, kGameAmount);
+  EXPECT_EQ(result.llTurnAmount, kGameAmount * MAXIMUM_PLAYER_TURNS);
+
+  std::remove(make_test_file_path("events").c_str());
+}
+
+TEST(ReplayEventLogTest, NeedsPriceTapeOfTapedGames) {
+  PriceTape price_tape;
+  ReplayResult result;
+
+  ASSERT_EQ(writePriceTape(make_test_file_path("tape").c_str(), kGameAmount, 3), 1);
+  ASSERT_EQ(openPriceTape(make_test_file_path("tape").c_str(), &price_tape), 1);
+
+  record_test_games(&price_tape);
+
+  ASSERT_EQ(replay_test_games(&price_tape, &result), 1);
+  EXPECT_EQ(result.cDivergenceId, 0);
+  EXPECT_EQ(result.llGameAmount, kGameAmount);
+
+  ASSERT_EQ(replay_test_games(NULL, &result), 1);
+  EXPECT_EQ(result.cDivergenceId, 'T');
+  EXPECT_EQ(result.llDivergentGameIndex, 0);
+
+  closePriceTape(&price_tape);
+  std::remove(make_test_file_path("tape").c_str());
+  std::remove(make_test_file_path("events").c_str());
+}
+
+TEST(ReplayEventLogTest, MatchesRandPricesFromSeed) {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+  GameState game_state;
+  ReplayResult result;
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  // Record a short game the same way that the game itself does.
+  srand(99);
+  initializeGameState(&game_state, kPlayerBalance);
+  generateGameMarketPrices(&game_state);
+
+  game_event.cEventId = 'G';
+  game_event.ullSeed = 99;
+  game_event.cPriceSourceId = 'R';
+  game_event.nPlayerBalance = kPlayerBalance;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'M';
+  for (int cargo_index = 0; cargo_index < CARGO_AMOUNT; cargo_index++) {
+    game_event.anMarketPrices[cargo_index] = game_state.anMarketPrices[cargo_index];
+  }
+  writeGameEvent(writer, &game_event);
+
+  GameAction game_action = {'B', 'C', 5, 0};
+
+  setGameActionEvent(&game_state, &game_action, &game_event);
+  writeGameEvent(writer, &game_event);
+  applyGameAction(&game_state, &game_action);
+
+  game_action = {'N', 0, 0, 'T'};
+  setGameActionEvent(&game_state, &game_action, &game_event);
+  writeGameEvent(writer, &game_event);
+  applyGameAction(&game_state, &game_action);
+
+  game_action = {'Q', 0, 0, 0};
+  applyGameAction(&game_state, &game_action);
+
+  game_event.cEventId = 'E';
+  game_event.nPlayerBalance = game_state.nPlayerBalance;
+  game_event.unStateHash = rollGameStateHash(game_event.unStateHash, &game_state);
+  writeGameEvent(writer, &game_event);
+
+  ASSERT_EQ(closeEventLogWriter(writer), 1);
+
+  ASSERT_EQ(replay_test_games(NULL, &result), 1);
+  EXPECT_EQ(result.cDivergenceId, 0);
+  EXPECT_EQ(result.llGameAmount, 1);
+  EXPECT_EQ(result.llEventAmount, 5);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete writer;
+}
+
+TEST(ReplayEventLogTest, FindsFirstDivergence) {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+  ReplayResult result;
+  unsigned short prices[PRICE_TAPE_GAME_PRICE_AMOUNT];
+
+  generatePriceTapeGame(5, prices);
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  game_event.cEventId = 'G';
+  game_event.ullSeed = 5;
+  game_event.cPriceSourceId = 'S';
+  game_event.nPlayerBalance = kPlayerBalance;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'M';
+  for (int cargo_index = 0; cargo_index < CARGO_AMOUNT; cargo_index++) {
+    game_event.anMarketPrices[cargo_index] = prices[getPortIndex('M') * CARGO_AMOUNT + cargo_index];
+  }
+  writeGameEvent(writer, &game_event);
+
+  // The player cannot sell cargo that they do not have.
+  game_event.cEventId = 'T';
+  game_event.cActionId = 'S';
+  game_event.cCargoId = 'R';
+  game_event.nCargoAmount = 1;
+  game_event.nCargoPrice = game_event.anMarketPrices[1];
+  writeGameEvent(writer, &game_event);
+
+  ASSERT_EQ(closeEventLogWriter(writer), 1);
+
+  ASSERT_EQ(replay_test_games(NULL, &result), 1);
+  EXPECT_EQ(result.cDivergenceId, 'A');
+  EXPECT_EQ(result.llEventAmount, 3);
+  EXPECT_EQ(result.sDivergentEvent.cEventId, 'T');
+  EXPECT_EQ(result.sDivergentGameState.nPlayerBalance, kPlayerBalance);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete writer;
+}
+
+TEST(ReplayEventLogTest, TakesLivePricesFromLog) {
+  EventLogWriter* writer = new EventLogWriter;
+  GameEvent game_event = {};
+  ReplayResult result;
+
+  ASSERT_EQ(openEventLogWriter(writer, make_test_file_path("events").c_str()), 1);
+
+  game_event.cEventId = 'G';
+  game_event.cPriceSourceId = 'L';
+  game_event.nPlayerBalance = kPlayerBalance;
+  writeGameEvent(writer, &game_event);
+
+  // The prices ticked once before the player bought at the newer price.
+  game_event.cEventId = 'M';
+  game_event.anMarketPrices[0] = MINIMUM_MANILA_COCONUT_PRICE;
+  game_event.anMarketPrices[1] = MINIMUM_MANILA_RICE_PRICE;
+  game_event.anMarketPrices[2] = MINIMUM_MANILA_SILK_PRICE;
+  game_event.anMarketPrices[3] = MINIMUM_MANILA_GUN_PRICE;
+  writeGameEvent(writer, &game_event);
+
+  game_event.anMarketPrices[0]++;
+  writeGameEvent(writer, &game_event);
+
+  game_event.cEventId = 'T';
+  game_event.cActionId = 'B';
+  game_event.cCargoId = 'C';
+  game_event.nCargoAmount = 1;
+  game_event.nCargoPrice = game_event.anMarketPrices[0];
+  writeGameEvent(writer, &game_event);
+
+  // No tick can leave the port's price range.
+  game_event.cEventId = 'M';
+  game_event.anMarketPrices[0] = MAXIMUM_MANILA_COCONUT_PRICE + 1;
+  writeGameEvent(writer, &game_event);
+
+  ASSERT_EQ(closeEventLogWriter(writer), 1);
+
+  ASSERT_EQ(replay_test_games(NULL, &result), 1);
+  EXPECT_EQ(result.cDivergenceId, 'M');
+  EXPECT_EQ(result.llEventAmount, 5);
+  EXPECT_EQ(result.sDivergentGameState.nPlayerBalance, kPlayerBalance - MINIMUM_MANILA_COCONUT_PRICE - 1);
+
+  std::remove(make_test_file_path("events").c_str());
+
+  delete writer;
+}
@@ -0,0 +1,183 @@
+extern "C" {
+#include "scripts.h"
+#include "simulation.h"
+}
+
+#include <gtest/gtest.h>
+
+const int kPlayerBalance = 1000;
+
+// compileScript()
+TEST(CompileScriptTest, CompilesEveryCommand) {
+  Script script;
+  int error_line_number;
+
+  ASSERT_TRUE(compileScript("# Trade guns until the last turn.\n"
+                            "repeat-until-turn 14\n"
+                            "  buy gun max\n"
+                            "  sail-to recommended\n"
+                            "  sell gun 10\n"
+                            "  sell-all\n"
+                            "  upgrade-if-affordable\n"
+                            "end\n"
+                            "\n"
+                            "quit  # Done.\n",
+                            &script, &error_line_number));
+
+  ASSERT_EQ(script.nInstructionAmount, 8);
+  EXPECT_EQ(script.aInstructions[0].cInstructionId, 'L');
+  EXPECT_EQ(script.aInstructions[0].nOperand, 14);
+  EXPECT_EQ(script.aInstructions[0].nJumpIndex, 7);
+  EXPECT_EQ(script.aInstructions[1].cTargetId, 'G');
+  EXPECT_EQ(script.aInstructions[1].nOperand, SCRIPT_MAXIMUM_AMOUNT);
+  EXPECT_EQ(script.aInstructions[2].cTargetId, 'R');
+  EXPECT_EQ(script.aInstructions[3].nOperand, 10);
+  EXPECT_EQ(script.aInstructions[6].cInstructionId, 'J');
+  EXPECT_EQ(script.aInstructions[6].nJumpIndex, 0);
+  EXPECT_EQ(script.aInstructions[7].cInstructionId, 'Q');
+}
+
+TEST(CompileScriptTest, ReportsLineOfUnknownCommand) {
+  Script script;
+  int error_line_number;
+
+  EXPECT_FALSE(compileScript("buy rice 5\n\nsail-to cebu\n", &script, &error_line_number));
+  EXPECT_EQ(error_line_number, 3);
+}
+
+TEST(CompileScriptTest, ReportsInvalidAmounts) {
+  Script script;
+  int error_line_number;
+
+  EXPECT_FALSE(compileScript("sell silk 0\n", &script, &error_line_number));
+  EXPECT_EQ(error_line_number, 1);
+  EXPECT_FALSE(compileScript("buy silk 5x\n", &script, &error_line_number));
+  EXPECT_EQ(error_line_number, 1);
+}
+
+TEST(CompileScriptTest, ReportsUnmatchedLoops) {
+  Script script;
+  int error_line_number;
+
+  EXPECT_FALSE(compileScript("sell-all\nend\n", &script, &error_line_number));
+  EXPECT_EQ(error_line_number, 2);
+  EXPECT_FALSE(compileScript("repeat-until-turn 3\nsell-all\n", &script, &error_line_number));
+  EXPECT_EQ(error_line_number, 3);
+}
+
+// chooseScriptAction()
+TEST(ChooseScriptActionTest, BuysMaximumAmount) {
+  Script script;
+  ScriptRunner runner;
+  GameState game_state;
+  GameAction game_action;
+  int error_line_number;
+
+  ASSERT_TRUE(compileScript("buy coconut max\nsail-to tondo\n", &script, &error_line_number));
+  initializeScriptRunner(&runner, &script);
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.anMarketPrices[getCargoIndex('C')] = 20;
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'B');
+  EXPECT_EQ(game_action.cCargoId, 'C');
+  EXPECT_EQ(game_action.nCargoAmount, 50);
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'N');
+  EXPECT_EQ(game_action.cPortId, 'T');
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'Q');
+  EXPECT_EQ(runner.llActionAmount, 2);
+  EXPECT_EQ(runner.llRejectedActionAmount, 0);
+}
+
+TEST(ChooseScriptActionTest, SellsEveryCarriedCargo) {
+  Script script;
+  ScriptRunner runner;
+  GameState game_state;
+  GameAction game_action;
+  int error_line_number;
+
+  ASSERT_TRUE(compileScript("sell-all\nquit\n", &script, &error_line_number));
+  initializeScriptRunner(&runner, &script);
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.anShipCargoAmounts[getCargoIndex('R')] = 4;
+  game_state.anShipCargoAmounts[getCargoIndex('G')] = 7;
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cCargoId, 'R');
+  EXPECT_EQ(game_action.nCargoAmount, 4);
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cCargoId, 'G');
+  EXPECT_EQ(game_action.nCargoAmount, 7);
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'Q');
+}
+
+TEST(ChooseScriptActionTest, SkipsUnaffordableUpgrade) {
+  Script script;
+  ScriptRunner runner;
+  GameState game_state;
+  GameAction game_action;
+  int error_line_number;
+
+  ASSERT_TRUE(compileScript("upgrade-if-affordable\n", &script, &error_line_number));
+  initializeScriptRunner(&runner, &script);
+  initializeGameState(&game_state, TIER_TWO_SHIP_UPGRADE_COST - 1);
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'Q');
+
+  restartScriptRunner(&runner);
+  game_state.nPlayerBalance = TIER_TWO_SHIP_UPGRADE_COST;
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(game_action.cActionId, 'U');
+}
+
+TEST(ChooseScriptActionTest, CountsRejectedActions) {
+  Script script;
+  ScriptRunner runner;
+  GameState game_state;
+  GameAction game_action;
+  int error_line_number;
+
+  ASSERT_TRUE(compileScript("sell silk 5\nsail-to manila\n", &script, &error_line_number));
+  initializeScriptRunner(&runner, &script);
+  initializeGameState(&game_state, kPlayerBalance);
+
+  chooseScriptAction(&game_state, &runner, &game_action);
+  chooseScriptAction(&game_state, &runner, &game_action);
+
+  EXPECT_EQ(runner.llActionAmount, 2);
+  EXPECT_EQ(runner.llRejectedActionAmount, 2);
+}
+
+TEST(ChooseScriptActionTest, RepeatsUntilTurn) {
+  Script script;
+  ScriptRunner runner;
+  GameState game_state;
+  int error_line_number;
+
+  ASSERT_TRUE(compileScript("repeat-until-turn 5\n"
+                            "  sail-to recommended\n"
+                            "end\n",
+                            &script, &error_line_number));
+  initializeScriptRunner(&runner, &script);
+  playSimulatedGame(chooseScriptAction, &runner, kPlayerBalance, NULL, 0, NULL, &game_state);
+
+  EXPECT_EQ(game_state.nPlayerTurns, 5);
+  EXPECT_TRUE(game_state.bPlayerHasQuit);
+  EXPECT_EQ(runner.llRejectedActionAmount, 0);
+}
@@ -0,0 +1,210 @@
+extern "C" {
+#include "shared-market.h"
+}
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Names the shared market after the running test, so that tests run in parallel never share one.
+ * @returns The market's name.
+ */
+std::string get_test_shared_market_name() {
+  return std::string("test-") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+}
+
+void remove_shared_market() {
+  shm_unlink((std::string(SHARED_MARKET_NAME_PREFIX) + get_test_shared_market_name()).c_str());
+}
+
+// openSharedMarketPort()
+TEST(OpenSharedMarketPortTest, KeepsFirstMerchantsPrices) {
+  int prices[CARGO_AMOUNT] = {10, 20, 30, 40};
+  int other_prices[CARGO_AMOUNT] = {11, 21, 31, 41};
+  int stock_amounts[CARGO_AMOUNT];
+
+  remove_shared_market();
+
+  SharedMarket* market = attachSharedMarket(get_test_shared_market_name().c_str());
+  SharedMarket* other_market = attachSharedMarket(get_test_shared_market_name().c_str());
+
+  ASSERT_NE(market, nullptr);
+  ASSERT_NE(other_market, nullptr);
+
+  openSharedMarketPort(market, 'T', prices);
+  openSharedMarketPort(other_market, 'T', other_prices);
+
+  EXPECT_EQ(other_prices[0], 10);
+  EXPECT_EQ(other_prices[3], 40);
+
+  EXPECT_EQ(readSharedMarketPort(other_market, 'T', prices, stock_amounts), 1);
+  EXPECT_EQ(prices[1], 20);
+  EXPECT_EQ(stock_amounts[1], SHARED_MARKET_INITIAL_STOCK);
+
+  detachSharedMarket(other_market);
+  detachSharedMarket(market);
+  remove_shared_market();
+}
+
+// readSharedMarketPort()
+TEST(ReadSharedMarketPortTest, GivesUpOnPortThatStaysChanged) {
+  int prices[CARGO_AMOUNT] = {10, 20, 30, 40};
+  int stock_amounts[CARGO_AMOUNT] = {0};
+
+  remove_shared_market();
+
+  SharedMarket* market = attachSharedMarket(get_test_shared_market_name().c_str());
+
+  ASSERT_NE(market, nullptr);
+
+  openSharedMarketPort(market, 'S', prices);
+
+  // A merchant that is killed while trading leaves the sequence odd.
+  market->asPorts[getPortIndex('S')].ullSequence++;
+  prices[0] = 0;
+
+  EXPECT_EQ(readSharedMarketPort(market, 'S', prices, stock_amounts), 0);
+  EXPECT_EQ(prices[0], 0);
+  EXPECT_EQ(stock_amounts[0], 0);
+
+  detachSharedMarket(market);
+  remove_shared_market();
+}
+
+// tradeSharedMarketCargo()
+TEST(TradeSharedMarketCargoTest, TakesOverLockOfKilledMerchant) {
+  int prices[CARGO_AMOUNT] = {10, 20, 30, 40};
+  int stock_amounts[CARGO_AMOUNT];
+
+  remove_shared_market();
+
+  SharedMarket* market = attachSharedMarket(get_test_shared_market_name().c_str());
+
+  ASSERT_NE(market, nullptr);
+
+  openSharedMarketPort(market, 'S', prices);
+
+  pid_t killed_process_id = fork();
+
+  ASSERT_GE(killed_process_id, 0);
+
+  if (killed_process_id == 0) _exit(0);
+
+  waitpid(killed_process_id, NULL, 0);
+
+  // The merchant died while holding the lock, in the middle of a trade.
+  market->asPorts[getPortIndex('S')].nOwnerId = killed_process_id;
+  market->asPorts[getPortIndex('S')].ullSequence++;
+
+  EXPECT_EQ(tradeSharedMarketCargo(market, 'S', 'B', 'C', 1, 10), 1);
+  EXPECT_EQ(readSharedMarketPort(market, 'S', prices, stock_amounts), 1);
+  EXPECT_EQ(stock_amounts[0], SHARED_MARKET_INITIAL_STOCK - 1);
+  EXPECT_EQ(market->asPorts[getPortIndex('S')].nOwnerId, 0);
+
+  detachSharedMarket(market);
+  remove_shared_market();
+}
+
+TEST(TradeSharedMarketCargoTest, MovesPriceAndStock) {
+  int prices[CARGO_AMOUNT] = {10, 20, 30, 40};
+  int stock_amounts[CARGO_AMOUNT];
+
+  remove_shared_market();
+
+  SharedMarket* market = attachSharedMarket(get_test_shared_market_name().c_str());
+
+  ASSERT_NE(market, nullptr);
+
+  openSharedMarketPort(market, 'T', prices);
+
+  // Tondo's coconuts cost between 4 and 24 gold coins, so every 30 coconuts move the price by 1.
+  EXPECT_EQ(tradeSharedMarketCargo(market, 'T', 'B', 'C', 60, 10), 1);
+
+  readSharedMarketPort(market, 'T', prices, stock_amounts);
+
+  EXPECT_EQ(prices[0], 12);
+  EXPECT_EQ(stock_amounts[0], SHARED_MARKET_INITIAL_STOCK - 60);
+
+  EXPECT_EQ(tradeSharedMarketCargo(market, 'T', 'S', 'C', 30, 12), 1);
+
+  readSharedMarketPort(market, 'T', prices, stock_amounts);
+
+  EXPECT_EQ(prices[0], 11);
+  EXPECT_EQ(stock_amounts[0], SHARED_MARKET_INITIAL_STOCK - 30);
+
+  detachSharedMarket(market);
+  remove_shared_market();
+}
+
+TEST(TradeSharedMarketCargoTest, RejectsStalePricesAndShortStock) {
+  int prices[CARGO_AMOUNT] = {10, 20, 30, 40};
+  int stock_amounts[CARGO_AMOUNT];
+
+  remove_shared_market();
+
+  SharedMarket* market = attachSharedMarket(get_test_shared_market_name().c_str());
+
+  ASSERT_NE(market, nullptr);
+
+  openSharedMarketPort(market, 'M', prices);
+
+  EXPECT_EQ(tradeSharedMarketCargo(market, 'M', 'B', 'R', 1, 19), 0);
+  EXPECT_EQ(tradeSharedMarketCargo(market, 'M', 'B', 'R', SHARED_MARKET_INITIAL_STOCK + 1, 20), 0);
+
+  readSharedMarketPort(market, 'M', prices, stock_amounts);
+
+  EXPECT_EQ(prices[1], 20);
+  EXPECT_EQ(stock_amounts[1], SHARED_MARKET_INITIAL_STOCK);
+
+  detachSharedMarket(market);
+  remove_shared_market();
+}
+
+TEST(TradeSharedMarketCargoTest, KeepsStockConsistentAcrossConcurrentTrades) {
+  const int kThreadAmount = 4;
+  const int kTradeAmount = 50;
+  int prices[CARGO_AMOUNT] = {10, 20, 30, 40};
+  int stock_amounts[CARGO_AMOUNT];
+  std::vector<std::thread> threads;
+  std::string market_name = get_test_shared_market_name();
+
+  remove_shared_market();
+
+  SharedMarket* market = attachSharedMarket(get_test_shared_market_name().c_str());
+
+  ASSERT_NE(market, nullptr);
+
+  openSharedMarketPort(market, 'P', prices);
+
+  // Every thread attaches on its own and retries at the newest price, like a separate game process would.
+  for (int thread_index = 0; thread_index < kThreadAmount; thread_index++) {
+    threads.emplace_back([kTradeAmount, &market_name] {
+      SharedMarket* thread_market = attachSharedMarket(market_name.c_str());
+      int thread_prices[CARGO_AMOUNT];
+      int thread_stock_amounts[CARGO_AMOUNT];
+
+      for (int trade_index = 0; trade_index < kTradeAmount; trade_index++) {
+        do {
+          readSharedMarketPort(thread_market, 'P', thread_prices, thread_stock_amounts);
+        } while (!tradeSharedMarketCargo(thread_market, 'P', 'B', 'G', 1, thread_prices[3]));
+      }
+
+      detachSharedMarket(thread_market);
+    });
+  }
+
+  for (std::thread& thread : threads) thread.join();
+
+  readSharedMarketPort(market, 'P', prices, stock_amounts);
+
+  EXPECT_EQ(stock_amounts[3], SHARED_MARKET_INITIAL_STOCK - kThreadAmount * kTradeAmount);
+
+  detachSharedMarket(market);
+  remove_shared_market();
+}
@@ -0,0 +1,146 @@
+extern "C" {
+#include "bots.h"
+#include "simulation.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "paths.cpp"
+
+const int kGameAmount = 4;
+const unsigned long long kFirstSeed = 7;
+const int kPlayerBalance = 1000;
+const int kPlayerProfitTarget = 20;
+
+// generatePriceTapeGame()
+TEST(GeneratePriceTapeGameTest, StaysWithinPortRanges) {
+  unsigned short prices[PRICE_TAPE_GAME_PRICE_AMOUNT];
+
+  generatePriceTapeGame(kFirstSeed, prices);
+
+  for (int price_index = 0; price_index < PRICE_TAPE_GAME_PRICE_AMOUNT; price_index++) {
+    int minimum_price;
+    int maximum_price;
+
+    getCargoPriceRange(getPortId(price_index / CARGO_AMOUNT % PORT_AMOUNT), getCargoId(price_index % CARGO_AMOUNT),
+                       &minimum_price, &maximum_price);
+
+    EXPECT_GE(prices[price_index], minimum_price);
+    EXPECT_LE(prices[price_index], maximum_price);
+  }
+}
+
+// writePriceTape()
+TEST(WritePriceTapeTest, OpensWithSameGames) {
+  PriceTape price_tape;
+
+  ASSERT_EQ(writePriceTape(make_test_file_path("tape").c_str(), kGameAmount, kFirstSeed), 1);
+  ASSERT_EQ(openPriceTape(make_test_file_path("tape").c_str(), &price_tape), 1);
+
+  EXPECT_EQ(price_tape.nGameAmount, kGameAmount);
+  EXPECT_EQ(price_tape.ullFirstSeed, kFirstSeed);
+
+  for (int game_index = 0; game_index < kGameAmount; game_index++) {
+    unsigned short prices[PRICE_TAPE_GAME_PRICE_AMOUNT];
+
+    generatePriceTapeGame(kFirstSeed + game_index, prices);
+
+    for (int price_index = 0; price_index < PRICE_TAPE_GAME_PRICE_AMOUNT; price_index++) {
+      ASSERT_EQ(price_tape.aunPrices[game_index * PRICE_TAPE_GAME_PRICE_AMOUNT + price_index], prices[price_index]);
+    }
+  }
+
+  closePriceTape(&price_tape);
+  std::remove(make_test_file_path("tape").c_str());
+}
+
+// openPriceTape()
+TEST(OpenPriceTapeTest, RejectsOtherFiles) {
+  PriceTape price_tape;
+  FILE* file = std::fopen(make_test_file_path("tape").c_str(), "wb");
+
+  ASSERT_NE(file, nullptr);
+
+  std::fputs("This is not a price tape, but it is long enough to have a header.", file);
+  std::fclose(file);
+
+  EXPECT_EQ(openPriceTape(make_test_file_path("tape").c_str(), &price_tape), 0);
+  EXPECT_EQ(openPriceTape("missing-simulation-test.tape", &price_tape), 0);
+
+  std::remove(make_test_file_path("tape").c_str());
+}
+
+// playSimulatedGame()
+TEST(PlaySimulatedGameTest, MatchesGeneratedPricesWithPriceTape) {
+  PriceTape price_tape;
+
+  ASSERT_EQ(writePriceTape(make_test_file_path("tape").c_str(), kGameAmount, 0), 1);
+  ASSERT_EQ(openPriceTape(make_test_file_path("tape").c_str(), &price_tape), 1);
+
+  for (int game_index = 0; game_index < kGameAmount; game_index++) {
+    GreedyBot bot;
+    GameState generated_game_state;
+    GameState taped_game_state;
+
+    initializeGreedyBot(&bot, GREEDY_DEFAULT_MINIMUM_MARGIN, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE,
+                        GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT);
+    playSimulatedGame(chooseGreedyAction, &bot, kPlayerBalance, NULL, game_index, NULL, &generated_game_state);
+    initializeGreedyBot(&bot, GREEDY_DEFAULT_MINIMUM_MARGIN, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE,
+                        GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT);
+    playSimulatedGame(chooseGreedyAction, &bot, kPlayerBalance, &price_tape, game_index, NULL, &taped_game_state);
+
+    EXPECT_EQ(hashGameState(&generated_game_state), hashGameState(&taped_game_state));
+    EXPECT_EQ(generated_game_state.nPlayerTurns, MAXIMUM_PLAYER_TURNS);
+  }
+
+  closePriceTape(&price_tape);
+  std::remove(make_test_file_path("tape").c_str());
+}
+
+/**
+ * Chooses an action that is never valid.
+ * @param game_state The state of the game.
+ * @param context Nothing.
+ * @param game_action The invalid action.
+ */
+void choose_invalid_action(const GameState* game_state, void* context, GameAction* game_action) {
+  (void)game_state;
+  (void)context;
+
+  game_action->cActionId = 'X';
+}
+
+TEST(PlaySimulatedGameTest, QuitsAfterTooManyInvalidActions) {
+  GameState game_state;
+
+  EXPECT_EQ(playSimulatedGame(choose_invalid_action, NULL, kPlayerBalance, NULL, 0, NULL, &game_state),
+            SIMULATED_GAME_MAXIMUM_ACTION_AMOUNT);
+  EXPECT_EQ(game_state.bPlayerHasQuit, 1);
+}
+
+// mergeSimulationSummaries()
+TEST(MergeSimulationSummariesTest, CountsGamesThatReachedTarget) {
+  SimulationSummary* summary = new SimulationSummary;
+  SimulationSummary* other_summary = new SimulationSummary;
+  GameState game_state;
+
+  initializeSimulationSummary(summary, kPlayerProfitTarget, 1);
+  initializeSimulationSummary(other_summary, kPlayerProfitTarget, 2);
+  initializeGameState(&game_state, kPlayerBalance);
+  game_state.nPlayerBalance = kPlayerBalance + 100;
+  addSimulationSummaryGame(summary, &game_state);
+  game_state.nPlayerBalance = kPlayerBalance - 100;
+  addSimulationSummaryGame(other_summary, &game_state);
+  mergeSimulationSummaries(summary, other_summary);
+
+  EXPECT_EQ(summary->llGameAmount, 2);
+  EXPECT_EQ(summary->llTargetReachedGameAmount, 1);
+  EXPECT_EQ(summary->dProfitSum, 0);
+  EXPECT_EQ(getQuantileSketchValue(&summary->sProfitSketch, 0), -100);
+  EXPECT_EQ(getQuantileSketchValue(&summary->sProfitSketch, 1), 100);
+
+  delete summary;
+  delete other_summary;
+}
@@ -0,0 +1,112 @@
+extern "C" {
+#include "sketches.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+const int kValueAmount = 100000;
+const double kQuantileTolerance = 0.01 * kValueAmount;
+
+/**
+ * Adds the integers from `0` up to the number of values to a quantile sketch in a scrambled order.
+ * @param sketch The sketch.
+ * @param first_value The first value to add.
+ * @param step The difference between consecutive added values.
+ */
+void add_scrambled_values(QuantileSketch* sketch, int first_value, int step) {
+  for (int value_index = first_value; value_index < kValueAmount; value_index += step) {
+    // Multiplying by a number coprime with the number of values visits every value once in a scrambled order.
+    addQuantileSketchValue(sketch, (value_index * 7919LL) % kValueAmount);
+  }
+}
+
+// getQuantileSketchValue()
+TEST(GetQuantileSketchValueTest, EstimatesQuantilesOfManyValues) {
+  QuantileSketch* sketch = new QuantileSketch;
+
+  initializeQuantileSketch(sketch, 1);
+  add_scrambled_values(sketch, 0, 1);
+
+  EXPECT_EQ(sketch->llValueAmount, kValueAmount);
+  EXPECT_EQ(getQuantileSketchValue(sketch, 0), 0);
+  EXPECT_EQ(getQuantileSketchValue(sketch, 1), kValueAmount - 1);
+  EXPECT_NEAR(getQuantileSketchValue(sketch, 0.01), 0.01 * kValueAmount, kQuantileTolerance);
+  EXPECT_NEAR(getQuantileSketchValue(sketch, 0.5), 0.5 * kValueAmount, kQuantileTolerance);
+  EXPECT_NEAR(getQuantileSketchValue(sketch, 0.99), 0.99 * kValueAmount, kQuantileTolerance);
+
+  delete sketch;
+}
+
+TEST(GetQuantileSketchValueTest, ReturnsZeroWhenEmpty) {
+  QuantileSketch* sketch = new QuantileSketch;
+
+  initializeQuantileSketch(sketch, 1);
+
+  EXPECT_EQ(getQuantileSketchValue(sketch, 0.5), 0);
+
+  delete sketch;
+}
+
+// mergeQuantileSketches()
+TEST(MergeQuantileSketchesTest, EstimatesQuantilesOfBothSketches) {
+  QuantileSketch* even_sketch = new QuantileSketch;
+  QuantileSketch* odd_sketch = new QuantileSketch;
+
+  initializeQuantileSketch(even_sketch, 1);
+  initializeQuantileSketch(odd_sketch, 2);
+  add_scrambled_values(even_sketch, 0, 2);
+  add_scrambled_values(odd_sketch, 1, 2);
+  mergeQuantileSketches(even_sketch, odd_sketch);
+
+  EXPECT_EQ(even_sketch->llValueAmount, kValueAmount);
+  EXPECT_NEAR(getQuantileSketchValue(even_sketch, 0.5), 0.5 * kValueAmount, kQuantileTolerance);
+  EXPECT_NEAR(getQuantileSketchValue(even_sketch, 0.99), 0.99 * kValueAmount, kQuantileTolerance);
+
+  delete even_sketch;
+  delete odd_sketch;
+}
+
+// getHistogramBinIndex()
+TEST(GetHistogramBinIndexTest, IncreasesWithValue) {
+  int previous_bin_index = getHistogramBinIndex(-1e9);
+
+  for (double value = -1e9; value < 1e9; value = value < 0 ? value / 1.1 + 1 : value * 1.1 + 1) {
+    int bin_index = getHistogramBinIndex(value);
+
+    ASSERT_GE(bin_index, previous_bin_index);
+    ASSERT_LT(bin_index, HISTOGRAM_BIN_AMOUNT);
+
+    previous_bin_index = bin_index;
+  }
+}
+
+// getHistogramBinBound()
+TEST(GetHistogramBinBoundTest, BoundsValuesInBin) {
+  const double values[] = {-1000, -3, 1, 5, 1000, 123456};
+
+  for (double value : values) {
+    double bound = getHistogramBinBound(getHistogramBinIndex(value));
+
+    EXPECT_LE(std::abs(bound), std::abs(value));
+    EXPECT_GE(std::abs(bound), std::abs(value) / 1.1);
+  }
+}
+
+// mergeHistograms()
+TEST(MergeHistogramsTest, AddsCounts) {
+  Histogram histogram;
+  Histogram other_histogram;
+
+  initializeHistogram(&histogram);
+  initializeHistogram(&other_histogram);
+  addHistogramValue(&histogram, 100);
+  addHistogramValue(&other_histogram, 100);
+  addHistogramValue(&other_histogram, -100);
+  mergeHistograms(&histogram, &other_histogram);
+
+  EXPECT_EQ(histogram.llValueAmount, 3);
+  EXPECT_EQ(histogram.allBinCounts[getHistogramBinIndex(100)], 2);
+  EXPECT_EQ(histogram.allBinCounts[getHistogramBinIndex(-100)], 1);
+}
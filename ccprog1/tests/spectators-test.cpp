@@ -0,0 +1,183 @@
+extern "C" {
+#include "spectators.h"
+}
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <string>
+
+#include "utils.cpp"
+
+/**
+ * Names the broadcast after the running test, so that tests run in parallel never share one.
+ * @returns The broadcast's name.
+ */
+std::string get_test_broadcast_name() {
+  return std::string("test-") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+}
+
+/**
+ * Leaves behind the broadcast of a game whose process was killed before it could stop broadcasting.
+ * @returns `true` if the broadcast was created.
+ */
+bool create_killed_test_broadcast() {
+  std::string shared_memory_name = std::string(SPECTATOR_NAME_PREFIX) + get_test_broadcast_name();
+  pid_t killed_process_id = fork();
+
+  if (killed_process_id == 0) _exit(0);
+
+  waitpid(killed_process_id, NULL, 0);
+  shm_unlink(shared_memory_name.c_str());
+
+  int file_descriptor = shm_open(shared_memory_name.c_str(), O_RDWR | O_CREAT, 0644);
+
+  if (file_descriptor < 0 || ftruncate(file_descriptor, sizeof(SpectatorRing)) != 0) return false;
+
+  void* memory = mmap(NULL, sizeof(SpectatorRing), PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+
+  close(file_descriptor);
+
+  if (memory == MAP_FAILED) return false;
+
+  SpectatorRing* ring = static_cast<SpectatorRing*>(memory);
+
+  std::memcpy(ring->acMagic, SPECTATOR_RING_MAGIC, sizeof(ring->acMagic));
+  ring->nVersion = SPECTATOR_RING_VERSION;
+  ring->nPlayerId = killed_process_id;
+
+  munmap(memory, sizeof(SpectatorRing));
+
+  return true;
+}
+
+/**
+ * Reads the next frame of a broadcast.
+ * @param view The view.
+ * @returns The frame's text, or an empty string if there is no frame to read.
+ */
+std::string read_test_frame(SpectatorView* view) {
+  static char text[SPECTATOR_FRAME_SIZE];
+  int text_size;
+
+  if (readSpectatorFrame(view, text, &text_size) != 1) return "";
+
+  return std::string(text, text_size);
+}
+
+// readSpectatorFrame()
+TEST(ReadSpectatorFrameTest, ReadsEveryChunkOfOutput) {
+  SpectatorView view;
+
+  ASSERT_EQ(startSpectatorBroadcast(get_test_broadcast_name().c_str()), 1);
+  ASSERT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 1);
+
+  begin_output_capture(0);
+  printConsoleText("Screen %d\n", 1);
+  printStyledText(GREEN_COLOR_ID, "Prompt");
+  flushOutputChunk();
+  printConsoleText("Screen %d\n", 2);
+  stopSpectatorBroadcast();
+
+  EXPECT_EQ(end_output_capture(), "Screen 1\nPromptScreen 2\n");
+  EXPECT_EQ(read_test_frame(&view), "Screen 1\nPrompt");
+  EXPECT_EQ(read_test_frame(&view), "Screen 2\n");
+
+  char text[1];
+  int text_size;
+
+  EXPECT_EQ(readSpectatorFrame(&view, text, &text_size), -1);
+
+  detachSpectatorView(&view);
+}
+
+TEST(ReadSpectatorFrameTest, SkipsFramesThatWereRewritten) {
+  SpectatorView view;
+
+  ASSERT_EQ(startSpectatorBroadcast(get_test_broadcast_name().c_str()), 1);
+  ASSERT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 1);
+
+  begin_output_capture(0);
+
+  for (int frame_index = 0; frame_index < SPECTATOR_FRAME_AMOUNT + 4; frame_index++) {
+    printConsoleText("Frame %d", frame_index);
+    flushOutputChunk();
+  }
+
+  end_output_capture();
+
+  EXPECT_EQ(read_test_frame(&view), "Frame 4");
+  EXPECT_EQ(view.llSkippedAmount, 4);
+
+  stopSpectatorBroadcast();
+  detachSpectatorView(&view);
+}
+
+// attachSpectatorView()
+TEST(AttachSpectatorViewTest, StartsAtOldestFrameInRing) {
+  SpectatorView view;
+
+  ASSERT_EQ(startSpectatorBroadcast(get_test_broadcast_name().c_str()), 1);
+
+  begin_output_capture(0);
+
+  for (int frame_index = 0; frame_index < SPECTATOR_FRAME_AMOUNT + 1; frame_index++) {
+    printConsoleText("Frame %d", frame_index);
+    flushOutputChunk();
+  }
+
+  end_output_capture();
+
+  ASSERT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 1);
+  EXPECT_EQ(read_test_frame(&view), "Frame 1");
+  EXPECT_EQ(view.llSkippedAmount, 0);
+
+  stopSpectatorBroadcast();
+  detachSpectatorView(&view);
+
+  EXPECT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 0);
+}
+
+TEST(AttachSpectatorViewTest, EndsWithKilledGame) {
+  SpectatorView view;
+
+  ASSERT_TRUE(create_killed_test_broadcast());
+  ASSERT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 1);
+
+  char text[1];
+  int text_size;
+
+  EXPECT_EQ(readSpectatorFrame(&view, text, &text_size), -1);
+
+  detachSpectatorView(&view);
+  shm_unlink((std::string(SPECTATOR_NAME_PREFIX) + get_test_broadcast_name()).c_str());
+}
+
+// startSpectatorBroadcast()
+TEST(StartSpectatorBroadcastTest, RefusesNameOfRunningGame) {
+  SpectatorView view;
+
+  ASSERT_EQ(startSpectatorBroadcast(get_test_broadcast_name().c_str()), 1);
+  EXPECT_EQ(startSpectatorBroadcast(get_test_broadcast_name().c_str()), 0);
+
+  stopSpectatorBroadcast();
+
+  EXPECT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 0);
+}
+
+TEST(StartSpectatorBroadcastTest, ReplacesBroadcastOfKilledGame) {
+  SpectatorView view;
+
+  ASSERT_TRUE(create_killed_test_broadcast());
+  ASSERT_EQ(startSpectatorBroadcast(get_test_broadcast_name().c_str()), 1);
+  ASSERT_EQ(attachSpectatorView(&view, get_test_broadcast_name().c_str()), 1);
+
+  EXPECT_EQ(view.pRing->nPlayerId, getpid());
+
+  stopSpectatorBroadcast();
+  detachSpectatorView(&view);
+}
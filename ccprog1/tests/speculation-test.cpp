@@ -0,0 +1,104 @@
+extern "C" {
+#include "layout.h"
+#include "speculation.h"
+#include "text-graphics.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "utils.cpp"
+
+const int kPlayerTurns = 3;
+
+/**
+ * Renders the navigation screen without any speculation.
+ * @param port_id The ID of the port navigated to.
+ * @returns The screen's text.
+ */
+std::string render_navigation_screen(char port_id) {
+  begin_output_capture(1);
+  printNavigationScreen(port_id, kPlayerTurns);
+
+  return end_output_capture();
+}
+
+// printSpeculativeNavigationScreen()
+TEST(PrintSpeculativeNavigationScreenTest, PrintsSameTextAsRendering) {
+  std::string rendered_screen = render_navigation_screen('T');
+  long long rendered_amount;
+  long long printed_amount;
+
+  ASSERT_TRUE(startSpeculativeRendering());
+
+  begin_output_capture(1);
+  requestSpeculativeNavigationScreen('T', kPlayerTurns);
+  waitForSpeculativeScreens();
+
+  EXPECT_TRUE(printSpeculativeNavigationScreen('T', kPlayerTurns));
+  EXPECT_EQ(end_output_capture(), rendered_screen);
+
+  getSpeculativeScreenAmounts(&rendered_amount, &printed_amount);
+  stopSpeculativeRendering();
+
+  EXPECT_GE(rendered_amount, 1);
+  EXPECT_GE(printed_amount, 1);
+}
+
+TEST(PrintSpeculativeNavigationScreenTest, SkipsScreenThatWasNotRequested) {
+  ASSERT_TRUE(startSpeculativeRendering());
+
+  begin_output_capture(1);
+  requestSpeculativeNavigationScreen('T', kPlayerTurns);
+  waitForSpeculativeScreens();
+
+  EXPECT_FALSE(printSpeculativeNavigationScreen('P', kPlayerTurns));
+  EXPECT_EQ(end_output_capture(), "");
+
+  stopSpeculativeRendering();
+}
+
+TEST(PrintSpeculativeNavigationScreenTest, SkipsScreenRenderedForOtherWidth) {
+  ASSERT_TRUE(startSpeculativeRendering());
+
+  setLayoutWidth(MAX_PRINT_WIDTH);
+  requestSpeculativeNavigationScreen('S', kPlayerTurns);
+  waitForSpeculativeScreens();
+  setLayoutWidth(MAX_PRINT_WIDTH + 40);
+
+  std::string rendered_screen = render_navigation_screen('S');
+
+  begin_output_capture(1);
+
+  EXPECT_FALSE(printSpeculativeNavigationScreen('S', kPlayerTurns));
+
+  requestSpeculativeNavigationScreen('S', kPlayerTurns);
+  waitForSpeculativeScreens();
+
+  EXPECT_TRUE(printSpeculativeNavigationScreen('S', kPlayerTurns));
+  EXPECT_EQ(end_output_capture(), rendered_screen);
+
+  stopSpeculativeRendering();
+  setLayoutWidth(0);
+}
+
+// printSpeculativeMainScreen()
+TEST(PrintSpeculativeMainScreenTest, PrintsSameTextAsRendering) {
+  begin_output_capture(1);
+  printMainScreen(kPlayerTurns, 'P', 7, 1500, 25, 200, 30, 50, 10, 5, 0, 15, 12, 8, 40, 95);
+
+  std::string rendered_screen = end_output_capture();
+
+  ASSERT_TRUE(startSpeculativeRendering());
+
+  begin_output_capture(1);
+  requestSpeculativeMainScreen(kPlayerTurns, 'P', 7, 1500, 25, 200, 30, 50, 10, 5, 0, 15, 12, 8, 40, 95);
+  waitForSpeculativeScreens();
+
+  EXPECT_FALSE(printSpeculativeMainScreen(kPlayerTurns, 'P', 7, 1500, 25, 200, 30, 50, 10, 5, 0, 15, 12, 8, 40, 96));
+  EXPECT_TRUE(printSpeculativeMainScreen(kPlayerTurns, 'P', 7, 1500, 25, 200, 30, 50, 10, 5, 0, 15, 12, 8, 40, 95));
+  EXPECT_EQ(end_output_capture(), rendered_screen);
+
+  stopSpeculativeRendering();
+}
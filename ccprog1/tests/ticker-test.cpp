@@ -0,0 +1,109 @@
+extern "C" {
+#include "ticker.h"
+}
+
+#include <gtest/gtest.h>
+
+const int kTondoPrices[CARGO_AMOUNT] = {MINIMUM_TONDO_COCONUT_PRICE, MAXIMUM_TONDO_RICE_PRICE, MINIMUM_TONDO_SILK_PRICE,
+                                        MAXIMUM_TONDO_GUN_PRICE};
+const int kSapaPrices[CARGO_AMOUNT] = {MAXIMUM_SAPA_COCONUT_PRICE, MINIMUM_SAPA_RICE_PRICE, MAXIMUM_SAPA_SILK_PRICE,
+                                       MINIMUM_SAPA_GUN_PRICE};
+const int kSnapshotReadAmount = 200000;
+
+/**
+ * Checks whether every price of a snapshot is within its port's price ranges.
+ * @param snapshot The snapshot.
+ * @returns Whether the prices are within range.
+ */
+bool is_snapshot_within_range(const MarketSnapshot& snapshot) {
+  for (int cargo_index = 0; cargo_index < CARGO_AMOUNT; cargo_index++) {
+    int minimum_price;
+    int maximum_price;
+
+    getCargoPriceRange(snapshot.cPortId, getCargoId(cargo_index), &minimum_price, &maximum_price);
+
+    if (snapshot.anMarketPrices[cargo_index] < minimum_price || snapshot.anMarketPrices[cargo_index] > maximum_price) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// openMarketTickerPort()
+TEST(OpenMarketTickerPortTest, PublishesOpeningPrices) {
+  MarketTicker* ticker = new MarketTicker;
+  MarketSnapshot snapshot;
+
+  startMarketTicker(ticker, MARKET_TICKER_MAXIMUM_INTERVAL, 1);
+  readMarketTicker(ticker, &snapshot);
+
+  EXPECT_EQ(snapshot.cPortId, 0);
+
+  openMarketTickerPort(ticker, 'T', kTondoPrices);
+  readMarketTicker(ticker, &snapshot);
+  stopMarketTicker(ticker);
+
+  EXPECT_EQ(snapshot.cPortId, 'T');
+  EXPECT_EQ(snapshot.llTick, 0);
+
+  for (int cargo_index = 0; cargo_index < CARGO_AMOUNT; cargo_index++) {
+    EXPECT_EQ(snapshot.anMarketPrices[cargo_index], kTondoPrices[cargo_index]);
+  }
+
+  delete ticker;
+}
+
+// advanceMarketTicker()
+TEST(AdvanceMarketTickerTest, KeepsPricesWithinRange) {
+  MarketTicker* ticker = new MarketTicker;
+  MarketSnapshot snapshot;
+  bool prices_have_moved = false;
+
+  startMarketTicker(ticker, MARKET_TICKER_MAXIMUM_INTERVAL, 2);
+  openMarketTickerPort(ticker, 'S', kSapaPrices);
+
+  for (int tick = 1; tick <= 1000; tick++) {
+    advanceMarketTicker(ticker);
+    readMarketTicker(ticker, &snapshot);
+
+    ASSERT_EQ(snapshot.llTick, tick);
+    ASSERT_TRUE(is_snapshot_within_range(snapshot));
+
+    prices_have_moved = prices_have_moved || snapshot.anMarketPrices[3] != kSapaPrices[3];
+  }
+
+  stopMarketTicker(ticker);
+
+  EXPECT_TRUE(prices_have_moved);
+
+  delete ticker;
+}
+
+// readMarketTicker()
+TEST(ReadMarketTickerTest, NeverReadsTornSnapshot) {
+  MarketTicker* ticker = new MarketTicker;
+  MarketSnapshot snapshot;
+  int torn_snapshot_amount = 0;
+
+  // Tick nonstop and switch between ports whose gun prices never overlap, so a torn snapshot is out of range.
+  ASSERT_EQ(startMarketTicker(ticker, 0, 3), 1);
+
+  for (int read_index = 0; read_index < kSnapshotReadAmount; read_index++) {
+    if (read_index % 2000 == 0) {
+      openMarketTickerPort(ticker, 'T', kTondoPrices);
+    } else if (read_index % 2000 == 1000) {
+      openMarketTickerPort(ticker, 'S', kSapaPrices);
+    }
+
+    readMarketTicker(ticker, &snapshot);
+
+    if (!is_snapshot_within_range(snapshot)) torn_snapshot_amount++;
+  }
+
+  stopMarketTicker(ticker);
+
+  EXPECT_EQ(torn_snapshot_amount, 0);
+
+  delete ticker;
+}
@@ -42,6 +42,47 @@ TEST(GenerateRandomPriceTest, HandlesNegativeIntegers) {
   EXPECT_LE(random_price, 0);
 }
 
+// getCargoPriceRange()
+TEST(GetCargoPriceRangeTest, ReturnsPortCargoRange) {
+  int minimum_price;
+  int maximum_price;
+
+  getCargoPriceRange('S', 'G', &minimum_price, &maximum_price);
+
+  EXPECT_EQ(minimum_price, MINIMUM_SAPA_GUN_PRICE);
+  EXPECT_EQ(maximum_price, MAXIMUM_SAPA_GUN_PRICE);
+}
+
+TEST(GetCargoPriceRangeTest, DistinguishesSilkFromSapa) {
+  int minimum_price;
+  int maximum_price;
+
+  getCargoPriceRange('T', 'S', &minimum_price, &maximum_price);
+
+  EXPECT_EQ(minimum_price, MINIMUM_TONDO_SILK_PRICE);
+  EXPECT_EQ(maximum_price, MAXIMUM_TONDO_SILK_PRICE);
+}
+
+// getPortIndex()
+TEST(GetPortIndexTest, RoundTripsWithGetPortId) {
+  for (int port_index = 0; port_index < PORT_AMOUNT; port_index++) {
+    EXPECT_EQ(getPortIndex(getPortId(port_index)), port_index);
+  }
+}
+
+TEST(GetPortIndexTest, RejectsUnknownPorts) { EXPECT_EQ(getPortIndex('X'), -1); }
+
+// getShipUpgradeCost()
+TEST(GetShipUpgradeCostTest, ReturnsNextTierCost) {
+  EXPECT_EQ(getShipUpgradeCost(TIER_TWO_SHIP_CARGO_LIMIT), TIER_THREE_SHIP_UPGRADE_COST);
+  EXPECT_EQ(getShipUpgradedCargoLimit(TIER_TWO_SHIP_CARGO_LIMIT), TIER_THREE_SHIP_CARGO_LIMIT);
+}
+
+TEST(GetShipUpgradeCostTest, ReturnsZeroForHighestTier) {
+  EXPECT_EQ(getShipUpgradeCost(TIER_FOUR_SHIP_CARGO_LIMIT), 0);
+  EXPECT_EQ(getShipUpgradedCargoLimit(TIER_FOUR_SHIP_CARGO_LIMIT), TIER_FOUR_SHIP_CARGO_LIMIT);
+}
+
 // tradeCargo()
 TEST(TradeCargoTest, SubtractsCostFromBalance) {
   int player_balance = kPlayerBalance;
@@ -0,0 +1,59 @@
+extern "C" {
+#include "bots.h"
+#include "tuning.h"
+}
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+const int kCandidateAmount = 4;
+const int kInitialGameAmount = 8;
+const unsigned long long kSeed = 3;
+
+// tuneGreedyBot()
+TEST(TuneGreedyBotTest, HalvesCandidatesUntilOneIsLeft) {
+  TuningCandidate best_candidate;
+  FILE* history_file = std::tmpfile();
+
+  ASSERT_NE(history_file, nullptr);
+  EXPECT_EQ(tuneGreedyBot(kCandidateAmount, kInitialGameAmount, 1, NULL, kSeed, history_file, &best_candidate), 3);
+  EXPECT_EQ(best_candidate.nGameAmount, 4 * kInitialGameAmount);
+
+  int line_amount = 0;
+  int character;
+
+  std::rewind(history_file);
+
+  while ((character = std::fgetc(history_file)) != EOF) {
+    if (character == '\n') line_amount++;
+  }
+
+  // The header, then 4, 2, and 1 candidates.
+  EXPECT_EQ(line_amount, 1 + 4 + 2 + 1);
+
+  std::fclose(history_file);
+}
+
+TEST(TuneGreedyBotTest, MatchesSingleThreadWithMultipleThreads) {
+  TuningCandidate single_thread_candidate;
+  TuningCandidate multiple_thread_candidate;
+
+  tuneGreedyBot(kCandidateAmount, kInitialGameAmount, 1, NULL, kSeed, NULL, &single_thread_candidate);
+  tuneGreedyBot(kCandidateAmount, kInitialGameAmount, 3, NULL, kSeed, NULL, &multiple_thread_candidate);
+
+  EXPECT_EQ(single_thread_candidate.nMinimumMargin, multiple_thread_candidate.nMinimumMargin);
+  EXPECT_EQ(single_thread_candidate.nMinimumUpgradeValue, multiple_thread_candidate.nMinimumUpgradeValue);
+  EXPECT_EQ(single_thread_candidate.nRouteValueWeight, multiple_thread_candidate.nRouteValueWeight);
+  EXPECT_EQ(single_thread_candidate.dProfitSum, multiple_thread_candidate.dProfitSum);
+}
+
+TEST(TuneGreedyBotTest, StartsFromDefaultsWithOneCandidate) {
+  TuningCandidate best_candidate;
+
+  EXPECT_EQ(tuneGreedyBot(1, kInitialGameAmount, 1, NULL, kSeed, NULL, &best_candidate), 1);
+  EXPECT_EQ(best_candidate.nMinimumMargin, GREEDY_DEFAULT_MINIMUM_MARGIN);
+  EXPECT_EQ(best_candidate.nMinimumUpgradeValue, GREEDY_DEFAULT_MINIMUM_UPGRADE_VALUE);
+  EXPECT_EQ(best_candidate.nRouteValueWeight, GREEDY_DEFAULT_ROUTE_VALUE_WEIGHT);
+  EXPECT_EQ(best_candidate.nGameAmount, kInitialGameAmount);
+}
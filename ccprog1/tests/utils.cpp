@@ -1,6 +1,12 @@
+extern "C" {
+#include "console.h"
+}
+
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 #include <cstdio>
+#include <string>
 
 /**
  * Verifies if `freopen()` has successfully reopened a file.
@@ -13,3 +19,46 @@ void verify_file_reopening(FILE* reopened_file) {
     exit(EXIT_FAILURE);
   }
 }
+
+static int standard_output_copy;
+static FILE* captured_output_file;
+
+/**
+ * Starts capturing the standard output in a temporary file, with the console's colors forced on or off.
+ * @param colors_are_enabled Whether color escape sequences are printed.
+ */
+void begin_output_capture(int colors_are_enabled) {
+  // Start from the default color without printing its escape sequence.
+  setConsoleColorsEnabled(0);
+  resetConsoleColor();
+  printConsoleText("%s", "");
+  setConsoleColorsEnabled(colors_are_enabled);
+  fflush(stdout);
+
+  captured_output_file = tmpfile();
+  standard_output_copy = dup(STDOUT_FILENO);
+
+  dup2(fileno(captured_output_file), STDOUT_FILENO);
+}
+
+/**
+ * Stops capturing the standard output.
+ * @returns Everything printed since the capture began.
+ */
+std::string end_output_capture() {
+  char buffer[256];
+  std::string output;
+
+  fflush(stdout);
+  dup2(standard_output_copy, STDOUT_FILENO);
+  close(standard_output_copy);
+  rewind(captured_output_file);
+
+  for (size_t read_size; (read_size = fread(buffer, 1, sizeof(buffer), captured_output_file)) > 0;) {
+    output.append(buffer, read_size);
+  }
+
+  fclose(captured_output_file);
+
+  return output;
+}